@@ -0,0 +1,493 @@
+/**
+* @file		BigFraction.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Arbitrary-precision mathematical fraction with the same operators as Fraction, for long exact computations
+*  that would overflow a machine word. Small numerators and denominators stay inline (see BigInteger).
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "BigFraction.h"
+#include "Gcd.h"
+#include <climits>
+#include <utility>
+
+/**
+*	Constructs an object representing a mathematical fraction, with value 1/1.
+*/
+BigFraction::BigFraction() : BigFraction(1) {
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from the specified numerator.
+*
+*	@param numerator The numerator of the fraction
+*/
+BigFraction::BigFraction(long long numerator) : numerator(numerator), denominator(1) {
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from the specified numerator and denominator.
+*
+*	@param numerator The numerator of the fraction
+*	@param denominator The denominator of the fraction
+*/
+BigFraction::BigFraction(long long numerator, long long denominator) : numerator(numerator), denominator(denominator) {
+	reduce();
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from an arbitrary-precision numerator and denominator.
+*
+*	@param numerator The numerator of the fraction
+*	@param denominator The denominator of the fraction
+*/
+BigFraction::BigFraction(BigInteger numerator, BigInteger denominator) : numerator(std::move(numerator)), denominator(std::move(denominator)) {
+	reduce();
+}
+
+/**
+*	Returns the numerator of this fraction in simplest form. Carries the sign of the fraction.
+*
+*	@return the numerator
+*/
+const BigInteger& BigFraction::getNumerator() const {
+	return numerator;
+}
+
+/**
+*	Returns the denominator of this fraction in simplest form. Always positive.
+*
+*	@return the denominator
+*/
+const BigInteger& BigFraction::getDenominator() const {
+	return denominator;
+}
+
+/**
+*	Tells whether both the numerator and the denominator are held inline, without any heap storage.
+*
+*	@return true if numerator and denominator both fit into a long long
+*/
+bool BigFraction::isSmall() const {
+	return numerator.isSmall() && denominator.isSmall();
+}
+
+/**
+*	Overrides equality operator, verifying that both the numerators and the denominators of the two fractions match.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if fractions are equal, false if not
+*/
+bool BigFraction::operator==(const BigFraction& rhs) const {
+	return numerator == rhs.numerator && denominator == rhs.denominator;
+}
+
+/**
+*	Overrides inequality operator, verifying that not both the numerators and the denominators of the two fractions match.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean false if fractions are equal, true if not
+*/
+bool BigFraction::operator!=(const BigFraction& rhs) const {
+	return !((*this) == rhs);
+}
+
+/**
+*	Compares this fraction with the provided one exactly. Settles on the signs or on equal denominators when it can,
+*	and otherwise compares the cross products.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return -1 if this fraction is smaller, 0 if they are equal, 1 if this fraction is larger
+*/
+int BigFraction::compare(const BigFraction& rhs) const {
+	int lhsSign = numerator.sign();
+	int rhsSign = rhs.numerator.sign();
+	if (lhsSign != rhsSign || lhsSign == 0)
+		return (lhsSign > rhsSign) - (lhsSign < rhsSign);
+
+	if (denominator == rhs.denominator)
+		return numerator.compare(rhs.numerator);
+	return (numerator * rhs.denominator).compare(rhs.numerator * denominator);
+}
+
+bool BigFraction::operator<(const BigFraction& rhs) const {
+	return compare(rhs) < 0;
+}
+
+bool operator<(const BigFraction& lhs, const long long rhs) {
+	return lhs.compare(BigFraction(rhs)) < 0;
+}
+
+bool operator<(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs).compare(rhs) < 0;
+}
+
+bool BigFraction::operator<=(const BigFraction& rhs) const {
+	return compare(rhs) <= 0;
+}
+
+bool operator<=(const BigFraction& lhs, const long long rhs) {
+	return lhs.compare(BigFraction(rhs)) <= 0;
+}
+
+bool operator<=(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs).compare(rhs) <= 0;
+}
+
+bool BigFraction::operator>(const BigFraction& rhs) const {
+	return compare(rhs) > 0;
+}
+
+bool operator>(const BigFraction& lhs, const long long rhs) {
+	return lhs.compare(BigFraction(rhs)) > 0;
+}
+
+bool operator>(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs).compare(rhs) > 0;
+}
+
+bool BigFraction::operator>=(const BigFraction& rhs) const {
+	return compare(rhs) >= 0;
+}
+
+bool operator>=(const BigFraction& lhs, const long long rhs) {
+	return lhs.compare(BigFraction(rhs)) >= 0;
+}
+
+bool operator>=(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs).compare(rhs) >= 0;
+}
+
+/**
+*	Returns a new fraction which is the sum of this one and the provided one.
+*
+*	@param rhs fraction to be added to this one.
+*	@return the sum of this fraction and the provided one as a new BigFraction
+*/
+BigFraction BigFraction::operator+(const BigFraction& rhs) const& {
+	if (denominator == rhs.denominator)
+		return BigFraction(numerator + rhs.numerator, denominator);
+	return BigFraction(numerator * rhs.denominator + rhs.numerator * denominator, denominator * rhs.denominator);
+}
+
+BigFraction BigFraction::operator+(const BigFraction& rhs) && {
+	return std::move(*this += rhs);
+}
+
+BigFraction operator+(const BigFraction& lhs, BigFraction&& rhs) {
+	return std::move(rhs += lhs);
+}
+
+BigFraction operator+(BigFraction&& lhs, BigFraction&& rhs) {
+	return std::move(lhs += rhs);
+}
+
+BigFraction operator+(const BigFraction& lhs, const long long rhs) {
+	return BigFraction(lhs) + rhs;
+}
+
+BigFraction operator+(BigFraction&& lhs, const long long rhs) {
+	return std::move(lhs += rhs);
+}
+
+BigFraction operator+(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(rhs) + lhs;
+}
+
+BigFraction operator+(const long long lhs, BigFraction&& rhs) {
+	return std::move(rhs += lhs);
+}
+
+/**
+*	Replaces this fraction with the sum of this one and the provided one, in place.
+*
+*	@param rhs fraction to be added to this one
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator+=(const BigFraction& rhs) {
+	if (denominator == rhs.denominator) {
+		numerator += rhs.numerator;
+	}
+	else {
+		numerator *= rhs.denominator;
+		numerator += rhs.numerator * denominator;
+		denominator *= rhs.denominator;
+	}
+	reduce();
+	return *this;
+}
+
+/**
+*	Adds an integer to the provided fraction in place. Adding a multiple of the denominator cannot introduce a
+*	common factor, so nothing needs reducing.
+*
+*	@param lhs fraction to be added to
+*	@param rhs integer to be added
+*	@return a reference to lhs, for chaining
+*/
+BigFraction& operator+=(BigFraction& lhs, const long long rhs) {
+	lhs.numerator += lhs.denominator * rhs;
+	return lhs;
+}
+
+/**
+*	Returns a new fraction which is the difference between this one and the provided one.
+*
+*	@param rhs fraction to be subtracted from this one.
+*	@return the difference between this fraction and the provided one as a new BigFraction
+*/
+BigFraction BigFraction::operator-(const BigFraction& rhs) const& {
+	if (denominator == rhs.denominator)
+		return BigFraction(numerator - rhs.numerator, denominator);
+	return BigFraction(numerator * rhs.denominator - rhs.numerator * denominator, denominator * rhs.denominator);
+}
+
+BigFraction BigFraction::operator-(const BigFraction& rhs) && {
+	return std::move(*this -= rhs);
+}
+
+BigFraction operator-(const BigFraction& lhs, const long long rhs) {
+	return BigFraction(lhs) - rhs;
+}
+
+BigFraction operator-(BigFraction&& lhs, const long long rhs) {
+	return std::move(lhs -= rhs);
+}
+
+BigFraction operator-(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs) - rhs;
+}
+
+/**
+*	Replaces this fraction with the difference between this one and the provided one, in place.
+*
+*	@param rhs fraction to be subtracted from this one
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator-=(const BigFraction& rhs) {
+	if (denominator == rhs.denominator) {
+		numerator -= rhs.numerator;
+	}
+	else {
+		numerator *= rhs.denominator;
+		numerator -= rhs.numerator * denominator;
+		denominator *= rhs.denominator;
+	}
+	reduce();
+	return *this;
+}
+
+/**
+*	Subtracts an integer from the provided fraction in place, which like adding one needs no reducing.
+*
+*	@param lhs fraction to be subtracted from
+*	@param rhs integer to be subtracted
+*	@return a reference to lhs, for chaining
+*/
+BigFraction& operator-=(BigFraction& lhs, const long long rhs) {
+	lhs.numerator -= lhs.denominator * rhs;
+	return lhs;
+}
+
+/**
+*	Multiplies this fraction by the provided fraction and returns result as a new BigFraction.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return a new fraction which is the product of this fraction and the one provided
+*/
+BigFraction BigFraction::operator*(const BigFraction& rhs) const& {
+	return BigFraction(numerator * rhs.numerator, denominator * rhs.denominator);
+}
+
+BigFraction BigFraction::operator*(const BigFraction& rhs) && {
+	return std::move(*this *= rhs);
+}
+
+BigFraction operator*(const BigFraction& lhs, BigFraction&& rhs) {
+	return std::move(rhs *= lhs);
+}
+
+BigFraction operator*(BigFraction&& lhs, BigFraction&& rhs) {
+	return std::move(lhs *= rhs);
+}
+
+BigFraction operator*(const BigFraction& lhs, const long long rhs) {
+	return BigFraction(lhs.numerator * rhs, lhs.denominator);
+}
+
+BigFraction operator*(BigFraction&& lhs, const long long rhs) {
+	return std::move(lhs *= rhs);
+}
+
+BigFraction operator*(const long long lhs, const BigFraction& rhs) {
+	return rhs * lhs;
+}
+
+BigFraction operator*(const long long lhs, BigFraction&& rhs) {
+	return std::move(rhs *= lhs);
+}
+
+/**
+*	Replaces this fraction with the product of this one and the provided one, in place.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator*=(const BigFraction& rhs) {
+	numerator *= rhs.numerator;
+	denominator *= rhs.denominator;
+	reduce();
+	return *this;
+}
+
+/**
+*	Replaces this fraction with the product of this one and the provided integer, in place.
+*
+*	@param rhs integer to multiply this fraction by
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator*=(const long long rhs) {
+	numerator *= rhs;
+	reduce();
+	return *this;
+}
+
+/**
+*	Divides this fraction by the provided fraction and returns result as a new BigFraction.
+*
+*	@param rhs fraction to be divided into this one
+*	@return a new fraction which is this fraction divided by the one provided
+*/
+BigFraction BigFraction::operator/(const BigFraction& rhs) const& {
+	return BigFraction(numerator * rhs.denominator, denominator * rhs.numerator);
+}
+
+BigFraction BigFraction::operator/(const BigFraction& rhs) && {
+	return std::move(*this /= rhs);
+}
+
+BigFraction operator/(const BigFraction& lhs, const long long rhs) {
+	return BigFraction(lhs.numerator, lhs.denominator * rhs);
+}
+
+BigFraction operator/(BigFraction&& lhs, const long long rhs) {
+	return std::move(lhs /= rhs);
+}
+
+BigFraction operator/(const long long lhs, const BigFraction& rhs) {
+	return BigFraction(lhs) / rhs;
+}
+
+/**
+*	Replaces this fraction with this one divided by the provided one, in place.
+*
+*	@param rhs fraction to be divided into this one
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator/=(const BigFraction& rhs) {
+	if (this == &rhs) {
+		// The numerator is overwritten before it would be read as the divisor
+		*this = *this / rhs;
+		return *this;
+	}
+	numerator *= rhs.denominator;
+	denominator *= rhs.numerator;
+	reduce();
+	return *this;
+}
+
+/**
+*	Replaces this fraction with this one divided by the provided integer, in place.
+*
+*	@param rhs integer to divide this fraction by
+*	@return a reference to this fraction, for chaining
+*/
+BigFraction& BigFraction::operator/=(const long long rhs) {
+	denominator *= rhs;
+	reduce();
+	return *this;
+}
+
+/**
+*	Overrides the stream insertion operator by inserting a string representation of the fraction and returning the stream.
+*
+*	@param os outputstream that the fraction string is written to
+*	@param rhs fraction whos string representation is inserted into the outputstream
+*	@return the provided outputstream after inserting into it
+*/
+std::ostream& operator <<(std::ostream& os, const BigFraction& rhs) {
+	os << rhs.numerator << "/" << rhs.denominator;
+	return os;
+}
+
+/**
+*	Overrides the stream extraction operator by extracting a string representation of the fraction from it, assigning these values to a fraction and returning the stream.
+*
+*	@param is inputstream that the fraction string is extracted from
+*	@param rhs fraction whos values are set from the contents of the provided fraction
+*	@return the provided inputstream after extracting from it
+*/
+std::istream& operator >>(std::istream& is, BigFraction& rhs) {
+	char L;
+	is >> rhs.numerator >> L >> rhs.denominator >> L;
+	rhs.reduce();
+	return is;
+}
+
+/**
+*	Puts this fraction into its simplest form and moves the sign onto the numerator.
+*	While both parts are inline the work is done on long longs with the configured gcd kernel, without touching BigInteger.
+*/
+void BigFraction::reduce() {
+	if (isSmall()) {
+		long long num = numerator.toSmall();
+		long long den = denominator.toSmall();
+		long long divisor = static_cast<long long>(gcd::compute(num, den));
+		// A gcd of 2^63 wraps to LLONG_MIN, and LLONG_MIN cannot be negated: both are left to the general path
+		if (divisor > 0 && num != LLONG_MIN && den != LLONG_MIN) {
+			num /= divisor;
+			den /= divisor;
+			if (den < 0) {
+				den = -den;
+				num = -num;
+			}
+			numerator = BigInteger(num);
+			denominator = BigInteger(den);
+			return;
+		}
+	}
+
+	BigInteger divisor = BigInteger::gcd(numerator, denominator);
+	if (divisor.sign() != 0) {
+		numerator = numerator / divisor;
+		denominator = denominator / divisor;
+	}
+	if (denominator.sign() < 0) {
+		denominator = -denominator;
+		numerator = -numerator;
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+/**
+* @file		BigFraction.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Arbitrary-precision mathematical fraction with the same operators as Fraction, for long exact computations
+*  that would overflow a machine word. Small numerators and denominators stay inline (see BigInteger).
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "BigInteger.h"
+#include "Fraction.h"
+#include <iostream>
+#include <type_traits>
+
+class BigFraction
+{
+
+public:
+	explicit BigFraction();
+	BigFraction(long long numerator);
+	BigFraction(long long numerator, long long denominator);
+	BigFraction(BigInteger numerator, BigInteger denominator);
+	template <typename IntT> BigFraction(const BasicFraction<IntT>& value);
+
+	const BigInteger& getNumerator() const;
+	const BigInteger& getDenominator() const;
+	bool isSmall() const;
+
+	// Equality Operator Overloads
+	bool operator==(const BigFraction& rhs) const;
+	bool operator!=(const BigFraction& rhs) const;
+
+	// Comparison Operator Overloads
+	int compare(const BigFraction& rhs) const;
+
+	bool operator<(const BigFraction& rhs) const;
+	friend bool operator<(const BigFraction& lhs, const long long rhs);
+	friend bool operator<(const long long lhs, const BigFraction& rhs);
+
+	bool operator<=(const BigFraction& rhs) const;
+	friend bool operator<=(const BigFraction& lhs, const long long rhs);
+	friend bool operator<=(const long long lhs, const BigFraction& rhs);
+
+	bool operator>(const BigFraction& rhs) const;
+	friend bool operator>(const BigFraction& lhs, const long long rhs);
+	friend bool operator>(const long long lhs, const BigFraction& rhs);
+
+	bool operator>=(const BigFraction& rhs) const;
+	friend bool operator>=(const BigFraction& lhs, const long long rhs);
+	friend bool operator>=(const long long lhs, const BigFraction& rhs);
+
+	// Arithmetic Operator Overloads. The rvalue overloads build their result in the storage of a temporary operand.
+	BigFraction operator+(const BigFraction& rhs) const&;
+	BigFraction operator+(const BigFraction& rhs) &&;
+	friend BigFraction operator+(const BigFraction& lhs, BigFraction&& rhs);
+	friend BigFraction operator+(BigFraction&& lhs, BigFraction&& rhs);
+	friend BigFraction operator+(const BigFraction& lhs, const long long rhs);
+	friend BigFraction operator+(BigFraction&& lhs, const long long rhs);
+	friend BigFraction operator+(const long long lhs, const BigFraction& rhs);
+	friend BigFraction operator+(const long long lhs, BigFraction&& rhs);
+
+	BigFraction& operator+=(const BigFraction& rhs);
+	friend BigFraction& operator+=(BigFraction& lhs, const long long rhs);
+
+	BigFraction operator-(const BigFraction& rhs) const&;
+	BigFraction operator-(const BigFraction& rhs) &&;
+	friend BigFraction operator-(const BigFraction& lhs, const long long rhs);
+	friend BigFraction operator-(BigFraction&& lhs, const long long rhs);
+	friend BigFraction operator-(const long long lhs, const BigFraction& rhs);
+
+	BigFraction& operator-=(const BigFraction& rhs);
+	friend BigFraction& operator-=(BigFraction& lhs, const long long rhs);
+
+	BigFraction operator*(const BigFraction& rhs) const&;
+	BigFraction operator*(const BigFraction& rhs) &&;
+	friend BigFraction operator*(const BigFraction& lhs, BigFraction&& rhs);
+	friend BigFraction operator*(BigFraction&& lhs, BigFraction&& rhs);
+	friend BigFraction operator*(const BigFraction& lhs, const long long rhs);
+	friend BigFraction operator*(BigFraction&& lhs, const long long rhs);
+	friend BigFraction operator*(const long long lhs, const BigFraction& rhs);
+	friend BigFraction operator*(const long long lhs, BigFraction&& rhs);
+	BigFraction& operator*=(const BigFraction& rhs);
+	BigFraction& operator*=(const long long rhs);
+
+	BigFraction operator/(const BigFraction& rhs) const&;
+	BigFraction operator/(const BigFraction& rhs) &&;
+	friend BigFraction operator/(const BigFraction& lhs, const long long rhs);
+	friend BigFraction operator/(BigFraction&& lhs, const long long rhs);
+	friend BigFraction operator/(const long long lhs, const BigFraction& rhs);
+	BigFraction& operator/=(const BigFraction& rhs);
+	BigFraction& operator/=(const long long rhs);
+
+	// Stream Manipulation Operator Overloads
+	friend std::ostream& operator <<(std::ostream&, const BigFraction&);
+	friend std::istream& operator >>(std::istream&, BigFraction&);
+
+private:
+	BigInteger numerator;
+	BigInteger denominator;
+	void reduce();
+
+};
+
+/**
+*	Constructs an arbitrary-precision copy of a fixed width fraction.
+*
+*	@param value the fraction to copy, with an integer type no wider than long long
+*/
+template <typename IntT>
+BigFraction::BigFraction(const BasicFraction<IntT>& value)
+	: numerator(static_cast<long long>(value.getNumerator())), denominator(static_cast<long long>(value.getDenominator())) {
+	static_assert(sizeof(IntT) <= sizeof(long long), "BigFraction can only be built from fractions no wider than long long");
+}
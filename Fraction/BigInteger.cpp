@@ -0,0 +1,784 @@
+/**
+* @file		BigInteger.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Arbitrary-precision signed integer used by BigFraction. Values that fit into a long long are kept
+*  inline and computed with machine arithmetic; only a result that overflows spills into a vector of 32-bit limbs.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "BigInteger.h"
+#include "Gcd.h"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+	using Limbs = std::vector<std::uint32_t>;
+
+	constexpr unsigned long long kMostNegativeMagnitude = 1ULL << 63;
+
+	/**
+	*	Removes leading zero limbs, so that zero is the empty vector.
+	*/
+	void trim(Limbs& limbs) {
+		while (!limbs.empty() && limbs.back() == 0)
+			limbs.pop_back();
+	}
+
+	Limbs toLimbs(unsigned long long value) {
+		Limbs limbs;
+		while (value != 0) {
+			limbs.push_back(static_cast<std::uint32_t>(value));
+			value >>= 32;
+		}
+		return limbs;
+	}
+
+	int compareMagnitudes(const Limbs& lhs, const Limbs& rhs) {
+		if (lhs.size() != rhs.size())
+			return lhs.size() < rhs.size() ? -1 : 1;
+		for (std::size_t i = lhs.size(); i-- > 0;) {
+			if (lhs[i] != rhs[i])
+				return lhs[i] < rhs[i] ? -1 : 1;
+		}
+		return 0;
+	}
+
+	Limbs addMagnitudes(const Limbs& lhs, const Limbs& rhs) {
+		const Limbs& longer = lhs.size() >= rhs.size() ? lhs : rhs;
+		const Limbs& shorter = lhs.size() >= rhs.size() ? rhs : lhs;
+		Limbs sum(longer.size() + 1);
+		std::uint64_t carry = 0;
+		for (std::size_t i = 0; i < longer.size(); ++i) {
+			carry += std::uint64_t(longer[i]) + (i < shorter.size() ? shorter[i] : 0);
+			sum[i] = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		sum[longer.size()] = static_cast<std::uint32_t>(carry);
+		trim(sum);
+		return sum;
+	}
+
+	/**
+	*	Subtracts magnitudes, lhs must not be smaller than rhs.
+	*/
+	Limbs subtractMagnitudes(const Limbs& lhs, const Limbs& rhs) {
+		Limbs difference(lhs.size());
+		std::int64_t borrow = 0;
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			std::int64_t t = std::int64_t(lhs[i]) - (i < rhs.size() ? rhs[i] : 0) - borrow;
+			borrow = t < 0;
+			difference[i] = static_cast<std::uint32_t>(t);
+		}
+		trim(difference);
+		return difference;
+	}
+
+	/**
+	*	Adds a magnitude into another in place. Grows the storage only when the sum needs another limb.
+	*/
+	void addInto(Limbs& sum, const Limbs& rhs) {
+		if (sum.size() < rhs.size())
+			sum.resize(rhs.size(), 0);
+		std::uint64_t carry = 0;
+		for (std::size_t i = 0; i < sum.size() && (i < rhs.size() || carry != 0); ++i) {
+			carry += std::uint64_t(sum[i]) + (i < rhs.size() ? rhs[i] : 0);
+			sum[i] = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		if (carry != 0)
+			sum.push_back(static_cast<std::uint32_t>(carry));
+	}
+
+	/**
+	*	Subtracts a magnitude from another in place, difference must not be smaller than rhs.
+	*/
+	void subtractFrom(Limbs& difference, const Limbs& rhs) {
+		std::int64_t borrow = 0;
+		for (std::size_t i = 0; i < difference.size() && (i < rhs.size() || borrow != 0); ++i) {
+			std::int64_t t = std::int64_t(difference[i]) - (i < rhs.size() ? rhs[i] : 0) - borrow;
+			borrow = t < 0;
+			difference[i] = static_cast<std::uint32_t>(t);
+		}
+		trim(difference);
+	}
+
+	/**
+	*	Replaces a magnitude in place by its difference from a larger one, rhs - difference.
+	*/
+	void subtractInto(Limbs& difference, const Limbs& rhs) {
+		difference.resize(rhs.size(), 0);
+		std::int64_t borrow = 0;
+		for (std::size_t i = 0; i < rhs.size(); ++i) {
+			std::int64_t t = std::int64_t(rhs[i]) - difference[i] - borrow;
+			borrow = t < 0;
+			difference[i] = static_cast<std::uint32_t>(t);
+		}
+		trim(difference);
+	}
+
+	Limbs multiplyMagnitudes(const Limbs& lhs, const Limbs& rhs) {
+		if (lhs.empty() || rhs.empty())
+			return Limbs();
+		Limbs product(lhs.size() + rhs.size());
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			std::uint64_t carry = 0;
+			for (std::size_t j = 0; j < rhs.size(); ++j) {
+				carry += std::uint64_t(lhs[i]) * rhs[j] + product[i + j];
+				product[i + j] = static_cast<std::uint32_t>(carry);
+				carry >>= 32;
+			}
+			product[i + rhs.size()] = static_cast<std::uint32_t>(carry);
+		}
+		trim(product);
+		return product;
+	}
+
+	/**
+	*	Divides a magnitude in place by a single limb and returns the remainder.
+	*/
+	std::uint32_t divideBySmall(Limbs& limbs, std::uint32_t divisor) {
+		std::uint64_t remainder = 0;
+		for (std::size_t i = limbs.size(); i-- > 0;) {
+			std::uint64_t current = (remainder << 32) | limbs[i];
+			limbs[i] = static_cast<std::uint32_t>(current / divisor);
+			remainder = current % divisor;
+		}
+		trim(limbs);
+		return static_cast<std::uint32_t>(remainder);
+	}
+
+	/**
+	*	Multiplies a magnitude in place by a single limb and adds a single limb to it.
+	*/
+	void multiplyAddSmall(Limbs& limbs, std::uint32_t factor, std::uint32_t addend) {
+		std::uint64_t carry = addend;
+		for (std::uint32_t& limb : limbs) {
+			carry += std::uint64_t(limb) * factor;
+			limb = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		if (carry != 0)
+			limbs.push_back(static_cast<std::uint32_t>(carry));
+	}
+
+	/**
+	*	Long division of magnitudes (Knuth vol. 2, algorithm D). The divisor must not be zero.
+	*	Every output and the normalised copies u and v are assigned rather than rebuilt, so a caller dividing in a
+	*	loop can pass the same vectors each time and only allocate when they need to grow.
+	*/
+	void divideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder, Limbs& u, Limbs& v) {
+		if (compareMagnitudes(dividend, divisor) < 0) {
+			quotient.clear();
+			remainder = dividend;
+			return;
+		}
+		if (divisor.size() == 1) {
+			quotient = dividend;
+			remainder.assign(1, divideBySmall(quotient, divisor[0]));
+			trim(remainder);
+			return;
+		}
+
+		const std::size_t n = divisor.size();
+		const std::size_t m = dividend.size() - n;
+
+		// Normalise so that the top limb of the divisor has its high bit set, which keeps the quotient estimates within 2 of the truth
+		int shift = 32 - gcd::bitLength(divisor.back());
+		v.assign(n, 0);
+		u.assign(dividend.size() + 1, 0);
+		for (std::size_t i = n; i-- > 0;)
+			v[i] = static_cast<std::uint32_t>((std::uint64_t(divisor[i]) << shift) | (i > 0 && shift > 0 ? divisor[i - 1] >> (32 - shift) : 0));
+		u[dividend.size()] = shift > 0 ? dividend.back() >> (32 - shift) : 0;
+		for (std::size_t i = dividend.size(); i-- > 0;)
+			u[i] = static_cast<std::uint32_t>((std::uint64_t(dividend[i]) << shift) | (i > 0 && shift > 0 ? dividend[i - 1] >> (32 - shift) : 0));
+
+		const std::uint64_t base = 1ULL << 32;
+		quotient.assign(m + 1, 0);
+		for (std::size_t j = m + 1; j-- > 0;) {
+			std::uint64_t numerator = (std::uint64_t(u[j + n]) << 32) | u[j + n - 1];
+			std::uint64_t estimate = numerator / v[n - 1];
+			std::uint64_t rest = numerator % v[n - 1];
+			while (estimate >= base || estimate * v[n - 2] > ((rest << 32) | u[j + n - 2])) {
+				--estimate;
+				rest += v[n - 1];
+				if (rest >= base)
+					break;
+			}
+
+			// Multiply and subtract
+			std::int64_t borrow = 0;
+			std::int64_t t;
+			for (std::size_t i = 0; i < n; ++i) {
+				std::uint64_t product = estimate * v[i];
+				t = std::int64_t(u[i + j]) - borrow - std::int64_t(product & 0xFFFFFFFFu);
+				u[i + j] = static_cast<std::uint32_t>(t);
+				borrow = std::int64_t(product >> 32) - (t >> 32);
+			}
+			t = std::int64_t(u[j + n]) - borrow;
+			u[j + n] = static_cast<std::uint32_t>(t);
+
+			quotient[j] = static_cast<std::uint32_t>(estimate);
+			if (t < 0) {
+				// The estimate was one too large, add the divisor back
+				--quotient[j];
+				std::uint64_t carry = 0;
+				for (std::size_t i = 0; i < n; ++i) {
+					carry += std::uint64_t(u[i + j]) + v[i];
+					u[i + j] = static_cast<std::uint32_t>(carry);
+					carry >>= 32;
+				}
+				u[j + n] = static_cast<std::uint32_t>(u[j + n] + carry);
+			}
+		}
+
+		remainder.assign(n, 0);
+		for (std::size_t i = 0; i < n; ++i)
+			remainder[i] = static_cast<std::uint32_t>((u[i] >> shift) | (shift > 0 ? std::uint64_t(u[i + 1]) << (32 - shift) : 0));
+		trim(quotient);
+		trim(remainder);
+	}
+
+	void divideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder) {
+		Limbs u, v;
+		divideMagnitudes(dividend, divisor, quotient, remainder, u, v);
+	}
+
+	bool addOverflows(long long lhs, long long rhs, long long& result) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_add_overflow(lhs, rhs, &result);
+#else
+		if ((rhs > 0 && lhs > LLONG_MAX - rhs) || (rhs < 0 && lhs < LLONG_MIN - rhs))
+			return true;
+		result = lhs + rhs;
+		return false;
+#endif
+	}
+
+	bool subtractOverflows(long long lhs, long long rhs, long long& result) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+		if ((rhs < 0 && lhs > LLONG_MAX + rhs) || (rhs > 0 && lhs < LLONG_MIN + rhs))
+			return true;
+		result = lhs - rhs;
+		return false;
+#endif
+	}
+
+	bool multiplyOverflows(long long lhs, long long rhs, long long& result) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+		if (lhs == 0 || rhs == 0) {
+			result = 0;
+			return false;
+		}
+		bool negative = (lhs < 0) != (rhs < 0);
+		unsigned long long lhsMagnitude = gcd::magnitude(lhs), rhsMagnitude = gcd::magnitude(rhs);
+		unsigned long long limit = negative ? kMostNegativeMagnitude : kMostNegativeMagnitude - 1;
+		if (lhsMagnitude > limit / rhsMagnitude)
+			return true;
+		unsigned long long product = lhsMagnitude * rhsMagnitude;
+		result = negative ? -static_cast<long long>(product - 1) - 1 : static_cast<long long>(product);
+		return false;
+#endif
+	}
+}
+
+/**
+*	Constructs a big integer with value 0.
+*/
+BigInteger::BigInteger() : BigInteger(0) {
+}
+
+/**
+*	Constructs a big integer holding the provided value inline.
+*
+*	@param value the value of the integer
+*/
+BigInteger::BigInteger(long long value) {
+	small = value;
+	negative = value < 0;
+}
+
+/**
+*	Tells whether the value is held inline, which is the case exactly when it fits into a long long.
+*
+*	@return true if the value fits into a long long
+*/
+bool BigInteger::isSmall() const {
+	return limbs.empty();
+}
+
+/**
+*	Returns the value as a long long. Only meaningful when isSmall() is true.
+*
+*	@return the inline value
+*/
+long long BigInteger::toSmall() const {
+	return small;
+}
+
+/**
+*	Returns the sign of the value.
+*
+*	@return -1, 0 or 1
+*/
+int BigInteger::sign() const {
+	if (isSmall())
+		return (small > 0) - (small < 0);
+	return negative ? -1 : 1;
+}
+
+/**
+*	Returns the decimal representation of the value.
+*
+*	@return the value as a string of decimal digits, with a leading '-' when negative
+*/
+std::string BigInteger::toString() const {
+	if (isSmall())
+		return std::to_string(small);
+
+	// Peel off nine decimal digits at a time
+	Limbs rest = limbs;
+	std::vector<std::uint32_t> chunks;
+	while (!rest.empty())
+		chunks.push_back(divideBySmall(rest, 1000000000u));
+
+	std::string digits = negative ? "-" : "";
+	digits += std::to_string(chunks.back());
+	for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+		std::string chunk = std::to_string(chunks[i]);
+		digits.append(9 - chunk.size(), '0');
+		digits += chunk;
+	}
+	return digits;
+}
+
+/**
+*	Overrides equality operator. Values are stored canonically (inline whenever they fit), so the representations can be compared directly.
+*
+*	@param rhs other integer to be compaired with this one
+*	@return boolean true if the integers are equal, false if not
+*/
+bool BigInteger::operator==(const BigInteger& rhs) const {
+	if (isSmall() || rhs.isSmall())
+		return isSmall() && rhs.isSmall() && small == rhs.small;
+	return negative == rhs.negative && limbs == rhs.limbs;
+}
+
+/**
+*	Overrides inequality operator.
+*
+*	@param rhs other integer to be compaired with this one
+*	@return boolean false if the integers are equal, true if not
+*/
+bool BigInteger::operator!=(const BigInteger& rhs) const {
+	return !((*this) == rhs);
+}
+
+/**
+*	Compares this integer with the provided one.
+*
+*	@param rhs other integer to be compaired with this one
+*	@return -1 if this integer is smaller, 0 if they are equal, 1 if this integer is larger
+*/
+int BigInteger::compare(const BigInteger& rhs) const {
+	if (isSmall() && rhs.isSmall())
+		return (small > rhs.small) - (small < rhs.small);
+
+	int lhsSign = sign();
+	int rhsSign = rhs.sign();
+	if (lhsSign != rhsSign)
+		return lhsSign < rhsSign ? -1 : 1;
+
+	// Same sign, at least one of them too large to be inline
+	Limbs lhsScratch, rhsScratch;
+	int order = compareMagnitudes(magnitude(lhsScratch), rhs.magnitude(rhsScratch));
+	return lhsSign < 0 ? -order : order;
+}
+
+bool BigInteger::operator<(const BigInteger& rhs) const {
+	return compare(rhs) < 0;
+}
+
+bool BigInteger::operator<=(const BigInteger& rhs) const {
+	return compare(rhs) <= 0;
+}
+
+bool BigInteger::operator>(const BigInteger& rhs) const {
+	return compare(rhs) > 0;
+}
+
+bool BigInteger::operator>=(const BigInteger& rhs) const {
+	return compare(rhs) >= 0;
+}
+
+/**
+*	Returns the negation of this integer.
+*
+*	@return a new integer with the opposite sign
+*/
+BigInteger BigInteger::operator-() const {
+	if (isSmall() && small != LLONG_MIN)
+		return BigInteger(-small);
+	Limbs scratch;
+	return fromMagnitude(sign() > 0, magnitude(scratch));
+}
+
+/**
+*	Returns the sum of this integer and the provided one. Stays inline unless the sum overflows a long long.
+*
+*	@param rhs integer to be added to this one
+*	@return the sum as a new integer
+*/
+BigInteger BigInteger::operator+(const BigInteger& rhs) const& {
+	long long result;
+	if (isSmall() && rhs.isSmall() && !addOverflows(small, rhs.small, result))
+		return BigInteger(result);
+	return sum(*this, rhs, false);
+}
+
+/**
+*	Returns the sum of this temporary integer and the provided one, built in the temporary's storage.
+*
+*	@param rhs integer to be added to this one
+*	@return the sum, moved out of this integer
+*/
+BigInteger BigInteger::operator+(const BigInteger& rhs) && {
+	return std::move(*this += rhs);
+}
+
+/**
+*	Returns the difference between this integer and the provided one. Stays inline unless the difference overflows a long long.
+*
+*	@param rhs integer to be subtracted from this one
+*	@return the difference as a new integer
+*/
+BigInteger BigInteger::operator-(const BigInteger& rhs) const& {
+	long long result;
+	if (isSmall() && rhs.isSmall() && !subtractOverflows(small, rhs.small, result))
+		return BigInteger(result);
+	return sum(*this, rhs, true);
+}
+
+/**
+*	Returns the difference between this temporary integer and the provided one, built in the temporary's storage.
+*
+*	@param rhs integer to be subtracted from this one
+*	@return the difference, moved out of this integer
+*/
+BigInteger BigInteger::operator-(const BigInteger& rhs) && {
+	return std::move(*this -= rhs);
+}
+
+/**
+*	Returns the product of this integer and the provided one. Stays inline unless the product overflows a long long.
+*
+*	@param rhs integer to be multiplied by this one
+*	@return the product as a new integer
+*/
+BigInteger BigInteger::operator*(const BigInteger& rhs) const {
+	long long result;
+	if (isSmall() && rhs.isSmall() && !multiplyOverflows(small, rhs.small, result))
+		return BigInteger(result);
+	Limbs lhsScratch, rhsScratch;
+	return fromMagnitude((sign() < 0) != (rhs.sign() < 0), multiplyMagnitudes(magnitude(lhsScratch), rhs.magnitude(rhsScratch)));
+}
+
+/**
+*	Returns the quotient of this integer and the provided one, rounded towards zero like the built-in division.
+*
+*	@param rhs non-zero integer to divide this one by
+*	@return the quotient as a new integer
+*/
+BigInteger BigInteger::operator/(const BigInteger& rhs) const {
+	BigInteger quotient, remainder;
+	divMod(*this, rhs, quotient, remainder);
+	return quotient;
+}
+
+/**
+*	Returns the remainder of dividing this integer by the provided one, with the sign of this integer like the built-in remainder.
+*
+*	@param rhs non-zero integer to divide this one by
+*	@return the remainder as a new integer
+*/
+BigInteger BigInteger::operator%(const BigInteger& rhs) const {
+	BigInteger quotient, remainder;
+	divMod(*this, rhs, quotient, remainder);
+	return remainder;
+}
+
+/**
+*	Adds the provided integer to this one in place.
+*
+*	@param rhs integer to be added to this one
+*	@return a reference to this integer
+*/
+BigInteger& BigInteger::operator+=(const BigInteger& rhs) {
+	return accumulate(rhs, false);
+}
+
+/**
+*	Subtracts the provided integer from this one in place.
+*
+*	@param rhs integer to be subtracted from this one
+*	@return a reference to this integer
+*/
+BigInteger& BigInteger::operator-=(const BigInteger& rhs) {
+	return accumulate(rhs, true);
+}
+
+/**
+*	Replaces this integer with its product with the provided one. The long multiplication needs storage of its own,
+*	which is moved in rather than copied.
+*
+*	@param rhs integer to multiply this one by
+*	@return a reference to this integer
+*/
+BigInteger& BigInteger::operator*=(const BigInteger& rhs) {
+	*this = *this * rhs;
+	return *this;
+}
+
+/**
+*	Divides two integers, rounding the quotient towards zero.
+*
+*	@param lhs the dividend
+*	@param rhs the non-zero divisor
+*	@param quotient receives lhs / rhs
+*	@param remainder receives lhs % rhs, which has the sign of lhs
+*/
+void BigInteger::divMod(const BigInteger& lhs, const BigInteger& rhs, BigInteger& quotient, BigInteger& remainder) {
+	if (rhs.sign() == 0)
+		throw std::domain_error("BigInteger division by zero");
+
+	if (lhs.isSmall() && rhs.isSmall() && !(lhs.small == LLONG_MIN && rhs.small == -1)) {
+		quotient = BigInteger(lhs.small / rhs.small);
+		remainder = BigInteger(lhs.small % rhs.small);
+		return;
+	}
+
+	Limbs quotientMagnitude, remainderMagnitude, lhsScratch, rhsScratch;
+	divideMagnitudes(lhs.magnitude(lhsScratch), rhs.magnitude(rhsScratch), quotientMagnitude, remainderMagnitude);
+	quotient = fromMagnitude((lhs.sign() < 0) != (rhs.sign() < 0), std::move(quotientMagnitude));
+	remainder = fromMagnitude(lhs.sign() < 0, std::move(remainderMagnitude));
+}
+
+/**
+*	Finds the non-negative greatest common divisor of two integers. Runs Euclid on the limbs until both values fit
+*	into 64 bits, then hands over to the binary gcd kernel.
+*
+*	@param lhs first integer
+*	@param rhs second integer
+*	@return the greatest common divisor (0 only when both integers are 0)
+*/
+BigInteger BigInteger::gcd(const BigInteger& lhs, const BigInteger& rhs) {
+	if (lhs.isSmall() && rhs.isSmall()) {
+		unsigned long long divisor = gcd::compute(lhs.small, rhs.small);
+		return divisor < kMostNegativeMagnitude ? BigInteger(static_cast<long long>(divisor)) : fromMagnitude(false, toLimbs(divisor));
+	}
+
+	Limbs a, b;
+	a = lhs.magnitude(a);
+	b = rhs.magnitude(b);
+	// The four work vectors rotate through the loop, so that the buffers are reused instead of allocated per step
+	Limbs quotient, remainder, u, v;
+	while (a.size() > 2 || b.size() > 2) {
+		if (b.empty())
+			return fromMagnitude(false, std::move(a));
+		divideMagnitudes(a, b, quotient, remainder, u, v);
+		std::swap(a, b);
+		std::swap(b, remainder);
+	}
+
+	auto toWord = [](const Limbs& limbs) {
+		std::uint64_t word = 0;
+		for (std::size_t i = limbs.size(); i-- > 0;)
+			word = (word << 32) | limbs[i];
+		return word;
+	};
+	return fromMagnitude(false, toLimbs(gcd::binary(toWord(a), toWord(b))));
+}
+
+/**
+*	Overrides the stream insertion operator by inserting the decimal representation of the integer.
+*
+*	@param os outputstream that the integer is written to
+*	@param rhs integer to be written
+*	@return the provided outputstream after inserting into it
+*/
+std::ostream& operator <<(std::ostream& os, const BigInteger& rhs) {
+	if (rhs.isSmall())
+		os << rhs.small;
+	else
+		os << rhs.toString();
+	return os;
+}
+
+/**
+*	Overrides the stream extraction operator by reading an optionally signed run of decimal digits.
+*
+*	@param is inputstream that the integer is read from
+*	@param rhs integer that receives the value read
+*	@return the provided inputstream after extracting from it
+*/
+std::istream& operator >>(std::istream& is, BigInteger& rhs) {
+	char sign = 0;
+	if (!(is >> sign))
+		return is;
+	bool negative = sign == '-';
+	if (sign != '-' && sign != '+')
+		is.putback(sign);
+
+	Limbs magnitude;
+	std::uint32_t chunk = 0, scale = 1;
+	bool anyDigits = false;
+	while (std::isdigit(is.peek())) {
+		chunk = chunk * 10 + static_cast<std::uint32_t>(is.get() - '0');
+		scale *= 10;
+		anyDigits = true;
+		if (scale == 1000000000u) {
+			multiplyAddSmall(magnitude, scale, chunk);
+			chunk = 0;
+			scale = 1;
+		}
+	}
+	if (!anyDigits) {
+		is.setstate(std::ios::failbit);
+		return is;
+	}
+	multiplyAddSmall(magnitude, scale, chunk);
+	trim(magnitude);
+	rhs = BigInteger::fromMagnitude(negative, std::move(magnitude));
+	return is;
+}
+
+/**
+*	Returns the magnitude of the value as limbs, whichever way it is stored, without copying the limbs of a large value.
+*
+*	@param scratch receives the limbs of an inline value
+*	@return the little-endian limbs of |value|, either this integer's own or scratch
+*/
+const BigInteger::Limbs& BigInteger::magnitude(Limbs& scratch) const {
+	if (!isSmall())
+		return limbs;
+	scratch = toLimbs(gcd::magnitude(small));
+	return scratch;
+}
+
+/**
+*	Adds or subtracts the provided integer in place, working on this integer's own limbs so that a large value
+*	usually keeps its storage.
+*
+*	@param rhs integer to be added or subtracted
+*	@param subtract true to subtract rhs instead of adding it
+*	@return a reference to this integer
+*/
+BigInteger& BigInteger::accumulate(const BigInteger& rhs, bool subtract) {
+	long long result;
+	if (isSmall() && rhs.isSmall() && !(subtract ? subtractOverflows(small, rhs.small, result) : addOverflows(small, rhs.small, result))) {
+		small = result;
+		negative = result < 0;
+		return *this;
+	}
+	if (this == &rhs) {
+		*this = subtract ? BigInteger() : sum(*this, rhs, false);
+		return *this;
+	}
+
+	bool lhsNegative = sign() < 0;
+	bool rhsNegative = (rhs.sign() < 0) != subtract;
+	Limbs scratch;
+	const Limbs& rhsMagnitude = rhs.magnitude(scratch);
+	if (isSmall())
+		limbs = toLimbs(gcd::magnitude(small));
+
+	if (lhsNegative == rhsNegative) {
+		addInto(limbs, rhsMagnitude);
+	}
+	else if (compareMagnitudes(limbs, rhsMagnitude) >= 0) {
+		subtractFrom(limbs, rhsMagnitude);
+	}
+	else {
+		subtractInto(limbs, rhsMagnitude);
+		lhsNegative = rhsNegative;
+	}
+	*this = fromMagnitude(lhsNegative, std::move(limbs));
+	return *this;
+}
+
+/**
+*	Adds or subtracts two integers into new storage, reading both magnitudes in place.
+*
+*	@param lhs first integer
+*	@param rhs second integer
+*	@param subtract true for lhs - rhs, false for lhs + rhs
+*	@return the sum or difference as a new integer
+*/
+BigInteger BigInteger::sum(const BigInteger& lhs, const BigInteger& rhs, bool subtract) {
+	bool lhsNegative = lhs.sign() < 0;
+	bool rhsNegative = (rhs.sign() < 0) != subtract;
+	Limbs lhsScratch, rhsScratch;
+	const Limbs& lhsMagnitude = lhs.magnitude(lhsScratch);
+	const Limbs& rhsMagnitude = rhs.magnitude(rhsScratch);
+	if (lhsNegative == rhsNegative)
+		return fromMagnitude(lhsNegative, addMagnitudes(lhsMagnitude, rhsMagnitude));
+	if (compareMagnitudes(lhsMagnitude, rhsMagnitude) >= 0)
+		return fromMagnitude(lhsNegative, subtractMagnitudes(lhsMagnitude, rhsMagnitude));
+	return fromMagnitude(rhsNegative, subtractMagnitudes(rhsMagnitude, lhsMagnitude));
+}
+
+/**
+*	Builds an integer from a sign and a magnitude, keeping it inline whenever it fits into a long long.
+*
+*	@param negative true for a negative value (ignored for zero)
+*	@param magnitude little-endian limbs of |value|
+*	@return the canonical integer
+*/
+BigInteger BigInteger::fromMagnitude(bool negative, Limbs magnitude) {
+	trim(magnitude);
+	if (magnitude.size() <= 2) {
+		unsigned long long value = magnitude.empty() ? 0 : magnitude[0];
+		if (magnitude.size() == 2)
+			value |= static_cast<unsigned long long>(magnitude[1]) << 32;
+		if (!negative && value < kMostNegativeMagnitude)
+			return BigInteger(static_cast<long long>(value));
+		if (negative && value <= kMostNegativeMagnitude)
+			return BigInteger(value == 0 ? 0 : -static_cast<long long>(value - 1) - 1);
+	}
+
+	BigInteger result;
+	result.negative = negative;
+	result.limbs = std::move(magnitude);
+	return result;
+}
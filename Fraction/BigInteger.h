@@ -0,0 +1,98 @@
+#pragma once
+/**
+* @file		BigInteger.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Arbitrary-precision signed integer used by BigFraction. Values that fit into a long long are kept
+*  inline and computed with machine arithmetic; only a result that overflows spills into a vector of 32-bit limbs.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class BigInteger
+{
+
+public:
+	BigInteger();
+	BigInteger(long long value);
+
+	bool isSmall() const;
+	long long toSmall() const;
+	int sign() const;
+	std::string toString() const;
+
+	// Equality Operator Overloads
+	bool operator==(const BigInteger& rhs) const;
+	bool operator!=(const BigInteger& rhs) const;
+
+	// Comparison Operator Overloads
+	int compare(const BigInteger& rhs) const;
+	bool operator<(const BigInteger& rhs) const;
+	bool operator<=(const BigInteger& rhs) const;
+	bool operator>(const BigInteger& rhs) const;
+	bool operator>=(const BigInteger& rhs) const;
+
+	// Arithmetic Operator Overloads
+	BigInteger operator-() const;
+	BigInteger operator+(const BigInteger& rhs) const&;
+	BigInteger operator+(const BigInteger& rhs) &&;
+	BigInteger operator-(const BigInteger& rhs) const&;
+	BigInteger operator-(const BigInteger& rhs) &&;
+	BigInteger operator*(const BigInteger& rhs) const;
+	BigInteger operator/(const BigInteger& rhs) const;
+	BigInteger operator%(const BigInteger& rhs) const;
+
+	// Compound Assignment Operator Overloads, which reuse this integer's storage where they can
+	BigInteger& operator+=(const BigInteger& rhs);
+	BigInteger& operator-=(const BigInteger& rhs);
+	BigInteger& operator*=(const BigInteger& rhs);
+
+	static void divMod(const BigInteger& lhs, const BigInteger& rhs, BigInteger& quotient, BigInteger& remainder);
+	static BigInteger gcd(const BigInteger& lhs, const BigInteger& rhs);
+
+	// Stream Manipulation Operator Overloads
+	friend std::ostream& operator <<(std::ostream&, const BigInteger&);
+	friend std::istream& operator >>(std::istream&, BigInteger&);
+
+private:
+	using Limbs = std::vector<std::uint32_t>;
+
+	// Inline value, used whenever limbs is empty
+	long long small;
+	// Sign and little-endian magnitude of values that do not fit into a long long
+	bool negative;
+	Limbs limbs;
+
+	const Limbs& magnitude(Limbs& scratch) const;
+	BigInteger& accumulate(const BigInteger& rhs, bool subtract);
+	static BigInteger sum(const BigInteger& lhs, const BigInteger& rhs, bool subtract);
+	static BigInteger fromMagnitude(bool negative, Limbs magnitude);
+
+};
@@ -0,0 +1,184 @@
+#pragma once
+/**
+* @file		CheckedFraction.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Fractions whose arithmetic detects overflow instead of silently wrapping, with a policy choosing whether
+*  an overflowing result throws, saturates or is promoted to a BigFraction.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "BigFraction.h"
+#include "Fraction.h"
+#include <iostream>
+#include <type_traits>
+
+// Keeps the rarely taken overflow paths out of line, so the paths that fit stay small
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FRACTION_NOINLINE __declspec(noinline)
+#else
+#define FRACTION_NOINLINE __attribute__((noinline))
+#endif
+
+namespace checked {
+	/**
+	*	Overflow detecting integer arithmetic. Each function stores the wrapped result and returns true if it overflowed,
+	*	like the GCC and Clang builtins it maps onto.
+	*/
+	template <typename IntT> bool addOverflows(IntT lhs, IntT rhs, IntT& result);
+	template <typename IntT> bool subtractOverflows(IntT lhs, IntT rhs, IntT& result);
+	template <typename IntT> bool multiplyOverflows(IntT lhs, IntT rhs, IntT& result);
+
+	template <typename IntT> bool fits(const BigInteger& value);
+}
+
+/**
+*	Overflow policy that throws std::overflow_error when the exact result does not fit.
+*/
+struct ThrowOnOverflow
+{
+	template <typename IntT> using Result = BasicFraction<IntT>;
+	template <typename IntT> static Result<IntT> overflow(const BigFraction& exact);
+};
+
+/**
+*	Overflow policy that clamps results beyond the integer range to +-max, and rounds results that are in range but
+*	need too large a denominator to the nearest fraction with the largest denominator that keeps the numerator in range.
+*/
+struct SaturateOnOverflow
+{
+	template <typename IntT> using Result = BasicFraction<IntT>;
+	template <typename IntT> static Result<IntT> overflow(const BigFraction& exact);
+};
+
+/**
+*	Overflow policy that returns every result as a BigFraction, so that nothing is ever lost.
+*/
+struct PromoteOnOverflow
+{
+	template <typename IntT> using Result = BigFraction;
+	template <typename IntT> static Result<IntT> overflow(const BigFraction& exact);
+};
+
+/**
+*	A fraction whose arithmetic never silently overflows. When IntT has a native wider type of at most 64 bits, results
+*	are computed exactly in it as Fraction does, and checking costs two comparisons. Wider types cross-reduce
+*	their operands before multiplying and use overflow checking instructions in IntT itself, which avoids the
+*	128-bit arithmetic the unchecked operators need. Only a real overflow falls back to BigFraction, handing the exact
+*	result to the policy.
+*/
+template <typename IntT, typename OverflowPolicy = ThrowOnOverflow>
+class BasicCheckedFraction
+{
+	static_assert(sizeof(IntT) <= sizeof(long long), "overflowing results are recomputed in BigFraction, which holds long long operands");
+
+public:
+	using Integer = IntT;
+	using WideInteger = typename BasicFraction<IntT>::WideInteger;
+	using Policy = OverflowPolicy;
+	// Policies that keep IntT stay checked, promoting policies return their own type
+	using Result = std::conditional_t<std::is_same<typename OverflowPolicy::template Result<IntT>, BasicFraction<IntT>>::value,
+		BasicCheckedFraction, typename OverflowPolicy::template Result<IntT>>;
+
+	explicit BasicCheckedFraction();
+	BasicCheckedFraction(IntT numerator);
+	BasicCheckedFraction(IntT numerator, IntT denominator);
+	BasicCheckedFraction(const BasicFraction<IntT>& fraction);
+
+	const BasicFraction<IntT>& toFraction() const;
+	IntT getNumerator() const;
+	IntT getDenominator() const;
+
+	// Equality and Comparison Operator Overloads, exact and never overflowing
+	bool operator==(const BasicCheckedFraction& rhs) const;
+	bool operator!=(const BasicCheckedFraction& rhs) const;
+	int compare(const BasicCheckedFraction& rhs) const;
+	bool operator<(const BasicCheckedFraction& rhs) const;
+	bool operator<=(const BasicCheckedFraction& rhs) const;
+	bool operator>(const BasicCheckedFraction& rhs) const;
+	bool operator>=(const BasicCheckedFraction& rhs) const;
+
+	// Arithmetic Operator Overloads; compound assignment throws std::overflow_error if a promoted result does not fit
+	Result operator+(const BasicCheckedFraction& rhs) const;
+	Result operator+(const IntT rhs) const;
+	template <typename T, typename P> friend typename BasicCheckedFraction<T, P>::Result operator+(const FractionInteger<T> lhs, const BasicCheckedFraction<T, P>& rhs);
+	BasicCheckedFraction& operator+=(const BasicCheckedFraction& rhs);
+	BasicCheckedFraction& operator+=(const IntT rhs);
+
+	Result operator-(const BasicCheckedFraction& rhs) const;
+	Result operator-(const IntT rhs) const;
+	template <typename T, typename P> friend typename BasicCheckedFraction<T, P>::Result operator-(const FractionInteger<T> lhs, const BasicCheckedFraction<T, P>& rhs);
+	BasicCheckedFraction& operator-=(const BasicCheckedFraction& rhs);
+	BasicCheckedFraction& operator-=(const IntT rhs);
+
+	Result operator*(const BasicCheckedFraction& rhs) const;
+	Result operator*(const IntT rhs) const;
+	template <typename T, typename P> friend typename BasicCheckedFraction<T, P>::Result operator*(const FractionInteger<T> lhs, const BasicCheckedFraction<T, P>& rhs);
+	BasicCheckedFraction& operator*=(const BasicCheckedFraction& rhs);
+	BasicCheckedFraction& operator*=(const IntT rhs);
+
+	// Division by zero throws std::domain_error under every policy
+	Result operator/(const BasicCheckedFraction& rhs) const;
+	Result operator/(const IntT rhs) const;
+	template <typename T, typename P> friend typename BasicCheckedFraction<T, P>::Result operator/(const FractionInteger<T> lhs, const BasicCheckedFraction<T, P>& rhs);
+	BasicCheckedFraction& operator/=(const BasicCheckedFraction& rhs);
+	BasicCheckedFraction& operator/=(const IntT rhs);
+
+	// Stream Manipulation Operator Overloads
+	template <typename T, typename P> friend std::ostream& operator <<(std::ostream&, const BasicCheckedFraction<T, P>&);
+	template <typename T, typename P> friend std::istream& operator >>(std::istream&, BasicCheckedFraction<T, P>&);
+
+private:
+	static constexpr bool kWidens = sizeof(WideInteger) > sizeof(IntT) && sizeof(WideInteger) <= sizeof(long long);
+
+	BasicFraction<IntT> value;
+
+	static Result sum(IntT a, IntT b, IntT c, IntT d);
+	static Result product(IntT a, IntT b, IntT c, IntT d);
+	static Result quotient(IntT a, IntT b, IntT c, IntT d);
+	static Result narrow(WideInteger num, WideInteger den);
+	FRACTION_NOINLINE static Result overflowed(WideInteger num, WideInteger den);
+	static Result reduced(IntT numerator, IntT denominator);
+	FRACTION_NOINLINE static Result exact(const BigFraction& result);
+	void assign(const BasicCheckedFraction& result);
+	void assign(const BigFraction& result);
+
+};
+
+// Checked variants of the original int fraction and the 64-bit fraction, and the other policies for int
+using CheckedFraction = BasicCheckedFraction<int>;
+using CheckedFraction64 = BasicCheckedFraction<std::int64_t>;
+using SaturatingFraction = BasicCheckedFraction<int, SaturateOnOverflow>;
+using PromotingFraction = BasicCheckedFraction<int, PromoteOnOverflow>;
+
+#include "CheckedFraction.inl"
+
+// Instantiated once in CheckedFraction.cpp
+extern template class BasicCheckedFraction<std::int32_t, ThrowOnOverflow>;
+extern template class BasicCheckedFraction<std::int64_t, ThrowOnOverflow>;
+extern template class BasicCheckedFraction<std::int32_t, SaturateOnOverflow>;
+extern template class BasicCheckedFraction<std::int32_t, PromoteOnOverflow>;
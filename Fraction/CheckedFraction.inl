@@ -0,0 +1,705 @@
+#pragma once
+/**
+* @file		CheckedFraction.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the overflow checked integer helpers, the overflow policies and BasicCheckedFraction.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <limits>
+#include <stdexcept>
+
+/**
+*	Adds two integers, reporting whether the true sum wrapped.
+*
+*	@param lhs first addend
+*	@param rhs second addend
+*	@param result receives the sum, wrapped on overflow
+*	@return true if the sum overflowed IntT
+*/
+template <typename IntT>
+bool checked::addOverflows(IntT lhs, IntT rhs, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_add_overflow(lhs, rhs, &result);
+#else
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	result = static_cast<IntT>(static_cast<Unsigned>(lhs) + static_cast<Unsigned>(rhs));
+	return (lhs < 0) == (rhs < 0) && (result < 0) != (lhs < 0);
+#endif
+}
+
+/**
+*	Subtracts two integers, reporting whether the true difference wrapped.
+*
+*	@param lhs value subtracted from
+*	@param rhs value subtracted
+*	@param result receives the difference, wrapped on overflow
+*	@return true if the difference overflowed IntT
+*/
+template <typename IntT>
+bool checked::subtractOverflows(IntT lhs, IntT rhs, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	result = static_cast<IntT>(static_cast<Unsigned>(lhs) - static_cast<Unsigned>(rhs));
+	return (lhs < 0) != (rhs < 0) && (result < 0) != (lhs < 0);
+#endif
+}
+
+/**
+*	Multiplies two integers, reporting whether the true product wrapped. Without the builtins, narrow types multiply
+*	in long long and long long compares the product of the magnitudes against the limit for the result's sign.
+*
+*	@param lhs first factor
+*	@param rhs second factor
+*	@param result receives the product, wrapped on overflow
+*	@return true if the product overflowed IntT
+*/
+template <typename IntT>
+bool checked::multiplyOverflows(IntT lhs, IntT rhs, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+	if constexpr (sizeof(IntT) < sizeof(long long)) {
+		long long wide = static_cast<long long>(lhs) * rhs;
+		result = static_cast<IntT>(wide);
+		return wide != result;
+	}
+	else {
+		using Unsigned = gcd::UnsignedOf<IntT>;
+		Unsigned x = gcd::magnitude(lhs);
+		Unsigned y = gcd::magnitude(rhs);
+		bool negative = (lhs < 0) != (rhs < 0);
+		Unsigned limit = static_cast<Unsigned>(std::numeric_limits<IntT>::max()) + (negative ? 1 : 0);
+		Unsigned product = x * y;
+		result = static_cast<IntT>(negative ? Unsigned(0) - product : product);
+		return x != 0 && y > limit / x;
+	}
+#endif
+}
+
+/**
+*	Tells whether an arbitrary-precision integer is within the range of IntT.
+*
+*	@param value the integer to test
+*	@return true if value converts to IntT exactly
+*/
+template <typename IntT>
+bool checked::fits(const BigInteger& value) {
+	if (!value.isSmall())
+		return false;
+	long long small = value.toSmall();
+	return small >= static_cast<long long>(std::numeric_limits<IntT>::min()) && small <= static_cast<long long>(std::numeric_limits<IntT>::max());
+}
+
+/**
+*	Reports an overflowing result by throwing.
+*
+*	@param exact the exact result that did not fit
+*	@return never returns
+*/
+template <typename IntT>
+ThrowOnOverflow::Result<IntT> ThrowOnOverflow::overflow(const BigFraction& exact) {
+	(void)exact;
+	throw std::overflow_error("fraction overflow: the exact result does not fit the integer type");
+}
+
+/**
+*	Replaces an overflowing result by the closest value IntT can hold. Magnitudes of max or more clamp to +-max
+*	(not min, so that negating a saturated value stays in range). Smaller magnitudes are rounded, half up, to a
+*	multiple of 1/scale where scale = max / (whole part + 1), the largest denominator that keeps the numerator in range.
+*
+*	@param exact the exact result that did not fit
+*	@return the saturated fraction
+*/
+template <typename IntT>
+SaturateOnOverflow::Result<IntT> SaturateOnOverflow::overflow(const BigFraction& exact) {
+	const BigInteger max(static_cast<long long>(std::numeric_limits<IntT>::max()));
+	bool negative = exact.getNumerator().sign() < 0;
+	BigInteger num = negative ? -exact.getNumerator() : exact.getNumerator();
+	const BigInteger& den = exact.getDenominator();
+
+	BigInteger whole = num / den;
+	if (whole >= max)
+		return BasicFraction<IntT>(static_cast<IntT>(negative ? -max.toSmall() : max.toSmall()));
+	BigInteger scale = max / (whole + 1);
+	BigInteger rounded = (num * scale * 2 + den) / (den * 2);
+	long long magnitude = rounded.toSmall();
+	return BasicFraction<IntT>(static_cast<IntT>(negative ? -magnitude : magnitude), static_cast<IntT>(scale.toSmall()));
+}
+
+/**
+*	Keeps an overflowing result exactly, as the BigFraction it was computed in.
+*
+*	@param exact the exact result that did not fit
+*	@return the exact result
+*/
+template <typename IntT>
+PromoteOnOverflow::Result<IntT> PromoteOnOverflow::overflow(const BigFraction& exact) {
+	return exact;
+}
+
+/**
+*	Constructs a fraction equal to one, like the default Fraction.
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>::BasicCheckedFraction() : value(1) {
+}
+
+/**
+*	Constructs a whole number fraction.
+*
+*	@param numerator the whole number
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>::BasicCheckedFraction(IntT numerator) : value(numerator) {
+}
+
+/**
+*	Constructs a fraction from a numerator and denominator, reducing it like Fraction.
+*
+*	@param numerator the numerator
+*	@param denominator the denominator
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>::BasicCheckedFraction(IntT numerator, IntT denominator) : value(numerator, denominator) {
+}
+
+/**
+*	Constructs a checked fraction from an ordinary one.
+*
+*	@param fraction the fraction to copy
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>::BasicCheckedFraction(const BasicFraction<IntT>& fraction) : value(fraction) {
+}
+
+/**
+*	Returns the value of this fraction as an ordinary Fraction.
+*
+*	@return the fraction
+*/
+template <typename IntT, typename OverflowPolicy>
+const BasicFraction<IntT>& BasicCheckedFraction<IntT, OverflowPolicy>::toFraction() const {
+	return value;
+}
+
+/**
+*	Returns the numerator of this fraction in simplest form. Carries the sign of the fraction.
+*
+*	@return the numerator
+*/
+template <typename IntT, typename OverflowPolicy>
+IntT BasicCheckedFraction<IntT, OverflowPolicy>::getNumerator() const {
+	return value.getNumerator();
+}
+
+/**
+*	Returns the denominator of this fraction in simplest form. Always positive.
+*
+*	@return the denominator
+*/
+template <typename IntT, typename OverflowPolicy>
+IntT BasicCheckedFraction<IntT, OverflowPolicy>::getDenominator() const {
+	return value.getDenominator();
+}
+
+/**
+*	Overrides equality operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if fractions are equal, false if not
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator==(const BasicCheckedFraction& rhs) const {
+	return value == rhs.value;
+}
+
+/**
+*	Overrides inequality operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean false if fractions are equal, true if not
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator!=(const BasicCheckedFraction& rhs) const {
+	return value != rhs.value;
+}
+
+/**
+*	Compares this fraction with the provided one exactly.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return a negative number if this fraction is smaller, 0 if they are equal, a positive number if this fraction is larger
+*/
+template <typename IntT, typename OverflowPolicy>
+int BasicCheckedFraction<IntT, OverflowPolicy>::compare(const BasicCheckedFraction& rhs) const {
+	return value.compare(rhs.value);
+}
+
+/**
+*	Overrides less than operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return true if this fraction is smaller
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator<(const BasicCheckedFraction& rhs) const {
+	return value < rhs.value;
+}
+
+/**
+*	Overrides less than or equal operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return true if this fraction is smaller or equal
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator<=(const BasicCheckedFraction& rhs) const {
+	return value <= rhs.value;
+}
+
+/**
+*	Overrides greater than operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return true if this fraction is larger
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator>(const BasicCheckedFraction& rhs) const {
+	return value > rhs.value;
+}
+
+/**
+*	Overrides greater than or equal operator.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return true if this fraction is larger or equal
+*/
+template <typename IntT, typename OverflowPolicy>
+bool BasicCheckedFraction<IntT, OverflowPolicy>::operator>=(const BasicCheckedFraction& rhs) const {
+	return value >= rhs.value;
+}
+
+/**
+*	Returns the sum of this fraction and the provided one.
+*
+*	@param rhs fraction to be added to this one
+*	@return the sum, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator+(const BasicCheckedFraction& rhs) const {
+	return sum(value.getNumerator(), value.getDenominator(), rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Returns the sum of this fraction and the provided integer.
+*
+*	@param rhs integer to be added to this fraction
+*	@return the sum, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator+(const IntT rhs) const {
+	return sum(value.getNumerator(), value.getDenominator(), rhs, 1);
+}
+
+/**
+*	Returns the sum of the provided integer and fraction.
+*
+*	@param lhs integer to be added to the fraction
+*	@param rhs fraction to be added to the integer
+*	@return the sum, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result operator+(const FractionInteger<IntT> lhs, const BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	return BasicCheckedFraction<IntT, OverflowPolicy>::sum(lhs, 1, rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Replaces this fraction with its sum with the provided one.
+*
+*	@param rhs fraction to be added to this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator+=(const BasicCheckedFraction& rhs) {
+	assign(*this + rhs);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with its sum with the provided integer.
+*
+*	@param rhs integer to be added to this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator+=(const IntT rhs) {
+	assign(*this + rhs);
+	return *this;
+}
+
+/**
+*	Returns the difference between this fraction and the provided one.
+*
+*	@param rhs fraction to be subtracted from this one
+*	@return the difference, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator-(const BasicCheckedFraction& rhs) const {
+	IntT negated;
+	if (checked::subtractOverflows(IntT(0), rhs.value.getNumerator(), negated))
+		return exact(BigFraction(value) - BigFraction(rhs.value));
+	return sum(value.getNumerator(), value.getDenominator(), negated, rhs.value.getDenominator());
+}
+
+/**
+*	Returns the difference between this fraction and the provided integer.
+*
+*	@param rhs integer to be subtracted from this fraction
+*	@return the difference, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator-(const IntT rhs) const {
+	IntT negated;
+	if (checked::subtractOverflows(IntT(0), rhs, negated))
+		return exact(BigFraction(value) - static_cast<long long>(rhs));
+	return sum(value.getNumerator(), value.getDenominator(), negated, 1);
+}
+
+/**
+*	Returns the difference between the provided integer and fraction.
+*
+*	@param lhs integer to be subtracted from
+*	@param rhs fraction to be subtracted from the integer
+*	@return the difference, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result operator-(const FractionInteger<IntT> lhs, const BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	IntT negated;
+	if (checked::subtractOverflows(IntT(0), rhs.value.getNumerator(), negated))
+		return BasicCheckedFraction<IntT, OverflowPolicy>::exact(static_cast<long long>(lhs) - BigFraction(rhs.value));
+	return BasicCheckedFraction<IntT, OverflowPolicy>::sum(lhs, 1, negated, rhs.value.getDenominator());
+}
+
+/**
+*	Replaces this fraction with its difference with the provided one.
+*
+*	@param rhs fraction to be subtracted from this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator-=(const BasicCheckedFraction& rhs) {
+	assign(*this - rhs);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with its difference with the provided integer.
+*
+*	@param rhs integer to be subtracted from this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator-=(const IntT rhs) {
+	assign(*this - rhs);
+	return *this;
+}
+
+/**
+*	Returns the product of this fraction and the provided one.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return the product, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator*(const BasicCheckedFraction& rhs) const {
+	return product(value.getNumerator(), value.getDenominator(), rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Returns the product of this fraction and the provided integer.
+*
+*	@param rhs integer to be multiplied by this fraction
+*	@return the product, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator*(const IntT rhs) const {
+	return product(value.getNumerator(), value.getDenominator(), rhs, 1);
+}
+
+/**
+*	Returns the product of the provided integer and fraction.
+*
+*	@param lhs integer to be multiplied by the fraction
+*	@param rhs fraction to be multiplied by the integer
+*	@return the product, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result operator*(const FractionInteger<IntT> lhs, const BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	return BasicCheckedFraction<IntT, OverflowPolicy>::product(lhs, 1, rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Replaces this fraction with its product with the provided one.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator*=(const BasicCheckedFraction& rhs) {
+	assign(*this * rhs);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with its product with the provided integer.
+*
+*	@param rhs integer to be multiplied by this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator*=(const IntT rhs) {
+	assign(*this * rhs);
+	return *this;
+}
+
+/**
+*	Returns this fraction divided by the provided one.
+*
+*	@param rhs fraction to be divided into this one
+*	@return the quotient, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator/(const BasicCheckedFraction& rhs) const {
+	return quotient(value.getNumerator(), value.getDenominator(), rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Returns this fraction divided by the provided integer.
+*
+*	@param rhs integer to be divided into this fraction
+*	@return the quotient, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::operator/(const IntT rhs) const {
+	return quotient(value.getNumerator(), value.getDenominator(), rhs, 1);
+}
+
+/**
+*	Returns the provided integer divided by the provided fraction.
+*
+*	@param lhs integer to be divided into
+*	@param rhs fraction to be divided into the integer
+*	@return the quotient, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result operator/(const FractionInteger<IntT> lhs, const BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	return BasicCheckedFraction<IntT, OverflowPolicy>::quotient(lhs, 1, rhs.value.getNumerator(), rhs.value.getDenominator());
+}
+
+/**
+*	Replaces this fraction with itself divided by the provided one.
+*
+*	@param rhs fraction to be divided into this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator/=(const BasicCheckedFraction& rhs) {
+	assign(*this / rhs);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with itself divided by the provided integer.
+*
+*	@param rhs integer to be divided into this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT, typename OverflowPolicy>
+BasicCheckedFraction<IntT, OverflowPolicy>& BasicCheckedFraction<IntT, OverflowPolicy>::operator/=(const IntT rhs) {
+	assign(*this / rhs);
+	return *this;
+}
+
+/**
+*	Adds a/b and c/d, both in simplest form with positive denominators. Types with a native wider type add exactly in
+*	it, like Fraction, and only check that the reduced result fits. Others divide the denominators by g = gcd(b, d)
+*	before cross multiplying to keep the intermediates small, after which the result only has to be divided by
+*	gcd(t, g) to be in simplest form again (Knuth, TAOCP vol. 2, 4.5.1); every product and sum is overflow checked.
+*
+*	@return the sum, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::sum(IntT a, IntT b, IntT c, IntT d) {
+	if constexpr (kWidens)
+		return narrow(WideInteger(a) * d + WideInteger(c) * b, WideInteger(b) * d);
+	IntT g = static_cast<IntT>(gcd::compute(b, d));
+	IntT bg = b / g;
+	IntT dg = d / g;
+	IntT ad, cb, num, den;
+	if (!checked::multiplyOverflows(a, dg, ad) && !checked::multiplyOverflows(c, bg, cb) && !checked::addOverflows(ad, cb, num)) {
+		if (num == 0)
+			return reduced(0, 1);
+		IntT common = static_cast<IntT>(gcd::compute(num, g));
+		if (!checked::multiplyOverflows(bg, d / common, den))
+			return reduced(num / common, den);
+	}
+	return exact(BigFraction(a, b) + BigFraction(c, d));
+}
+
+/**
+*	Multiplies a/b by c/d, both in simplest form with positive denominators. Types with a native wider type multiply
+*	exactly in it. Others cancel gcd(a, d) and gcd(c, b) first, which leaves a product that is already in simplest
+*	form, so only a real overflow can make it not fit.
+*
+*	@return the product, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::product(IntT a, IntT b, IntT c, IntT d) {
+	if constexpr (kWidens)
+		return narrow(WideInteger(a) * c, WideInteger(b) * d);
+	IntT ad = static_cast<IntT>(gcd::compute(a, d));
+	IntT cb = static_cast<IntT>(gcd::compute(c, b));
+	IntT num, den;
+	if (!checked::multiplyOverflows(a / ad, c / cb, num) && !checked::multiplyOverflows(b / cb, d / ad, den))
+		return reduced(num, den);
+	return exact(BigFraction(a, b) * BigFraction(c, d));
+}
+
+/**
+*	Divides a/b by c/d by multiplying by d/c, moving the sign of c onto the numerator.
+*
+*	@return the quotient, or the policy's answer if it overflows
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::quotient(IntT a, IntT b, IntT c, IntT d) {
+	if (c == 0)
+		throw std::domain_error("fraction division by zero");
+	if constexpr (kWidens)
+		return narrow(WideInteger(a) * d, WideInteger(b) * c);
+	if (c > 0)
+		return product(a, b, d, c);
+	IntT negated;
+	if (checked::subtractOverflows(IntT(0), c, negated))
+		return exact(BigFraction(a, b) / BigFraction(c, d));
+	return product(a, b, -d, negated);
+}
+
+/**
+*	Reduces an exact result computed in WideInteger, and returns it if it fits IntT.
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::narrow(WideInteger num, WideInteger den) {
+	WideInteger common = static_cast<WideInteger>(gcd::compute(num, den));
+	num /= common;
+	den /= common;
+	if (den < 0) {
+		num = -num;
+		den = -den;
+	}
+	IntT narrowNum = static_cast<IntT>(num);
+	IntT narrowDen = static_cast<IntT>(den);
+	if (narrowNum == num && narrowDen == den)
+		return reduced(narrowNum, narrowDen);
+	return overflowed(num, den);
+}
+
+/**
+*	Hands a reduced result that does not fit IntT to the policy. Kept out of narrow() so that building the BigFraction
+*	does not weigh on the path that fits.
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::overflowed(WideInteger num, WideInteger den) {
+	FRACTION_COUNT(Overflow);
+	return Result(OverflowPolicy::template overflow<IntT>(BigFraction(BigInteger(num), BigInteger(den))));
+}
+
+/**
+*	Wraps a numerator and denominator that are already in simplest form as a result.
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::reduced(IntT numerator, IntT denominator) {
+	return Result(BasicFraction<IntT>(numerator, denominator, typename BasicFraction<IntT>::ReducedTag()));
+}
+
+/**
+*	Finishes the slow path: an exact result that fits after all (an intermediate overflowed, the answer did not)
+*	is returned as usual, anything else goes to the policy.
+*/
+template <typename IntT, typename OverflowPolicy>
+typename BasicCheckedFraction<IntT, OverflowPolicy>::Result BasicCheckedFraction<IntT, OverflowPolicy>::exact(const BigFraction& result) {
+	if (checked::fits<IntT>(result.getNumerator()) && checked::fits<IntT>(result.getDenominator()))
+		return reduced(static_cast<IntT>(result.getNumerator().toSmall()), static_cast<IntT>(result.getDenominator().toSmall()));
+	FRACTION_COUNT(Overflow);
+	return Result(OverflowPolicy::template overflow<IntT>(result));
+}
+
+/**
+*	Stores the result of a compound assignment.
+*/
+template <typename IntT, typename OverflowPolicy>
+void BasicCheckedFraction<IntT, OverflowPolicy>::assign(const BasicCheckedFraction& result) {
+	value = result.value;
+}
+
+/**
+*	Stores a promoted result of a compound assignment, which is only possible if it fits.
+*/
+template <typename IntT, typename OverflowPolicy>
+void BasicCheckedFraction<IntT, OverflowPolicy>::assign(const BigFraction& result) {
+	if (!checked::fits<IntT>(result.getNumerator()) || !checked::fits<IntT>(result.getDenominator()))
+		throw std::overflow_error("fraction overflow: a promoted result does not fit back into the integer type");
+	value = BasicFraction<IntT>(static_cast<IntT>(result.getNumerator().toSmall()), static_cast<IntT>(result.getDenominator().toSmall()),
+		typename BasicFraction<IntT>::ReducedTag());
+}
+
+/**
+*	Writes the fraction in the same format as Fraction.
+*
+*	@param os outputstream to be written to
+*	@param rhs fraction to be written
+*	@return the provided outputstream after writing to it
+*/
+template <typename IntT, typename OverflowPolicy>
+std::ostream& operator <<(std::ostream& os, const BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	return os << rhs.value;
+}
+
+/**
+*	Reads a fraction in the same format as Fraction.
+*
+*	@param is inputstream that the fraction string is extracted from
+*	@param rhs fraction whos value is set from the contents of the stream
+*	@return the provided inputstream after extracting from it
+*/
+template <typename IntT, typename OverflowPolicy>
+std::istream& operator >>(std::istream& is, BasicCheckedFraction<IntT, OverflowPolicy>& rhs) {
+	return is >> rhs.value;
+}
@@ -0,0 +1,234 @@
+#pragma once
+/**
+* @file		FixedFraction.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Fractions with a denominator fixed at compile time, such as cents (1/100) or ticks of 1/2^k, stored as a scaled
+*  integer. Addition, subtraction and comparison against the same denominator are single integer operations with
+*  no gcd; any other operand widens the value to the general BasicFraction.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "Fraction.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace fixed {
+
+	/**
+	*	True for integer operands that convert to IntT without narrowing, which the mixed operators accept.
+	*	Wider or same-sized unsigned integers would be truncated silently, so they are rejected instead.
+	*	__int128 is not std::is_integral in strict mode, so IntT itself is always accepted.
+	*/
+	template <typename T, typename IntT>
+	constexpr bool isInteger = std::is_same<T, IntT>::value
+		|| (std::is_integral<T>::value && (sizeof(T) < sizeof(IntT) || (sizeof(T) == sizeof(IntT) && std::is_signed<T>::value)));
+}
+
+/**
+*	A fraction whose denominator is the constant Den: the value units / Den, kept as the integer units without reducing.
+*	Operations between values of the same type work on units directly, and integers are scaled into units first.
+*	Values of another denominator, general fractions, products of two fixed values and quotients widen both operands to
+*	BasicFraction<IntT> and give a BasicFraction. Like BasicFraction, the arithmetic is unchecked: the
+*	units must stay within IntT, so whole numbers are limited to the range of IntT divided by Den.
+*
+*		FixedFraction<100> total;
+*		for (const FixedFraction<100>& amount : amounts)
+*			total += amount;
+*		Fraction share = total / 3;
+*/
+template <typename IntT, IntT Den>
+class BasicFixedFraction
+{
+	static_assert(Den > 0, "the fixed denominator must be positive");
+
+public:
+	using Integer = IntT;
+	using WideInteger = typename BasicFraction<IntT>::WideInteger;
+	static constexpr IntT kDenominator = Den;
+
+	explicit constexpr BasicFixedFraction();
+	constexpr BasicFixedFraction(IntT whole);
+	// Integers that do not fit IntT would otherwise convert to it silently, through the constructor above
+	template <typename T, std::enable_if_t<std::is_integral<T>::value && !fixed::isInteger<T, IntT>, int> = 0>
+	BasicFixedFraction(T whole) = delete;
+	explicit constexpr BasicFixedFraction(const BasicFraction<IntT>& fraction);
+	static constexpr BasicFixedFraction fromUnits(IntT units);
+	static constexpr BasicFixedFraction rounded(const BasicFraction<IntT>& value);
+
+	constexpr IntT units() const;
+
+	// Widening Conversion, to the reduced general fraction
+	constexpr operator BasicFraction<IntT>() const;
+
+	// Comparison Operator Overloads, one integer comparison
+	constexpr int compare(const BasicFixedFraction& rhs) const;
+	constexpr bool operator==(const BasicFixedFraction& rhs) const;
+	constexpr bool operator!=(const BasicFixedFraction& rhs) const;
+	constexpr bool operator<(const BasicFixedFraction& rhs) const;
+	constexpr bool operator<=(const BasicFixedFraction& rhs) const;
+	constexpr bool operator>(const BasicFixedFraction& rhs) const;
+	constexpr bool operator>=(const BasicFixedFraction& rhs) const;
+
+	// Arithmetic Operator Overloads, one integer operation
+	constexpr BasicFixedFraction operator-() const;
+	constexpr BasicFixedFraction operator+(const BasicFixedFraction& rhs) const;
+	constexpr BasicFixedFraction& operator+=(const BasicFixedFraction& rhs);
+	constexpr BasicFixedFraction operator-(const BasicFixedFraction& rhs) const;
+	constexpr BasicFixedFraction& operator-=(const BasicFixedFraction& rhs);
+	constexpr BasicFixedFraction& operator*=(const IntT rhs);
+
+	// Stream Manipulation Operator Overload, written as the reduced fraction
+	template <typename T, T D> friend std::ostream& operator <<(std::ostream&, const BasicFixedFraction<T, D>&);
+
+private:
+	IntT value;
+
+};
+
+// Fixed denominator variants of the original int fraction and of the 64 bit one
+template <int Den> using FixedFraction = BasicFixedFraction<int, Den>;
+template <std::int64_t Den> using FixedFraction64 = BasicFixedFraction<std::int64_t, Den>;
+
+/**
+*	Operand rules for the operators that mix a fixed fraction with another type. Each result type is only defined
+*	for the combinations it applies to, so the operators below drop out of overload resolution for everything else,
+*	including BasicFraction with BasicFraction and two values of the same fixed type, which use the member operators.
+*/
+namespace fixed {
+
+	template <typename T> struct Traits {
+		static constexpr bool isFixed = false;
+		static constexpr bool isFraction = false;
+	};
+
+	template <typename IntT, IntT Den> struct Traits<BasicFixedFraction<IntT, Den>> {
+		static constexpr bool isFixed = true;
+		static constexpr bool isFraction = false;
+		using Integer = IntT;
+	};
+
+	template <typename IntT> struct Traits<BasicFraction<IntT>> {
+		static constexpr bool isFixed = false;
+		static constexpr bool isFraction = true;
+		using Integer = IntT;
+	};
+
+	/**
+	*	Type both operands of +, - and the comparisons are converted to: the fixed type when the other operand is an
+	*	integer, and the general fraction when it is a general fraction or a fixed fraction of another denominator.
+	*/
+	template <typename L, typename R, typename = void> struct Common {};
+
+	template <typename IntT, IntT Den, typename T>
+	struct Common<BasicFixedFraction<IntT, Den>, T, std::enable_if_t<isInteger<T, IntT>>> {
+		using type = BasicFixedFraction<IntT, Den>;
+	};
+
+	template <typename T, typename IntT, IntT Den>
+	struct Common<T, BasicFixedFraction<IntT, Den>, std::enable_if_t<isInteger<T, IntT>>> {
+		using type = BasicFixedFraction<IntT, Den>;
+	};
+
+	template <typename IntT, IntT Den>
+	struct Common<BasicFixedFraction<IntT, Den>, BasicFraction<IntT>> {
+		using type = BasicFraction<IntT>;
+	};
+
+	template <typename IntT, IntT Den>
+	struct Common<BasicFraction<IntT>, BasicFixedFraction<IntT, Den>> {
+		using type = BasicFraction<IntT>;
+	};
+
+	template <typename IntT, IntT LhsDen, IntT RhsDen>
+	struct Common<BasicFixedFraction<IntT, LhsDen>, BasicFixedFraction<IntT, RhsDen>, std::enable_if_t<LhsDen != RhsDen>> {
+		using type = BasicFraction<IntT>;
+	};
+
+	/**
+	*	Type of a product: the fixed type when one operand is an integer, otherwise the general fraction,
+	*	as the product of two fixed values is over Den squared.
+	*/
+	template <typename L, typename R, typename = void> struct Product {};
+
+	template <typename L, typename R>
+	struct Product<L, R, std::enable_if_t<Traits<L>::isFixed && Traits<R>::isFixed>> {
+		using type = BasicFraction<typename Traits<L>::Integer>;
+	};
+
+	template <typename L, typename R>
+	struct Product<L, R, std::enable_if_t<Traits<L>::isFixed != Traits<R>::isFixed>> {
+		using type = typename Common<L, R>::type;
+	};
+
+	/**
+	*	Type of a quotient: always the general fraction, when either operand is a fixed fraction.
+	*/
+	template <typename L, typename R, typename = void> struct Quotient {};
+
+	template <typename L, typename R>
+	struct Quotient<L, R, std::enable_if_t<Traits<L>::isFixed && Traits<R>::isFixed>> {
+		using type = BasicFraction<typename Traits<L>::Integer>;
+	};
+
+	template <typename L, typename R>
+	struct Quotient<L, R, std::enable_if_t<Traits<L>::isFixed != Traits<R>::isFixed>> {
+		using type = BasicFraction<typename Traits<typename Common<L, R>::type>::Integer>;
+	};
+
+	// True when one operand is a fixed fraction and the other an integer
+	template <typename L, typename R>
+	constexpr bool isWholeComparison = Traits<L>::isFixed != Traits<R>::isFixed && !Traits<L>::isFraction && !Traits<R>::isFraction;
+
+	template <typename IntT, IntT Den, typename T>
+	constexpr int compareWhole(const BasicFixedFraction<IntT, Den>& lhs, const T& rhs);
+
+	template <typename T, typename IntT, IntT Den>
+	constexpr int compareWhole(const T& lhs, const BasicFixedFraction<IntT, Den>& rhs);
+
+	template <typename L, typename R> using CommonType = typename Common<L, R>::type;
+	template <typename L, typename R> using ProductType = typename Product<L, R>::type;
+	template <typename L, typename R> using QuotientType = typename Quotient<L, R>::type;
+	template <typename L, typename R> using ComparisonType = std::enable_if_t<std::is_class<CommonType<L, R>>::value, bool>;
+}
+
+// Mixed Operator Overloads, converting both operands to the type given by the fixed namespace rules
+template <typename L, typename R> constexpr fixed::CommonType<L, R> operator+(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::CommonType<L, R> operator-(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ProductType<L, R> operator*(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::QuotientType<L, R> operator/(const L& lhs, const R& rhs);
+
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator==(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator!=(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator<(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator<=(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator>(const L& lhs, const R& rhs);
+template <typename L, typename R> constexpr fixed::ComparisonType<L, R> operator>=(const L& lhs, const R& rhs);
+
+#include "FixedFraction.inl"
@@ -0,0 +1,386 @@
+/**
+* @file		FixedFraction.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Template implementation of the fixed denominator fraction, included from FixedFraction.h.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+/**
+*	Constructs the fixed fraction 0.
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>::BasicFixedFraction() : value(0) {
+}
+
+/**
+*	Constructs the fixed fraction equal to a whole number.
+*
+*	@param whole the whole number, within the range of IntT divided by Den
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>::BasicFixedFraction(IntT whole) : value(whole * Den) {
+}
+
+/**
+*	Converts a general fraction whose denominator divides Den, such as 3/4 to hundredths.
+*
+*	@param fraction the fraction to convert
+*	@throws std::domain_error if the fraction is not a whole number of 1/Den
+*	@throws std::overflow_error if the value needs more units than IntT holds
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>::BasicFixedFraction(const BasicFraction<IntT>& fraction) : value(0) {
+	IntT den = fraction.getDenominator();
+	if (den == 0 || Den % den != 0)
+		throw std::domain_error("fraction is not a whole number of the fixed denominator");
+	WideInteger units = WideInteger(fraction.getNumerator()) * (Den / den);
+	if (units != static_cast<IntT>(units))
+		throw std::overflow_error("fraction is out of the range of the fixed fraction");
+	value = static_cast<IntT>(units);
+}
+
+/**
+*	Constructs the fixed fraction units / Den.
+*
+*	@param units the numerator over Den
+*	@return the fixed fraction
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den> BasicFixedFraction<IntT, Den>::fromUnits(IntT units) {
+	BasicFixedFraction result;
+	result.value = units;
+	return result;
+}
+
+/**
+*	Rounds a general fraction to the nearest whole number of 1/Den, ties to even, as amounts are rounded to cents.
+*
+*	@param value the fraction to round
+*	@return the nearest fixed fraction
+*	@throws std::domain_error if the fraction has a zero denominator
+*	@throws std::overflow_error if the result needs more units than IntT holds
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den> BasicFixedFraction<IntT, Den>::rounded(const BasicFraction<IntT>& value) {
+	WideInteger den = value.getDenominator();
+	if (den == 0)
+		throw std::domain_error("fraction has a zero denominator");
+	WideInteger scaled = WideInteger(value.getNumerator()) * Den;
+	WideInteger quotient = scaled / den;
+	WideInteger remainder = scaled % den;
+	if (remainder < 0) {
+		--quotient;
+		remainder += den;
+	}
+	if (remainder > den - remainder || (remainder == den - remainder && quotient % 2 != 0))
+		++quotient;
+	if (quotient != static_cast<IntT>(quotient))
+		throw std::overflow_error("fraction is out of the range of the fixed fraction");
+	return fromUnits(static_cast<IntT>(quotient));
+}
+
+/**
+*	@return the numerator over Den, unreduced
+*/
+template <typename IntT, IntT Den>
+constexpr IntT BasicFixedFraction<IntT, Den>::units() const {
+	return value;
+}
+
+/**
+*	Widens the value to a general fraction, in simplest form.
+*
+*	@return units / Den reduced
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>::operator BasicFraction<IntT>() const {
+	return BasicFraction<IntT>(value, Den);
+}
+
+/**
+*	Compares this fixed fraction with another of the same denominator.
+*
+*	@param rhs the value to compare with
+*	@return a negative value, zero or a positive value as this one is less than, equal to or greater than rhs
+*/
+template <typename IntT, IntT Den>
+constexpr int BasicFixedFraction<IntT, Den>::compare(const BasicFixedFraction& rhs) const {
+	return (value > rhs.value) - (value < rhs.value);
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator==(const BasicFixedFraction& rhs) const {
+	return value == rhs.value;
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator!=(const BasicFixedFraction& rhs) const {
+	return value != rhs.value;
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator<(const BasicFixedFraction& rhs) const {
+	return value < rhs.value;
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator<=(const BasicFixedFraction& rhs) const {
+	return value <= rhs.value;
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator>(const BasicFixedFraction& rhs) const {
+	return value > rhs.value;
+}
+
+template <typename IntT, IntT Den>
+constexpr bool BasicFixedFraction<IntT, Den>::operator>=(const BasicFixedFraction& rhs) const {
+	return value >= rhs.value;
+}
+
+/**
+*	@return the negated fixed fraction
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den> BasicFixedFraction<IntT, Den>::operator-() const {
+	return fromUnits(-value);
+}
+
+/**
+*	Returns the sum of this fixed fraction and another of the same denominator.
+*
+*	@param rhs the value to add
+*	@return the sum, over the same denominator
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den> BasicFixedFraction<IntT, Den>::operator+(const BasicFixedFraction& rhs) const {
+	return fromUnits(value + rhs.value);
+}
+
+/**
+*	Adds another fixed fraction of the same denominator to this one.
+*
+*	@param rhs the value to add
+*	@return a reference to this fixed fraction, for chaining
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>& BasicFixedFraction<IntT, Den>::operator+=(const BasicFixedFraction& rhs) {
+	value += rhs.value;
+	return *this;
+}
+
+/**
+*	Returns the difference between this fixed fraction and another of the same denominator.
+*
+*	@param rhs the value to subtract
+*	@return the difference, over the same denominator
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den> BasicFixedFraction<IntT, Den>::operator-(const BasicFixedFraction& rhs) const {
+	return fromUnits(value - rhs.value);
+}
+
+/**
+*	Subtracts another fixed fraction of the same denominator from this one.
+*
+*	@param rhs the value to subtract
+*	@return a reference to this fixed fraction, for chaining
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>& BasicFixedFraction<IntT, Den>::operator-=(const BasicFixedFraction& rhs) {
+	value -= rhs.value;
+	return *this;
+}
+
+/**
+*	Multiplies this fixed fraction by an integer, which keeps the denominator.
+*
+*	@param rhs the integer to multiply by
+*	@return a reference to this fixed fraction, for chaining
+*/
+template <typename IntT, IntT Den>
+constexpr BasicFixedFraction<IntT, Den>& BasicFixedFraction<IntT, Den>::operator*=(const IntT rhs) {
+	value *= rhs;
+	return *this;
+}
+
+/**
+*	Writes the fixed fraction as its reduced "num/den" form.
+*
+*	@param os outputstream that the fraction string is written to
+*	@param rhs fixed fraction to write
+*	@return the provided outputstream after inserting into it
+*/
+template <typename IntT, IntT Den>
+std::ostream& operator <<(std::ostream& os, const BasicFixedFraction<IntT, Den>& rhs) {
+	return os << BasicFraction<IntT>(rhs);
+}
+
+/**
+*	Adds a fixed fraction and an integer, a general fraction or a fixed fraction of another denominator.
+*	Integers keep the fixed denominator; the other operands give a general fraction.
+*
+*	@param lhs the left operand
+*	@param rhs the right operand
+*	@return the sum
+*/
+template <typename L, typename R>
+constexpr fixed::CommonType<L, R> operator+(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	return Common(lhs) + Common(rhs);
+}
+
+/**
+*	Subtracts between a fixed fraction and an integer, a general fraction or a fixed fraction of another denominator.
+*	Integers keep the fixed denominator; the other operands give a general fraction.
+*
+*	@param lhs the value subtracted from
+*	@param rhs the value subtracted
+*	@return the difference
+*/
+template <typename L, typename R>
+constexpr fixed::CommonType<L, R> operator-(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	return Common(lhs) - Common(rhs);
+}
+
+/**
+*	Multiplies a fixed fraction by an integer, keeping the denominator, or by anything else, giving a general fraction.
+*
+*	@param lhs the left operand
+*	@param rhs the right operand
+*	@return the product
+*/
+template <typename L, typename R>
+constexpr fixed::ProductType<L, R> operator*(const L& lhs, const R& rhs) {
+	using Product = fixed::ProductType<L, R>;
+	using IntT = typename fixed::Traits<Product>::Integer;
+	if constexpr (fixed::Traits<Product>::isFixed) {
+		if constexpr (fixed::Traits<L>::isFixed)
+			return Product::fromUnits(lhs.units() * static_cast<IntT>(rhs));
+		else
+			return Product::fromUnits(static_cast<IntT>(lhs) * rhs.units());
+	}
+	else {
+		return BasicFraction<IntT>(lhs) * BasicFraction<IntT>(rhs);
+	}
+}
+
+/**
+*	Divides with a fixed fraction on either side, giving a general fraction.
+*
+*	@param lhs the dividend
+*	@param rhs the divisor
+*	@return the quotient
+*/
+template <typename L, typename R>
+constexpr fixed::QuotientType<L, R> operator/(const L& lhs, const R& rhs) {
+	using Quotient = fixed::QuotientType<L, R>;
+	return Quotient(lhs) / Quotient(rhs);
+}
+
+/**
+*	Compares a fixed fraction with a whole number without scaling the whole number into units, which can overflow.
+*	units = q * Den + r with |r| < Den, so q decides unless it equals the whole number, and then r does.
+*
+*	@param lhs the fixed fraction
+*	@param rhs the whole number
+*	@return a negative value, zero or a positive value as lhs is less than, equal to or greater than rhs
+*/
+template <typename IntT, IntT Den, typename T>
+constexpr int fixed::compareWhole(const BasicFixedFraction<IntT, Den>& lhs, const T& rhs) {
+	IntT whole = static_cast<IntT>(rhs);
+	IntT quotient = lhs.units() / Den;
+	IntT remainder = lhs.units() % Den;
+	if (quotient != whole)
+		return quotient < whole ? -1 : 1;
+	return (remainder > 0) - (remainder < 0);
+}
+
+template <typename T, typename IntT, IntT Den>
+constexpr int fixed::compareWhole(const T& lhs, const BasicFixedFraction<IntT, Den>& rhs) {
+	return -compareWhole(rhs, lhs);
+}
+
+/**
+*	Comparisons between a fixed fraction and an integer, a general fraction or a fixed fraction of another denominator.
+*	Integers are compared by fixed::compareWhole(), the rest exactly in the type given by fixed::Common.
+*/
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator==(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) == 0;
+	else
+		return Common(lhs) == Common(rhs);
+}
+
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator!=(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) != 0;
+	else
+		return Common(lhs) != Common(rhs);
+}
+
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator<(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) < 0;
+	else
+		return Common(lhs) < Common(rhs);
+}
+
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator<=(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) <= 0;
+	else
+		return Common(lhs) <= Common(rhs);
+}
+
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator>(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) > 0;
+	else
+		return Common(lhs) > Common(rhs);
+}
+
+template <typename L, typename R>
+constexpr fixed::ComparisonType<L, R> operator>=(const L& lhs, const R& rhs) {
+	using Common = fixed::CommonType<L, R>;
+	if constexpr (fixed::isWholeComparison<L, R>)
+		return fixed::compareWhole(lhs, rhs) >= 0;
+	else
+		return Common(lhs) >= Common(rhs);
+}
@@ -30,72 +30,225 @@
 *
 */
 
+#include "Gcd.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <ratio>
+#include <string_view>
 
-class Fraction
+/**
+*	Selects the integer type that intermediate products of a BasicFraction<IntT> are computed in.
+*	Narrow types widen to the next native width so that a*d + b*c cannot overflow before the result is reduced;
+*	types without a wider native type compute in their own width.
+*/
+template <typename IntT> struct FractionWidening { using type = IntT; };
+template <> struct FractionWidening<std::int8_t> { using type = std::int32_t; };
+template <> struct FractionWidening<std::int16_t> { using type = std::int32_t; };
+template <> struct FractionWidening<std::int32_t> { using type = std::int64_t; };
+#ifdef __SIZEOF_INT128__
+template <> struct FractionWidening<std::int64_t> { using type = __int128; };
+#endif
+
+/**
+*	Keeps the integer operand of the mixed operators out of template argument deduction,
+*	so that Fraction64 + 3 converts the int instead of failing to deduce.
+*/
+template <typename T> struct FractionIdentity { using type = T; };
+template <typename T> using FractionInteger = typename FractionIdentity<T>::type;
+
+/**
+*	Reasons BasicFraction::parse() can reject its input.
+*/
+enum class FractionParseError {
+	None,
+	ExpectedNumerator,
+	ExpectedDenominator,
+	OutOfRange,
+	TrailingCharacters
+};
+
+const char* describe(FractionParseError error);
+
+template <typename IntT> struct BasicFractionParseResult;
+template <typename IntT> class BasicFractionArray;
+template <typename IntT> class BasicFractionView;
+template <typename IntT> class BasicLazyFraction;
+template <typename IntT, typename OverflowPolicy> class BasicCheckedFraction;
+namespace fused { template <typename IntT> struct Finish; }
+
+template <typename IntT>
+class BasicFraction
 {
 
 public:
-	explicit Fraction();
-	Fraction(int numerator);
-	Fraction(int numerator, int denominator);
+	using Integer = IntT;
+	using WideInteger = typename FractionWidening<IntT>::type;
+
+	explicit constexpr BasicFraction();
+	constexpr BasicFraction(IntT numerator);
+	constexpr BasicFraction(IntT numerator, IntT denominator);
+	template <std::intmax_t Num, std::intmax_t Den> constexpr BasicFraction(std::ratio<Num, Den>);
+
+	constexpr IntT getNumerator() const;
+	constexpr IntT getDenominator() const;
+
+	// Text Conversion, "num/den" or a whole number, without locales or allocation
+	static constexpr std::size_t kFormatBufferSize = 2 * (sizeof(IntT) * 8 * 30103 / 100000 + 2) + 2;
+	static BasicFractionParseResult<IntT> parse(std::string_view text);
+	std::size_t format(char* buffer) const;
 
 	// Equality Operator Overloads
-	bool operator==(const Fraction& rhs) const;
-	bool operator!=(const Fraction& rhs) const;
+	constexpr bool operator==(const BasicFraction& rhs) const;
+	constexpr bool operator!=(const BasicFraction& rhs) const;
+
+	// Hashing, over the canonical reduced form so that equal fractions hash equally
+	constexpr std::uint64_t hash() const;
+
+	// Conversion from double, exactly or to the closest fraction with a bounded denominator, and denominator limiting
+	static BasicFraction fromDouble(double value);
+	static BasicFraction fromDouble(double value, IntT maxDenominator);
+	constexpr BasicFraction limitDenominator(IntT maxDenominator) const;
+
+	// Numeric Conversion: correctly rounded floating point, and integer rounding without floating point
+	double toDouble() const;
+	float toFloat() const;
+	constexpr IntT floor() const;
+	constexpr IntT ceil() const;
+	constexpr IntT trunc() const;
+	constexpr IntT roundHalfEven() const;
 
 	// Comparison Operator Overloads
-	bool operator<(const Fraction& rhs) const;
-	friend bool operator<(const Fraction lhs, const int rhs);
-	friend bool operator<(const int lhs, const Fraction rhs);
+	constexpr int compare(const BasicFraction& rhs) const;
+
+	constexpr bool operator<(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr bool operator<(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr bool operator<(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	bool operator<=(const Fraction& rhs) const;
-	friend bool operator<=(const Fraction lhs, const int rhs);
-	friend bool operator<=(const int lhs, const Fraction rhs);
+	constexpr bool operator<=(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr bool operator<=(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr bool operator<=(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	bool operator>(const Fraction& rhs) const;
-	friend bool operator>(const Fraction lhs, const int rhs);
-	friend bool operator>(const int lhs, const Fraction rhs);
+	constexpr bool operator>(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr bool operator>(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr bool operator>(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	bool operator>=(const Fraction& rhs) const;
-	friend bool operator>=(const Fraction lhs, const int rhs);
-	friend bool operator>=(const int lhs, const Fraction rhs);
+	constexpr bool operator>=(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr bool operator>=(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr bool operator>=(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	Fraction operator+(const Fraction& rhs) const;
-	friend Fraction operator+(const Fraction lhs, const int rhs);
-	friend Fraction operator+(const int lhs, const Fraction rhs);
+	constexpr BasicFraction operator+(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr BasicFraction<T> operator+(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr BasicFraction<T> operator+(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	void operator+=(const Fraction& rhs);
-	friend void operator+=(Fraction &lhs, const int rhs);
+	constexpr BasicFraction& operator+=(const BasicFraction& rhs);
+	template <typename T> friend constexpr BasicFraction<T>& operator+=(BasicFraction<T>& lhs, const FractionInteger<T> rhs);
 
-	Fraction operator-(const Fraction& rhs) const;
-	friend Fraction operator-(const Fraction lhs, const int rhs);
-	friend Fraction operator-(const int lhs, const Fraction rhs);
+	constexpr BasicFraction operator-(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr BasicFraction<T> operator-(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr BasicFraction<T> operator-(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
 
-	void operator-=(const Fraction& rhs);
-	friend void operator-=(Fraction& lhs, const int rhs);
+	constexpr BasicFraction& operator-=(const BasicFraction& rhs);
+	template <typename T> friend constexpr BasicFraction<T>& operator-=(BasicFraction<T>& lhs, const FractionInteger<T> rhs);
 
-	Fraction operator*(const Fraction& rhs) const;
-	friend Fraction operator*(const Fraction lhs, const int rhs);
-	friend Fraction operator*(const int lhs, const Fraction rhs);
-	void operator*=(const Fraction& rhs);
-	void operator*=(const int rhs);
+	constexpr BasicFraction operator*(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr BasicFraction<T> operator*(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr BasicFraction<T> operator*(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
+	constexpr BasicFraction& operator*=(const BasicFraction& rhs);
+	constexpr BasicFraction& operator*=(const IntT rhs);
 	
-	Fraction operator/(const Fraction& rhs) const;
-	friend Fraction operator/(const Fraction lhs, const int rhs);
-	friend Fraction operator/(const int lhs, const Fraction rhs);
-	void operator/=(const Fraction& rhs);
-	void operator/=(const int rhs);
+	constexpr BasicFraction operator/(const BasicFraction& rhs) const;
+	template <typename T> friend constexpr BasicFraction<T> operator/(const BasicFraction<T>& lhs, const FractionInteger<T> rhs);
+	template <typename T> friend constexpr BasicFraction<T> operator/(const FractionInteger<T> lhs, const BasicFraction<T>& rhs);
+	constexpr BasicFraction& operator/=(const BasicFraction& rhs);
+	constexpr BasicFraction& operator/=(const IntT rhs);
 
 	// Stream Manipulation Operator Overloads
-	friend std::ostream& operator <<(std::ostream&, const Fraction&);
-	friend std::istream& operator >>(std::istream&, Fraction&);
+	template <typename T> friend std::ostream& operator <<(std::ostream&, const BasicFraction<T>&);
+	template <typename T> friend std::istream& operator >>(std::istream&, BasicFraction<T>&);
 	
 private:
-	int numerator;
-	int denominator;
-	void reduce();
-	int euclid(int num, int den);
+	template <typename> friend class BasicFractionArray;
+	template <typename> friend class BasicFractionView;
+	template <typename> friend class BasicLazyFraction;
+	template <typename, typename> friend class BasicCheckedFraction;
+	template <typename> friend struct fused::Finish;
+	struct ReducedTag {};
+
+	IntT numerator;
+	IntT denominator;
+	constexpr BasicFraction(IntT numerator, IntT denominator, ReducedTag);
+	constexpr void reduce();
+	constexpr IntT euclid(IntT num, IntT den);
+	static constexpr int compare(IntT lhsNum, IntT lhsDen, IntT rhsNum, IntT rhsDen);
+	template <typename U> static constexpr int compareMagnitudes(U lhsTop, U lhsBottom, U rhsTop, U rhsBottom);
+	template <typename U> static constexpr void approximate(U top, U bottom, U limit, U& p0, U& q0, U& p1, U& q1);
+	template <typename U> static constexpr BasicFraction fromApproximation(bool negative, U whole, U num, U den);
+	template <typename Float> Float toFloating() const;
+	constexpr void requireDenominator() const;
+	static constexpr std::uint64_t mix(std::uint64_t value);
+	static constexpr BasicFraction fromWide(WideInteger num, WideInteger den);
+	static constexpr BasicFraction sum(IntT a, IntT b, WideInteger c, IntT d);
+	static constexpr BasicFraction fromSum(WideInteger t, IntT g, IntT bg, IntT d);
+	static constexpr BasicFraction product(IntT a, IntT b, IntT c, IntT d);
+	static constexpr BasicFraction fromCancelled(WideInteger num, WideInteger den);
+	static constexpr BasicFraction sumInteger(const BasicFraction& lhs, WideInteger rhs);
+	static constexpr BasicFraction productInteger(const BasicFraction& lhs, IntT rhs);
+	static constexpr BasicFraction quotient(const BasicFraction& lhs, const BasicFraction& rhs);
+	static constexpr BasicFraction quotientInteger(const BasicFraction& lhs, IntT rhs);
 	
 };
 
+/**
+*	Outcome of BasicFraction::parse(). On failure, position is the offset of the offending character
+*	and value is a default constructed fraction.
+*/
+template <typename IntT>
+struct BasicFractionParseResult
+{
+	BasicFraction<IntT> value;
+	FractionParseError error;
+	std::size_t position;
+
+	explicit operator bool() const { return error == FractionParseError::None; }
+};
+
+// Drop-in name for the original int fraction, and the fixed width variants
+using Fraction = BasicFraction<int>;
+using Fraction32 = BasicFraction<std::int32_t>;
+using Fraction64 = BasicFraction<std::int64_t>;
+#ifdef __SIZEOF_INT128__
+using Fraction128 = BasicFraction<__int128>;
+#endif
+
+/**
+*	Fraction literals, brought in with using namespace fraction_literals. The integer is checked and
+*	converted at compile time, so 3_r / 4 is a constant expression: Fraction(3, 4) with no runtime cost.
+*/
+namespace fraction_literals {
+	template <char... Digits> constexpr Fraction operator""_r();
+	template <char... Digits> constexpr Fraction64 operator""_r64();
+}
+
+/**
+*	Lets fractions key the standard unordered containers, through BasicFraction::hash().
+*/
+namespace std {
+	template <typename IntT>
+	struct hash<BasicFraction<IntT>>
+	{
+		constexpr std::size_t operator()(const BasicFraction<IntT>& value) const noexcept {
+			return static_cast<std::size_t>(value.hash());
+		}
+	};
+}
+
+#include "Fraction.inl"
+
+// Instantiated once in Fraction.cpp
+extern template class BasicFraction<std::int32_t>;
+extern template class BasicFraction<std::int64_t>;
+#ifdef __SIZEOF_INT128__
+extern template class BasicFraction<__int128>;
+#endif
@@ -0,0 +1,1553 @@
+/**
+* @file		Fraction.inl
+* @author	Joseph Roy-Plommer
+* @date		2020-01-24
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements a mathematical fraction. Supports all the expected functionality of fractions.
+*  Included by Fraction.h, since BasicFraction is a template over its integer type.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+/**
+*	Constructs an object representing a mathematical fraction, with value 1/1.
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>::BasicFraction() : BasicFraction(1) {
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from the specified numerator.
+*
+*	@param numerator The numerator of the fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>::BasicFraction(IntT numerator) : BasicFraction(numerator, 1) {
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from the specified numerator and denominator.
+*
+*	@param numerator The numerator of the fraction
+*	@param denominator The denoinator of the fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>::BasicFraction(IntT numerator, IntT denominator) : numerator(numerator), denominator(denominator) {
+	FRACTION_COUNT(Construction);
+	reduce();
+}
+
+/**
+*	Constructs an object representing a mathematical fraction, from a compile-time std::ratio such as std::milli.
+*	std::ratio is already in simplest form with a positive denominator, so nothing is reduced.
+*
+*	@param ratio the ratio whose value the fraction takes; must fit IntT
+*/
+template <typename IntT>
+template <std::intmax_t Num, std::intmax_t Den>
+constexpr BasicFraction<IntT>::BasicFraction(std::ratio<Num, Den>) :
+	numerator(static_cast<IntT>(std::ratio<Num, Den>::num)), denominator(static_cast<IntT>(std::ratio<Num, Den>::den)) {
+	static_assert(static_cast<IntT>(std::ratio<Num, Den>::num) == std::ratio<Num, Den>::num
+		&& static_cast<IntT>(std::ratio<Num, Den>::den) == std::ratio<Num, Den>::den, "std::ratio does not fit the fraction's integer type");
+	FRACTION_COUNT(Construction);
+}
+
+/**
+*	Constructs a fraction from a numerator and denominator that are already in simplest form, skipping reduce().
+*	Constexpr, and therefore inline like every other arithmetic member, so that it still inlines into other classes
+*	despite the extern template declarations.
+*
+*	@param numerator The numerator of the fraction
+*	@param denominator The positive denominator of the fraction, coprime with the numerator
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>::BasicFraction(IntT numerator, IntT denominator, ReducedTag) : numerator(numerator), denominator(denominator) {
+	FRACTION_COUNT(Construction);
+}
+
+/**
+*	Returns the numerator of this fraction in simplest form. Carries the sign of the fraction.
+*
+*	@return the numerator
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::getNumerator() const {
+	return numerator;
+}
+
+/**
+*	Returns the denominator of this fraction in simplest form. Always positive.
+*
+*	@return the denominator
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::getDenominator() const {
+	return denominator;
+}
+
+/**
+*	Overrides equality operator, verifying that both the numerators and the denominators of the two fractions match.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if fractions are equal, false if not
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator==(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Equal);
+	return numerator == rhs.numerator && denominator == rhs.denominator;
+}
+
+/**
+*	Overrides inequality operator, verifying that not both the numerators and the denominators of the two fractions match.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean false if fractions are equal, true if not
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator!=(const BasicFraction& rhs) const {
+	FRACTION_COUNT(NotEqual);
+	return numerator != rhs.numerator || denominator != rhs.denominator;
+}
+
+/**
+*	Hashes this fraction. Fractions are always held reduced with a positive denominator, so equal values have
+*	identical terms and hash equally. The terms are taken as fixed width words, one 64 bit mixing round each, so
+*	hashes are the same on every platform; int fractions pack both terms into a single word.
+*
+*	@return a well mixed 64 bit hash, every bit of which depends on every bit of both terms
+*/
+template <typename IntT>
+constexpr std::uint64_t BasicFraction<IntT>::hash() const {
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	Unsigned num = static_cast<Unsigned>(numerator);
+	Unsigned den = static_cast<Unsigned>(denominator);
+	if constexpr (sizeof(IntT) <= sizeof(std::uint32_t))
+		return mix((static_cast<std::uint64_t>(num) << 32 | static_cast<std::uint32_t>(den)) ^ 0x9e3779b97f4a7c15ULL);
+	else {
+		std::uint64_t h = mix(static_cast<std::uint64_t>(den) ^ 0x9e3779b97f4a7c15ULL);
+		if constexpr (sizeof(IntT) > sizeof(std::uint64_t))
+			h = mix(h ^ static_cast<std::uint64_t>(den >> 64));
+		h = mix(h ^ static_cast<std::uint64_t>(num));
+		if constexpr (sizeof(IntT) > sizeof(std::uint64_t))
+			h = mix(h ^ static_cast<std::uint64_t>(num >> 64));
+		return h;
+	}
+}
+
+/**
+*	Final mixing function of SplitMix64 (after MurmurHash3's fmix64), a bijection on 64 bit words with full avalanche.
+*
+*	@param value the word to mix
+*	@return the mixed word
+*/
+template <typename IntT>
+constexpr std::uint64_t BasicFraction<IntT>::mix(std::uint64_t value) {
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+	return value ^ (value >> 31);
+}
+
+/**
+*	Splits a double into an odd integer mantissa and a power of two, value = +-mantissa * 2^exponent, exactly.
+*	Zero gives a zero mantissa.
+*
+*	@param value the double to split
+*	@param mantissa receives the magnitude of the integer part of the split, below 2^53
+*	@param exponent receives the power of two
+*	@throws std::domain_error if value is NaN or infinite
+*/
+inline void decomposeDouble(double value, std::uint64_t& mantissa, int& exponent) {
+	if (!std::isfinite(value))
+		throw std::domain_error("a NaN or infinite double has no fraction");
+	double fraction = std::frexp(std::fabs(value), &exponent);
+	mantissa = static_cast<std::uint64_t>(std::ldexp(fraction, 53));
+	exponent -= 53;
+	if (mantissa != 0) {
+		int zeros = gcd::countTrailingZeros(mantissa);
+		mantissa >>= zeros;
+		exponent += zeros;
+	}
+}
+
+/**
+*	Converts a double to the fraction with exactly its value. Every finite double is an integer times a power of two,
+*	so this succeeds whenever that integer and power fit IntT: 0.75 gives 3/4, while 0.1, which is
+*	3602879701896397/2^55, needs Fraction128.
+*
+*	@param value the double to convert
+*	@return the fraction equal to value
+*	@throws std::domain_error if value is NaN or infinite
+*	@throws std::overflow_error if the exact value needs a numerator or denominator beyond IntT
+*/
+template <typename IntT>
+BasicFraction<IntT> BasicFraction<IntT>::fromDouble(double value) {
+	using Bits = std::conditional_t<(sizeof(IntT) > 8), gcd::UnsignedOf<IntT>, std::uint64_t>;
+	constexpr int valueBits = static_cast<int>(sizeof(IntT) * 8) - 1;
+	std::uint64_t mantissa;
+	int exponent;
+	decomposeDouble(value, mantissa, exponent);
+	if (mantissa == 0)
+		return BasicFraction(0);
+	if (exponent >= 0) {
+		if (gcd::bitLength(mantissa) + exponent > valueBits + 1)
+			throw std::overflow_error("double is out of the range of the fraction");
+		return fromApproximation<Bits>(value < 0, static_cast<Bits>(mantissa) << exponent, 0, 1);
+	}
+	if (-exponent >= valueBits)
+		throw std::overflow_error("double needs a denominator beyond the range of the fraction");
+	return fromApproximation<Bits>(value < 0, 0, static_cast<Bits>(mantissa), static_cast<Bits>(1) << -exponent);
+}
+
+/**
+*	Converts a double to the closest fraction whose denominator is at most maxDenominator, the best rational
+*	approximation of the exact value of the double. The walk runs over the continued fraction of that exact value,
+*	so it takes O(log maxDenominator) steps and no floating point rounding enters the result; ties go to the smaller
+*	denominator. Whole numbers convert exactly.
+*
+*	@param value the double to convert
+*	@param maxDenominator positive bound on the denominator of the result
+*	@return the closest fraction with a denominator of at most maxDenominator
+*	@throws std::invalid_argument if maxDenominator is not positive
+*	@throws std::domain_error if value is NaN or infinite
+*	@throws std::overflow_error if the result is beyond the range of IntT
+*/
+template <typename IntT>
+BasicFraction<IntT> BasicFraction<IntT>::fromDouble(double value, IntT maxDenominator) {
+	if (maxDenominator < 1)
+		throw std::invalid_argument("maximum denominator must be positive");
+	using Bits = std::conditional_t<(sizeof(IntT) > 8), gcd::UnsignedOf<IntT>, std::uint64_t>;
+	constexpr int bits = static_cast<int>(sizeof(Bits) * 8);
+	std::uint64_t mantissa;
+	int exponent;
+	decomposeDouble(value, mantissa, exponent);
+	if (mantissa == 0 || exponent >= 0)
+		return fromDouble(value);
+
+	int shift = -exponent;
+	Bits limit = static_cast<Bits>(maxDenominator);
+	Bits whole = 0;
+	Bits p0 = 1, q0 = 0, p1 = 0, q1 = 1;
+	if (shift < bits) {
+		Bits bottom = static_cast<Bits>(1) << shift;
+		whole = static_cast<Bits>(mantissa) >> shift;
+		approximate<Bits>(bottom, static_cast<Bits>(mantissa) & (bottom - 1), limit, p0, q0, p1, q1);
+	}
+	else {
+		// Below 2^(53 - bits) the first complete quotient 2^shift / mantissa does not fit: long division finds it,
+		// saturating at 2 * limit, past which the answer no longer depends on it
+		Bits cap = 2 * limit;
+		Bits quotient = mantissa == 1 ? 1 : 0;
+		std::uint64_t remainder = mantissa == 1 ? 0 : 1;
+		for (int i = 0; i < shift; ++i) {
+			remainder <<= 1;
+			quotient = quotient > cap / 2 ? cap : quotient * 2;
+			if (remainder >= mantissa) {
+				remainder -= mantissa;
+				quotient = quotient < cap ? quotient + 1 : cap;
+			}
+		}
+		if (quotient > limit) {
+			// Only 0 and 1/limit are left, and 1/limit is closer when the quotient is below 2 * limit
+			if (quotient < cap) {
+				p1 = 1;
+				q1 = limit;
+			}
+		}
+		else {
+			p0 = 0;
+			q0 = 1;
+			p1 = 1;
+			q1 = quotient;
+			approximate<Bits>(mantissa, remainder, limit, p0, q0, p1, q1);
+		}
+	}
+	return fromApproximation<Bits>(value < 0, whole, p1, q1);
+}
+
+/**
+*	Returns the closest fraction to this one whose denominator is at most maxDenominator (its best rational
+*	approximation), found on the continued fraction of this fraction in O(log maxDenominator) steps. Ties go to
+*	the smaller denominator. A fraction whose denominator is already small enough is returned unchanged.
+*
+*	@param maxDenominator positive bound on the denominator of the result
+*	@return the closest fraction with a denominator of at most maxDenominator
+*	@throws std::invalid_argument if maxDenominator is not positive
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::limitDenominator(IntT maxDenominator) const {
+	if (maxDenominator < 1)
+		throw std::invalid_argument("maximum denominator must be positive");
+	if (denominator <= maxDenominator)
+		return *this;
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	Unsigned top = gcd::magnitude(numerator);
+	Unsigned bottom = static_cast<Unsigned>(denominator);
+	Unsigned p0 = 1, q0 = 0, p1 = 0, q1 = 1;
+	approximate<Unsigned>(bottom, top % bottom, static_cast<Unsigned>(maxDenominator), p0, q0, p1, q1);
+	return fromApproximation<Unsigned>(numerator < 0, top / bottom, p1, q1);
+}
+
+/**
+*	Converts this fraction to the closest double, rounding half to even like the hardware. Exact for every integer
+*	width: operands that are exact in a double take a single IEEE division, which is correctly rounded, and
+*	wider ones are divided in integer arithmetic (see toFloating()). A zero denominator gives an infinity, or NaN for 0/0.
+*
+*	@return the correctly rounded value of this fraction
+*/
+template <typename IntT>
+double BasicFraction<IntT>::toDouble() const {
+	return toFloating<double>();
+}
+
+/**
+*	Converts this fraction to the closest float, rounding half to even, with the same guarantees as toDouble().
+*
+*	@return the correctly rounded value of this fraction
+*/
+template <typename IntT>
+float BasicFraction<IntT>::toFloat() const {
+	return toFloating<float>();
+}
+
+/**
+*	Returns the largest integer not above this fraction, with integer arithmetic only.
+*
+*	@return the floor of this fraction
+*	@throws std::domain_error if the denominator is zero
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::floor() const {
+	requireDenominator();
+	IntT quotient = numerator / denominator;
+	return numerator % denominator < 0 ? quotient - 1 : quotient;
+}
+
+/**
+*	Returns the smallest integer not below this fraction, with integer arithmetic only.
+*
+*	@return the ceiling of this fraction
+*	@throws std::domain_error if the denominator is zero
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::ceil() const {
+	requireDenominator();
+	IntT quotient = numerator / denominator;
+	return numerator % denominator > 0 ? quotient + 1 : quotient;
+}
+
+/**
+*	Returns the integer part of this fraction, rounding towards zero.
+*
+*	@return this fraction without its fractional part
+*	@throws std::domain_error if the denominator is zero
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::trunc() const {
+	requireDenominator();
+	return numerator / denominator;
+}
+
+/**
+*	Returns the integer closest to this fraction, and the even one of the two when it is exactly halfway (banker's
+*	rounding, unlike std::round). The remainder r is compared with den - r rather than 2r with den, so nothing
+*	overflows.
+*
+*	@return this fraction rounded to the nearest integer, ties to even
+*	@throws std::domain_error if the denominator is zero
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::roundHalfEven() const {
+	requireDenominator();
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	IntT quotient = numerator / denominator;
+	IntT remainder = numerator % denominator;
+	Unsigned below = gcd::magnitude(remainder);
+	Unsigned above = static_cast<Unsigned>(denominator) - below;
+	if (below > above || (below == above && quotient % 2 != 0))
+		quotient += remainder < 0 ? -1 : 1;
+	return quotient;
+}
+
+/**
+*	Correctly rounded conversion behind toDouble() and toFloat().
+*	When both operands are exact in a double, one double division is correctly rounded.
+*	Rounding that quotient again to float is innocuous, since 53 >= 2 * 24 + 2 (Figueroa, 1995).
+*	Otherwise the magnitudes are scaled by a power of two so that divisor <= r < 2 * divisor.
+*	The significand and a guard bit then come from one division in WideInteger,
+*	or one bit at a time by shift and subtract for types without a wider type.
+*	They are rounded half to even on the guard bit and the sticky remainder.
+*	Results below the normal range get fewer significand bits, so ldexp() is exact.
+*
+*	@return the correctly rounded value of this fraction
+*/
+template <typename IntT>
+template <typename Float>
+Float BasicFraction<IntT>::toFloating() const {
+	if constexpr (sizeof(IntT) <= 4) {
+		return static_cast<Float>(static_cast<double>(numerator) / static_cast<double>(denominator));
+	}
+	else {
+		using Unsigned = gcd::UnsignedOf<IntT>;
+		constexpr Unsigned exact = Unsigned(1) << std::numeric_limits<double>::digits;
+		Unsigned n = gcd::magnitude(numerator);
+		Unsigned d = static_cast<Unsigned>(denominator);
+		if ((n <= exact && d <= exact) || n == 0 || d == 0)
+			return static_cast<Float>(static_cast<double>(numerator) / static_cast<double>(denominator));
+
+		// Scale to divisor <= r < 2 * divisor, so that the value is r / divisor * 2^exponent
+		int exponent = gcd::bitLength(n) - gcd::bitLength(d);
+		Unsigned r = exponent >= 0 ? n : n << -exponent;
+		Unsigned divisor = exponent >= 0 ? d << exponent : d;
+		if (r < divisor) {
+			if (exponent > 0)
+				divisor >>= 1;
+			else
+				r <<= 1;
+			--exponent;
+		}
+
+		constexpr int smallest = std::numeric_limits<Float>::min_exponent - 1;
+		int precision = std::numeric_limits<Float>::digits;
+		if (exponent < smallest)
+			precision -= smallest - exponent;
+		Float magnitude = 0;
+		if (precision >= 0) {
+			// precision significand bits and a guard bit, then round half to even with the remainder as sticky bit
+			std::uint64_t bits;
+			bool sticky;
+			if constexpr (sizeof(WideInteger) > sizeof(IntT)) {
+				using WideUnsigned = gcd::UnsignedOf<WideInteger>;
+				WideUnsigned scaled = static_cast<WideUnsigned>(r) << precision;
+				bits = static_cast<std::uint64_t>(scaled / divisor);
+				sticky = scaled % divisor != 0;
+			}
+			else {
+				// Branch-free shift and subtract, as the quotient bits are unpredictable
+				bits = 1;
+				r -= divisor;
+				for (int i = 0; i < precision; ++i) {
+					r <<= 1;
+					Unsigned fits = r >= divisor ? 1 : 0;
+					r -= divisor & (Unsigned(0) - fits);
+					bits = (bits << 1) | static_cast<std::uint64_t>(fits);
+				}
+				sticky = r != 0;
+			}
+			std::uint64_t significand = bits >> 1;
+			if ((bits & 1) != 0 && (sticky || (significand & 1) != 0))
+				++significand;
+			magnitude = std::ldexp(static_cast<Float>(significand), exponent - precision + 1);
+		}
+		return numerator < 0 ? -magnitude : magnitude;
+	}
+}
+
+/**
+*	Rejects fractions with a zero denominator, which only a division by zero produces, before integer rounding.
+*
+*	@throws std::domain_error if the denominator is zero
+*/
+template <typename IntT>
+constexpr void BasicFraction<IntT>::requireDenominator() const {
+	if (denominator == 0)
+		throw std::domain_error("fraction has a zero denominator");
+}
+
+/**
+*	Continued fraction walk behind fromDouble() and limitDenominator(). p0/q0 and p1/q1 are the last two convergents
+*	of a number in [0, 1) and top / bottom the complete quotient left to expand; the walk extends the convergents
+*	until the next denominator would pass limit. It leaves in p1/q1 the best approximation with a denominator of at
+*	most limit: the last convergent, or the largest semiconvergent (p0 + t p1) / (q0 + t q1) within the limit when
+*	that is strictly closer, which is when the complete quotient is below 2t + q0/q1. Numerators never exceed
+*	denominators, so nothing overflows.
+*
+*	@param top numerator of the complete quotient
+*	@param bottom denominator of the complete quotient; 0 once the expansion has ended
+*	@param limit largest denominator allowed
+*	@param p0 numerator of the convergent before the last
+*	@param q0 denominator of the convergent before the last
+*	@param p1 numerator of the last convergent, receives the numerator of the result
+*	@param q1 positive denominator of the last convergent, receives the denominator of the result
+*/
+template <typename IntT>
+template <typename U>
+constexpr void BasicFraction<IntT>::approximate(U top, U bottom, U limit, U& p0, U& q0, U& p1, U& q1) {
+	while (bottom != 0) {
+		U whole = top / bottom;
+		U remainder = top % bottom;
+		U steps = (limit - q0) / q1;
+		if (whole > steps) {
+			U excess = whole - steps;
+			if (excess < steps || (excess == steps && compareMagnitudes<U>(remainder, bottom, q0, q1) < 0)) {
+				p1 = p0 + steps * p1;
+				q1 = q0 + steps * q1;
+			}
+			return;
+		}
+		U p = p0 + whole * p1;
+		U q = q0 + whole * q1;
+		p0 = p1;
+		q0 = q1;
+		p1 = p;
+		q1 = q;
+		top = bottom;
+		bottom = remainder;
+	}
+}
+
+/**
+*	Builds the fraction +-(whole + num / den) from a best approximation, whose parts are coprime already.
+*
+*	@param negative whether the result is negative
+*	@param whole integer part of the magnitude
+*	@param num numerator of the fractional part, coprime to den
+*	@param den positive denominator of the fractional part
+*	@return the fraction in simplest form
+*	@throws std::overflow_error if the result is beyond the range of IntT
+*/
+template <typename IntT>
+template <typename U>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::fromApproximation(bool negative, U whole, U num, U den) {
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	U limit = static_cast<U>(static_cast<Unsigned>(~Unsigned(0)) >> 1) + (negative ? 1 : 0);
+	if (num > limit || whole > (limit - num) / den)
+		throw std::overflow_error("fraction is out of the range of the integer type");
+	Unsigned magnitude = static_cast<Unsigned>(whole * den + num);
+	IntT top = static_cast<IntT>(negative ? Unsigned(0) - magnitude : magnitude);
+	return BasicFraction(top, static_cast<IntT>(den), ReducedTag());
+}
+
+/**
+*	Compares this fraction with the provided one exactly, without converting either of them to floating point.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return a negative number if this fraction is smaller, 0 if they are equal, a positive number if this fraction is larger
+*/
+template <typename IntT>
+constexpr int BasicFraction<IntT>::compare(const BasicFraction& rhs) const {
+	FRACTION_COUNT(ThreeWay);
+	return compare(numerator, denominator, rhs.numerator, rhs.denominator);
+}
+
+/**
+*	Three-way comparison core behind every relational operator. Both denominators must be positive, which reduce() guarantees.
+*	Settles the comparison on the signs or on equal denominators when it can, and otherwise compares the
+*	cross products lhsNum * rhsDen and rhsNum * lhsDen in WideInteger so that they cannot overflow.
+*	Integer types without a wider type compare their continued fraction expansions instead, which never overflows.
+*
+*	@param lhsNum numerator of the left hand value
+*	@param lhsDen positive denominator of the left hand value
+*	@param rhsNum numerator of the right hand value
+*	@param rhsDen positive denominator of the right hand value
+*	@return -1 if the left hand value is smaller, 0 if the values are equal, 1 if the left hand value is larger
+*/
+template <typename IntT>
+constexpr int BasicFraction<IntT>::compare(IntT lhsNum, IntT lhsDen, IntT rhsNum, IntT rhsDen) {
+	// Sign early-out: a negative value is below zero, which is below a positive value
+	int lhsSign = (lhsNum > 0) - (lhsNum < 0);
+	int rhsSign = (rhsNum > 0) - (rhsNum < 0);
+	if (lhsSign != rhsSign || lhsSign == 0)
+		return (lhsSign > rhsSign) - (lhsSign < rhsSign);
+
+	if (lhsDen == rhsDen)
+		return (lhsNum > rhsNum) - (lhsNum < rhsNum);
+
+	if constexpr (sizeof(WideInteger) > sizeof(IntT)) {
+		WideInteger lhsCross = static_cast<WideInteger>(lhsNum) * rhsDen;
+		WideInteger rhsCross = static_cast<WideInteger>(rhsNum) * lhsDen;
+		return (lhsCross > rhsCross) - (lhsCross < rhsCross);
+	}
+	else {
+		using Unsigned = gcd::UnsignedOf<IntT>;
+		return lhsSign * compareMagnitudes<Unsigned>(gcd::magnitude(lhsNum), static_cast<Unsigned>(lhsDen), gcd::magnitude(rhsNum), static_cast<Unsigned>(rhsDen));
+	}
+}
+
+/**
+*	Compares two non-negative fractions through their continued fraction expansions, which never overflows:
+*	integer parts first, then the reciprocals of the remainders (which swaps the order), until they differ.
+*
+*	@param lhsTop numerator of the left hand value
+*	@param lhsBottom positive denominator of the left hand value
+*	@param rhsTop numerator of the right hand value
+*	@param rhsBottom positive denominator of the right hand value
+*	@return -1 if the left hand value is smaller, 0 if the values are equal, 1 if the left hand value is larger
+*/
+template <typename IntT>
+template <typename U>
+constexpr int BasicFraction<IntT>::compareMagnitudes(U lhsTop, U lhsBottom, U rhsTop, U rhsBottom) {
+	int order = 1;
+	for (;;) {
+		U lhsWhole = lhsTop / lhsBottom, rhsWhole = rhsTop / rhsBottom;
+		if (lhsWhole != rhsWhole)
+			return lhsWhole > rhsWhole ? order : -order;
+		U lhsRemainder = lhsTop % lhsBottom, rhsRemainder = rhsTop % rhsBottom;
+		if (lhsRemainder == 0 || rhsRemainder == 0)
+			return lhsRemainder != 0 ? order : (rhsRemainder != 0 ? -order : 0);
+		lhsTop = lhsBottom;
+		lhsBottom = lhsRemainder;
+		rhsTop = rhsBottom;
+		rhsBottom = rhsRemainder;
+		order = -order;
+	}
+}
+
+/**
+*	Overrides less than operator, checking that the value of num/den is larger for the other fraction than for this one.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if other fraction is greater than this one, false otherwise
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator<(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Less);
+	return compare(numerator, denominator, rhs.numerator, rhs.denominator) < 0;
+}
+
+/**
+*	Overrides less than operator, checking that the value of num/den is larger for the first fraction than for the second.
+*
+*	@param lhs left hand fraction for the comparison
+*	@param rhs right hand value to be compaired with the first
+*	@return boolean true if right hand value is greater than the left hand fraction, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator<(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(Less);
+	return BasicFraction<IntT>::compare(lhs.numerator, lhs.denominator, rhs, 1) < 0;
+}
+
+/**
+*	Overrides less than operator, checking that the value of num/den is larger for the second fraction than for the first.
+*
+*	@param lhs left hand value for the comparison
+*	@param rhs right hand fraction to be compaired with the first
+*	@return boolean true if right hand fraction is greater than the left hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator<(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(Less);
+	return BasicFraction<IntT>::compare(lhs, 1, rhs.numerator, rhs.denominator) < 0;
+}
+
+/**
+*	Overrides less than or equal to operator, checking that the value of num/den is larger (or equal) for the other fraction than for this one.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if other fraction is greater than or equal to this one, false otherwise
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator<=(const BasicFraction& rhs) const {
+	FRACTION_COUNT(LessEqual);
+	return compare(numerator, denominator, rhs.numerator, rhs.denominator) <= 0;
+}
+
+/**
+*	Overrides less than or equal to operator, checking that the value of num/den is larger (or equal) for the other fraction than for this one.
+*
+*	@param lhs left hand fraction for the comparison
+*	@param rhs right hand value to be compaired with the first
+*	@return boolean true if right hand value is greater than or equal to the left hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator<=(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(LessEqual);
+	return BasicFraction<IntT>::compare(lhs.numerator, lhs.denominator, rhs, 1) <= 0;
+}
+
+/**
+*	Overrides less than or equal to operator, checking that the value of num/den is larger (or equal) for the other fraction than for this one.
+*
+*	@param lhs left hand value for the comparison
+*	@param rhs right hand fraction to be compaired with the first
+*	@return boolean true if right hand value is greater than or equal to the left hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator<=(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(LessEqual);
+	return BasicFraction<IntT>::compare(lhs, 1, rhs.numerator, rhs.denominator) <= 0;
+}
+
+/**
+*	Overrides greater than operator, checking that the value of num/den is larger for the this fraction than for the other one.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if this fraction is greater than the other one, false otherwise
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator>(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Greater);
+	return compare(numerator, denominator, rhs.numerator, rhs.denominator) > 0;
+}
+/**
+*	Overrides greater than operator, checking that the value of num/den is larger for the first fraction than for the second.
+*
+*	@param lhs left hand fraction for the comparison
+*	@param rhs right hand value to be compaired with the first
+*	@return boolean true if left hand value is greater than the right hand fraction, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator>(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(Greater);
+	return BasicFraction<IntT>::compare(lhs.numerator, lhs.denominator, rhs, 1) > 0;
+}
+
+/**
+*	Overrides greater than operator, checking that the value of num/den is larger for the first fraction than for the second.
+*
+*	@param lhs left hand value for the comparison
+*	@param rhs right hand fraction to be compaired with the first
+*	@return boolean true if left hand fraction is greater than the right hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator>(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(Greater);
+	return BasicFraction<IntT>::compare(lhs, 1, rhs.numerator, rhs.denominator) > 0;
+}
+
+/**
+*	Overrides greater than or equal to operator, checking that the value of num/den is larger (or equal) for the this fraction than for this other one.
+*
+*	@param rhs other fraction to be compaired with this one
+*	@return boolean true if this fraction is greater than or equal to the other one, false otherwise
+*/
+template <typename IntT>
+constexpr bool BasicFraction<IntT>::operator>=(const BasicFraction& rhs) const {
+	FRACTION_COUNT(GreaterEqual);
+	return compare(numerator, denominator, rhs.numerator, rhs.denominator) >= 0;
+}
+
+/**
+*	Overrides greater than or equal to operator, checking that the value of num/den is larger (or equal) for the lhs fraction than for thie rhs.
+*
+*	@param lhs left hand fraction for the comparison
+*	@param rhs right hand value to be compaired with the first
+*	@return boolean true if left hand value is greater than or equal to the right hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator>=(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(GreaterEqual);
+	return BasicFraction<IntT>::compare(lhs.numerator, lhs.denominator, rhs, 1) >= 0;
+}
+
+/**
+*	Overrides greater than or equal to operator, checking that the value of num/den is larger (or equal) for the lhs fraction than for thie rhs.
+*
+*	@param lhs left hand fraction for the comparison
+*	@param rhs right hand value to be compaired with the first
+*	@return boolean true if left hand value is greater than or equal to the right hand value, false otherwise
+*/
+template <typename IntT>
+constexpr bool operator>=(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(GreaterEqual);
+	return BasicFraction<IntT>::compare(lhs, 1, rhs.numerator, rhs.denominator) >= 0;
+}
+
+/**
+*	Returns a new fraction which is the sum of this one and the provided one.
+*
+*	@param rhs fraction to be added to this one.
+*	@return the sum of this fraction and the provided one as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::operator+(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Add);
+	return sum(numerator, denominator, rhs.numerator, rhs.denominator);
+}
+
+/**
+*	Returns a new fraction which is the sum of two provided values.
+*
+*	@param lhs first fraction to be added to the second
+*	@param rhs second fraction to be added to the first
+*	@return the sum of the provided values as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator+(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(AddInteger);
+	return BasicFraction<IntT>::sumInteger(lhs, rhs);
+}
+
+/**
+*	Returns a new fraction which is the sum of two provided values.
+*
+*	@param lhs first fraction to be added to the second
+*	@param rhs second fraction to be added to the first
+*	@return the sum of the provided values as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator+(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(AddInteger);
+	return BasicFraction<IntT>::sumInteger(rhs, lhs);
+}
+
+/**
+*	Replaces this fraction with a new fraction which is the sum of this one and the provided fraction.
+*
+*	@param rhs fraction to be added to this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator+=(const BasicFraction& rhs) {
+	FRACTION_COUNT(AddAssign);
+	*this = sum(numerator, denominator, rhs.numerator, rhs.denominator);
+	return *this;
+}
+
+/**
+*	Replaces provided fraction with a new one which is the sum of the provided fraction and the provided integer value (interpreted as a fraction).
+*
+*	@param lhs fraction to be added to
+*	@param rhs integer to be added (as a fraction) to lhs fraction
+*	@return a reference to lhs, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& operator+=(BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(AddAssignInteger);
+	lhs = BasicFraction<IntT>::sumInteger(lhs, rhs);
+	return lhs;
+}
+
+/**
+*	Returns a new fraction which is the difference between this one and the provided one.
+*
+*	@param rhs fraction to be subtracted from this one.
+*	@return the difference between this fraction and the provided one as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::operator-(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Subtract);
+	return sum(numerator, denominator, -WideInteger(rhs.numerator), rhs.denominator);
+}
+
+/**
+*	Returns a new fraction which is the differencebetween two provided values.
+*
+*	@param lhs first fraction to be subtracted from
+*	@param rhs second fraction to be subtracted from the first
+*	@return the difference between the provided values as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator-(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(SubtractInteger);
+	using Wide = typename BasicFraction<IntT>::WideInteger;
+	return BasicFraction<IntT>::sumInteger(lhs, -Wide(rhs));
+}
+
+/**
+*	Returns a new fraction which is the difference between the two provided values.
+*
+*	@param lhs integer representing the first fraction to be subtracted from
+*	@param rhs second fraction to be subtracted from the first
+*	@return the difference between the provided values as a new Fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator-(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(SubtractInteger);
+	using Wide = typename BasicFraction<IntT>::WideInteger;
+	return BasicFraction<IntT>::fromCancelled(Wide(lhs) * rhs.denominator - rhs.numerator, rhs.denominator);
+}
+
+/**
+*	Replaces this fraction with a new fraction which is the difference this one and the provided fraction.
+*
+*	@param rhs fraction to be subtracted from this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator-=(const BasicFraction& rhs) {
+	FRACTION_COUNT(SubtractAssign);
+	*this = sum(numerator, denominator, -WideInteger(rhs.numerator), rhs.denominator);
+	return *this;
+}
+
+/**
+*	Replaces provided fraction with a new one which is the difference between the provided fraction and the provided integer value (interpreted as a fraction).
+*
+*	@param lhs fraction to be subtracted from
+*	@param rhs integer (interpreted as a fraction) to be subtracted from lhs fraction
+*	@return a reference to lhs, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& operator-=(BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(SubtractAssignInteger);
+	using Wide = typename BasicFraction<IntT>::WideInteger;
+	lhs = BasicFraction<IntT>::sumInteger(lhs, -Wide(rhs));
+	return lhs;
+}
+
+/**
+*	Multiplies this fraction by the provided fraction and returns result as a new Fraction.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return a new fraction which is the product of this fraction and the one provided
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::operator*(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Multiply);
+	return product(numerator, denominator, rhs.numerator, rhs.denominator);
+}
+
+/**
+*	Multiplies first provided fraction by the provided int (interpreted as a fraction) and returns result as a new Fraction.
+*
+*	@param lhs first fraction to be multiplied
+*	@param rhs integer (interpreted as a fraction) to be multiplied by the first fraction
+*	@return a new fraction which is the product of the two provided values
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator*(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(MultiplyInteger);
+	return BasicFraction<IntT>::productInteger(lhs, rhs);
+}
+
+/**
+*	Multiplies first provided int (interpreted as a fraction) by the provided fraction and returns result as a new Fraction.
+*
+*	@param lhs first integer (interpreted as a fraction) to be multiplied
+*	@param rhs fraction to be multiplied by the first value
+*	@return a new fraction which is the product of the two provided values
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator*(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(MultiplyInteger);
+	return BasicFraction<IntT>::productInteger(rhs, lhs);
+}
+
+/**
+*	Replaces this fraction with a new fraction which is the sum of this one and the provided one.
+*
+*	@param rhs fraction to be multiplied by this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator*=(const BasicFraction& rhs) {
+	FRACTION_COUNT(MultiplyAssign);
+	*this = product(numerator, denominator, rhs.numerator, rhs.denominator);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with a new fraction which is the sum of this one and the provided int (interpreted as a fraction).
+*
+*	@param rhs int (interpreted as a fraction) to be multiplied by this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator*=(const IntT rhs) {
+	FRACTION_COUNT(MultiplyAssignInteger);
+	*this = productInteger(*this, rhs);
+	return *this;
+}
+
+/**
+*	Divides this fraction by the provided fraction and returns result as a new Fraction.
+*
+*	@param rhs fraction to be divided into this one
+*	@return a new fraction which is this fraction divided by the one provided
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::operator/(const BasicFraction& rhs) const {
+	FRACTION_COUNT(Divide);
+	return quotient(*this, rhs);
+}
+
+/**
+*	Divides first provided fraction by the provided int (interpreted as a fraction) and returns result as a new Fraction.
+*
+*	@param lhs first fraction to be divided into
+*	@param rhs integer (interpreted as a fraction) to be divided into the first fraction
+*	@return a new fraction which is the result of dividing the two provided values
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator/(const BasicFraction<IntT>& lhs, const FractionInteger<IntT> rhs) {
+	FRACTION_COUNT(DivideInteger);
+	return BasicFraction<IntT>::quotientInteger(lhs, rhs);
+}
+
+/**
+*	Divides first provided int (interpreted as a fraction) by the provided fraction and returns result as a new Fraction.
+*
+*	@param lhs first integer (interpreted as a fraction) to be divided into
+*	@param rhs fraction to be divided into the first value
+*	@return a new fraction which is the result of dividing the two provided values
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> operator/(const FractionInteger<IntT> lhs, const BasicFraction<IntT>& rhs) {
+	FRACTION_COUNT(DivideInteger);
+	using Wide = typename BasicFraction<IntT>::WideInteger;
+	if (rhs.numerator == 0)
+		return BasicFraction<IntT>::fromWide(Wide(lhs) * rhs.denominator, 0);
+	IntT common = static_cast<IntT>(gcd::compute(lhs, rhs.numerator));
+	return BasicFraction<IntT>::fromCancelled(Wide(lhs / common) * rhs.denominator, rhs.numerator / common);
+}
+
+/**
+*	Replaces this fraction with a new fraction which is this one divided by the provided one.
+*
+*	@param rhs fraction to be divided into this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator/=(const BasicFraction& rhs) {
+	FRACTION_COUNT(DivideAssign);
+	*this = quotient(*this, rhs);
+	return *this;
+}
+
+/**
+*	Replaces this fraction with a new fraction which is one divided by the provided int (interpreted as a fraction).
+*
+*	@param rhs int (interpreted as a fraction) to be divided into this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT>& BasicFraction<IntT>::operator/=(const IntT rhs) {
+	FRACTION_COUNT(DivideAssignInteger);
+	*this = quotientInteger(*this, rhs);
+	return *this;
+}
+
+/**
+*	Tells whether a character separates fractions. Spelled out instead of std::isspace to stay clear of locales.
+*
+*	@param c character to test
+*	@return true for space, tab, newline, carriage return, vertical tab and form feed
+*/
+inline bool isFractionSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+*	Formats an integer into a character buffer. Types std::to_chars does not know (__int128) are written digit by digit.
+*
+*	@param first start of the buffer
+*	@param last end of the buffer
+*	@param value integer to be written
+*	@return where writing stopped, and an error if the buffer was too small
+*/
+template <typename IntT>
+std::to_chars_result formatFractionInteger(char* first, char* last, IntT value) {
+	if constexpr (std::is_integral<IntT>::value && sizeof(IntT) <= sizeof(long long)) {
+		return std::to_chars(first, last, value);
+	}
+	else {
+		char digits[48];
+		char* digit = digits + sizeof(digits);
+		auto magnitude = gcd::magnitude(value);
+		do {
+			*--digit = static_cast<char>('0' + static_cast<int>(magnitude % 10));
+			magnitude /= 10;
+		} while (magnitude != 0);
+		std::size_t length = static_cast<std::size_t>(digits + sizeof(digits) - digit) + (value < 0 ? 1 : 0);
+		if (static_cast<std::size_t>(last - first) < length)
+			return { last, std::errc::value_too_large };
+		if (value < 0)
+			*first++ = '-';
+		for (; digit != digits + sizeof(digits); ++digit)
+			*first++ = *digit;
+		return { first, std::errc() };
+	}
+}
+
+/**
+*	Parses an optionally signed decimal integer. Types std::from_chars does not know (__int128) are read digit by digit.
+*	Unlike std::from_chars, a leading '+' is accepted, as stream extraction accepts it.
+*
+*	@param first start of the text
+*	@param last end of the text
+*	@param value integer receiving the value read
+*	@return where parsing stopped, and invalid_argument or result_out_of_range on failure
+*/
+template <typename IntT>
+std::from_chars_result parseFractionInteger(const char* first, const char* last, IntT& value) {
+	if (last - first > 1 && first[0] == '+' && first[1] >= '0' && first[1] <= '9')
+		++first;
+	if constexpr (std::is_integral<IntT>::value && sizeof(IntT) <= sizeof(long long)) {
+		return std::from_chars(first, last, value);
+	}
+	else {
+		using Unsigned = gcd::UnsignedOf<IntT>;
+		const char* position = first;
+		bool negative = position != last && *position == '-';
+		if (negative)
+			++position;
+
+		Unsigned limit = (Unsigned(-1) >> 1) + (negative ? 1 : 0);
+		Unsigned magnitude = 0;
+		bool overflow = false;
+		const char* digits = position;
+		for (; position != last && *position >= '0' && *position <= '9'; ++position) {
+			unsigned digit = static_cast<unsigned>(*position - '0');
+			if (magnitude > (limit - digit) / 10)
+				overflow = true;
+			else
+				magnitude = magnitude * 10 + digit;
+		}
+		if (position == digits)
+			return { first, std::errc::invalid_argument };
+		if (overflow)
+			return { position, std::errc::result_out_of_range };
+		value = static_cast<IntT>(negative ? Unsigned(0) - magnitude : magnitude);
+		return { position, std::errc() };
+	}
+}
+
+/**
+*	Parses one fraction, "num/den" or a whole number, with optional whitespace before it and around the '/'.
+*	The parts are returned as written; nothing is reduced.
+*
+*	@param first start of the text
+*	@param last end of the text
+*	@param num receives the numerator
+*	@param den receives the denominator (1 for a whole number)
+*	@param end receives where parsing stopped: just past the fraction, or at the offending character
+*	@return FractionParseError::None on success, otherwise the reason for the failure
+*/
+template <typename IntT>
+FractionParseError parseFractionParts(const char* first, const char* last, IntT& num, IntT& den, const char*& end) {
+	while (first != last && isFractionSpace(*first))
+		++first;
+	std::from_chars_result result = parseFractionInteger(first, last, num);
+	if (result.ec != std::errc()) {
+		end = result.ptr;
+		return result.ec == std::errc::result_out_of_range ? FractionParseError::OutOfRange : FractionParseError::ExpectedNumerator;
+	}
+
+	const char* slash = result.ptr;
+	while (slash != last && isFractionSpace(*slash))
+		++slash;
+	if (slash == last || *slash != '/') {
+		den = 1;
+		end = result.ptr;
+		return FractionParseError::None;
+	}
+
+	const char* position = slash + 1;
+	while (position != last && isFractionSpace(*position))
+		++position;
+	result = parseFractionInteger(position, last, den);
+	end = result.ptr;
+	if (result.ec != std::errc())
+		return result.ec == std::errc::result_out_of_range ? FractionParseError::OutOfRange : FractionParseError::ExpectedDenominator;
+	return FractionParseError::None;
+}
+
+/**
+*	Parses a fraction from text: "num/den" or a whole number, with optional surrounding whitespace.
+*	The whole text must be consumed.
+*
+*	@param text the text to parse
+*	@return the reduced fraction on success, otherwise the error and the offset of the offending character
+*/
+template <typename IntT>
+BasicFractionParseResult<IntT> BasicFraction<IntT>::parse(std::string_view text) {
+	const char* first = text.data();
+	const char* last = first + text.size();
+	const char* end = first;
+	IntT num = 0;
+	IntT den = 1;
+	FractionParseError error = parseFractionParts(first, last, num, den, end);
+	if (error == FractionParseError::None) {
+		while (end != last && isFractionSpace(*end))
+			++end;
+		if (end != last)
+			error = FractionParseError::TrailingCharacters;
+	}
+	std::size_t position = static_cast<std::size_t>(end - first);
+	if (error != FractionParseError::None)
+		return { BasicFraction(), error, position };
+	return { BasicFraction(num, den), error, position };
+}
+
+/**
+*	Writes the fraction as "num/den" followed by a terminating null character.
+*
+*	@param buffer destination with room for at least kFormatBufferSize characters
+*	@return the number of characters written, not counting the null character
+*/
+template <typename IntT>
+std::size_t BasicFraction<IntT>::format(char* buffer) const {
+	char* last = buffer + kFormatBufferSize;
+	char* position = formatFractionInteger(buffer, last, numerator).ptr;
+	*position++ = '/';
+	position = formatFractionInteger(position, last, denominator).ptr;
+	*position = '\0';
+	return static_cast<std::size_t>(position - buffer);
+}
+
+/**
+*	Pulls the characters of one fraction out of a stream and parses them with parseFractionParts(),
+*	so that the stream operators accept exactly what parse() accepts. Sets failbit when they do not form a fraction.
+*
+*	@param is inputstream that the fraction is extracted from
+*	@param num receives the numerator
+*	@param den receives the denominator
+*	@return true if a fraction was read
+*/
+template <typename IntT>
+bool extractFractionParts(std::istream& is, IntT& num, IntT& den) {
+	char buffer[128];
+	std::size_t length = 0;
+	auto takeInteger = [&] {
+		is >> std::ws;
+		for (int c = is.peek(); length < sizeof(buffer) && c != EOF && ((c >= '0' && c <= '9') || c == '-' || c == '+'); c = is.peek())
+			buffer[length++] = static_cast<char>(is.get());
+	};
+
+	takeInteger();
+	if (is.good()) {
+		is >> std::ws;
+		if (is.peek() == '/' && length < sizeof(buffer)) {
+			buffer[length++] = static_cast<char>(is.get());
+			takeInteger();
+		}
+	}
+
+	const char* end = buffer;
+	if (parseFractionParts(buffer, buffer + length, num, den, end) != FractionParseError::None || end != buffer + length) {
+		is.setstate(std::ios::failbit);
+		return false;
+	}
+	return true;
+}
+
+/**
+*	Overrides the stream insertion operator by inserting a string representation of the fraction and returning the stream.
+*
+*	@param os outputstream that the fraction string is written to
+*	@param rhs fraction whos string representation is inserted into the outputstream
+*	@return the provided outputstream after inserting into it
+*/
+template <typename IntT>
+std::ostream& operator <<(std::ostream& os, const BasicFraction<IntT>& rhs) {
+	char buffer[BasicFraction<IntT>::kFormatBufferSize];
+	return os.write(buffer, static_cast<std::streamsize>(rhs.format(buffer)));
+}
+
+/**
+*	Overrides the stream extraction operator by extracting a string representation of the fraction from it, assigning these values to a fraction and returning the stream.
+*	Accepts what parse() accepts; on failure the fraction is left unchanged and failbit is set.
+*
+*	@param is inputstream that the fraction string is extracted from
+*	@param rhs fraction whos values are set from the contents of the provided fraction
+*	@return the provided inputstream after extracting from it
+*/
+template <typename IntT>
+std::istream& operator >>(std::istream& is, BasicFraction<IntT>& rhs) {
+	IntT num = 0;
+	IntT den = 1;
+	if (extractFractionParts(is, num, den))
+		rhs = BasicFraction<IntT>(num, den);
+	return is;
+}
+
+/**
+*	Puts this fraction into its simplest form.
+*	uses the configured gcd kernel (see Gcd.h) to find largst common divisor (gcd) of the numerator and denominator of this fraction.
+*	Divides numerator and denominator by the gcd to put this fraction into its simplest form.
+*	Makes sure the -ve character is attached to the numerator (not the denominator) in negative fractions.
+*/
+template <typename IntT>
+constexpr void BasicFraction<IntT>::reduce() {
+	FRACTION_COUNT(Reduce);
+	// Reduced Form
+	IntT gcd = euclid(numerator, denominator);
+	if (gcd != 0) {
+		numerator /= gcd;
+		denominator /= gcd;
+	}
+
+	if (denominator < 0) {
+		FRACTION_COUNT(SignFlip);
+		denominator *= -1;
+		numerator *= -1;
+	}
+}
+
+/**
+*	Finds the greatest common divisor of thw provided numbers using the gcd kernel selected in Gcd.h
+*	(binary GCD unless FRACTION_GCD_KERNEL says otherwise).
+*
+*	@param num numerator of a fraction
+*	@param den denominator of a fraction
+*	@return the non-negative greatest common divisor of the two provided numbers (0 if both are 0)
+*/
+template <typename IntT>
+constexpr IntT BasicFraction<IntT>::euclid(IntT num, IntT den) {
+	return static_cast<IntT>(gcd::compute(num, den));
+}
+
+/**
+*	Builds a fraction in simplest form from a numerator and denominator computed in WideInteger.
+*	The value is reduced in the wide type first, so that a result which fits into IntT after reduction comes out exact.
+*
+*	@param num numerator of the result, possibly wider than IntT
+*	@param den denominator of the result, possibly wider than IntT
+*	@return the reduced fraction
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::fromWide(WideInteger num, WideInteger den) {
+	FRACTION_COUNT(Reduce);
+	WideInteger gcd = static_cast<WideInteger>(gcd::compute(num, den));
+	if (gcd != 0) {
+		num /= gcd;
+		den /= gcd;
+	}
+
+	if (den < 0) {
+		FRACTION_COUNT(SignFlip);
+		den *= -1;
+		num *= -1;
+	}
+	return BasicFraction(static_cast<IntT>(num), static_cast<IntT>(den), ReducedTag());
+}
+
+/**
+*	Adds a/b and c/d, where a/b and c/d are in simplest form with positive denominators (Henrici's algorithm,
+*	Knuth TAOCP vol. 2, 4.5.1). With g = gcd(b, d), the cross products only need b/g and d/g, and the sum t only
+*	has to be divided by gcd(t, g) rather than by a gcd against the full product of the denominators.
+*	Coprime denominators (g = 1) give a result that is already in simplest form, and equal denominators only
+*	need gcd(a + c, b). Only the final gcd can involve values wider than IntT.
+*	As in product(), types whose WideInteger is a native register keep the single gcd of the full products
+*	for unequal denominators, which measures faster there than two gcds and four divisions.
+*
+*	@param a numerator of the left hand value
+*	@param b denominator of the left hand value
+*	@param c numerator of the right hand value, negated by operator-
+*	@param d denominator of the right hand value
+*	@return the reduced sum
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::sum(IntT a, IntT b, WideInteger c, IntT d) {
+	if (b == d)
+		return fromSum(a + c, b, 1, b);
+	if constexpr (sizeof(WideInteger) > sizeof(IntT) && sizeof(WideInteger) <= sizeof(long long))
+		return fromWide(WideInteger(a) * d + c * b, WideInteger(b) * d);
+	IntT g = static_cast<IntT>(gcd::compute(b, d));
+	if (g == 1)
+		return fromCancelled(WideInteger(a) * d + c * b, WideInteger(b) * d);
+	IntT bg = b / g;
+	return fromSum(WideInteger(a) * (d / g) + c * bg, g, bg, d);
+}
+
+/**
+*	Finishes a sum t / (bg * d) whose only possible common factors are those of g, dividing them out of t and d.
+*	When t fits IntT, as it does unless the operands are near the limits, the gcd and divisions run in IntT.
+*
+*	@param t numerator of the sum
+*	@param g the factor the sum may still share with its denominator
+*	@param bg the part of the denominator that is coprime with t
+*	@param d the part of the denominator that may share factors of g with t
+*	@return the reduced sum
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::fromSum(WideInteger t, IntT g, IntT bg, IntT d) {
+	if (t == 0)
+		return BasicFraction(0, 1, ReducedTag());
+	IntT narrow = static_cast<IntT>(t);
+	if (narrow == t) {
+		IntT common = static_cast<IntT>(gcd::compute(narrow, g));
+		return fromCancelled(narrow / common, WideInteger(bg) * (d / common));
+	}
+	WideInteger common = static_cast<WideInteger>(gcd::compute(t, static_cast<WideInteger>(g)));
+	return fromCancelled(t / common, WideInteger(bg) * static_cast<IntT>(d / common));
+}
+
+/**
+*	Multiplies a/b by c/d, where a/b and c/d are in simplest form and b is positive, d is non-zero.
+*	Cancelling gcd(a, d) and gcd(c, b) before multiplying leaves a product that is already in simplest form,
+*	so the gcds run on the operands instead of on their products and no final reduce is needed. The smaller
+*	products also overflow WideInteger less often for types without a wider native type.
+*	Types whose WideInteger is a native register (int into long long) keep the single gcd of the products,
+*	which measures faster there than two gcds on the operands.
+*
+*	@param a numerator of the left hand value
+*	@param b positive denominator of the left hand value
+*	@param c numerator of the right hand value
+*	@param d denominator of the right hand value; negative when dividing by a negative fraction
+*	@return the reduced product
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::product(IntT a, IntT b, IntT c, IntT d) {
+	if constexpr (sizeof(WideInteger) > sizeof(IntT) && sizeof(WideInteger) <= sizeof(long long)) {
+		return fromWide(WideInteger(a) * c, WideInteger(b) * d);
+	}
+	else {
+		IntT ad = static_cast<IntT>(gcd::compute(a, d));
+		IntT cb = static_cast<IntT>(gcd::compute(c, b));
+		return fromCancelled(WideInteger(a / ad) * (c / cb), WideInteger(b / cb) * (d / ad));
+	}
+}
+
+/**
+*	Builds a fraction from a numerator and denominator that have no common factor, only moving the sign onto the numerator.
+*
+*	@param num numerator of the result
+*	@param den non-zero denominator of the result, coprime with num
+*	@return the fraction, without running a gcd
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::fromCancelled(WideInteger num, WideInteger den) {
+	if (den < 0) {
+		FRACTION_COUNT(SignFlip);
+		num = -num;
+		den = -den;
+	}
+	return BasicFraction(static_cast<IntT>(num), static_cast<IntT>(den), ReducedTag());
+}
+
+/**
+*	Adds a whole number to a fraction. The numerator changes by a multiple of the denominator, which cannot introduce
+*	a common factor, so no gcd is needed. Shared by the integer forms of +, - and their compound assignments, which
+*	only differ in what they count.
+*
+*	@param lhs the fraction
+*	@param rhs the whole number, negated by the subtracting forms
+*	@return the sum
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::sumInteger(const BasicFraction& lhs, WideInteger rhs) {
+	return fromCancelled(WideInteger(lhs.numerator) + WideInteger(lhs.denominator) * rhs, lhs.denominator);
+}
+
+/**
+*	Multiplies a fraction by a whole number, cancelling the gcd of the whole number and the denominator first.
+*
+*	@param lhs the fraction
+*	@param rhs the whole number
+*	@return the product, in simplest form
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::productInteger(const BasicFraction& lhs, IntT rhs) {
+	IntT common = static_cast<IntT>(gcd::compute(rhs, lhs.denominator));
+	return fromCancelled(WideInteger(lhs.numerator) * (rhs / common), lhs.denominator / common);
+}
+
+/**
+*	Divides one fraction by another by multiplying with its reciprocal. A zero divisor keeps the unreduced n/0 result.
+*
+*	@param lhs the dividend
+*	@param rhs the divisor
+*	@return the quotient
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::quotient(const BasicFraction& lhs, const BasicFraction& rhs) {
+	if (rhs.numerator == 0)
+		return fromWide(WideInteger(lhs.numerator) * rhs.denominator, 0);
+	return product(lhs.numerator, lhs.denominator, rhs.denominator, rhs.numerator);
+}
+
+/**
+*	Divides a fraction by a whole number, cancelling the gcd of the whole number and the numerator first.
+*
+*	@param lhs the dividend
+*	@param rhs the whole number divisor; zero keeps the unreduced n/0 result
+*	@return the quotient
+*/
+template <typename IntT>
+constexpr BasicFraction<IntT> BasicFraction<IntT>::quotientInteger(const BasicFraction& lhs, IntT rhs) {
+	if (rhs == 0)
+		return fromWide(lhs.numerator, 0);
+	IntT common = static_cast<IntT>(gcd::compute(lhs.numerator, rhs));
+	return fromCancelled(lhs.numerator / common, WideInteger(lhs.denominator) * (rhs / common));
+}
+
+/**
+*	Reads the digits of a fraction literal at compile time, with the base given by its prefix as for any C++
+*	integer literal: 0x for hexadecimal, 0b for binary and a leading 0 for octal. Digit separators are skipped.
+*
+*	@return the value of the digits, or -1 if they are not an integer literal that fits IntT
+*/
+template <typename IntT, char... Digits>
+constexpr IntT fractionLiteralValue() {
+	using Unsigned = gcd::UnsignedOf<IntT>;
+	constexpr Unsigned limit = Unsigned(-1) >> 1;
+	constexpr char text[] = { Digits... };
+	constexpr std::size_t length = sizeof...(Digits);
+	Unsigned base = 10;
+	std::size_t first = 0;
+	if (length > 1 && text[0] == '0') {
+		bool hex = text[1] == 'x' || text[1] == 'X';
+		bool binary = text[1] == 'b' || text[1] == 'B';
+		base = hex ? 16 : binary ? 2 : 8;
+		first = hex || binary ? 2 : 1;
+	}
+
+	Unsigned value = 0;
+	for (std::size_t i = first; i < length; ++i) {
+		char digit = text[i];
+		if (digit == '\'')
+			continue;
+		Unsigned next = base;
+		if (digit >= '0' && digit <= '9')
+			next = static_cast<Unsigned>(digit - '0');
+		else if (digit >= 'a' && digit <= 'f')
+			next = static_cast<Unsigned>(digit - 'a' + 10);
+		else if (digit >= 'A' && digit <= 'F')
+			next = static_cast<Unsigned>(digit - 'A' + 10);
+		if (next >= base || value > (limit - next) / base)
+			return -1;
+		value = value * base + next;
+	}
+	return static_cast<IntT>(value);
+}
+
+namespace fraction_literals {
+
+	/**
+	*	Makes a Fraction from an integer literal, so that 3_r / 4 is the constant Fraction(3, 4).
+	*
+	*	@return the whole number as a Fraction
+	*/
+	template <char... Digits>
+	constexpr Fraction operator""_r() {
+		constexpr int value = fractionLiteralValue<int, Digits...>();
+		static_assert(value >= 0, "_r takes an integer literal that fits Fraction");
+		return Fraction(value);
+	}
+
+	/**
+	*	Makes a Fraction64 from an integer literal, so that 3_r64 / 4 is the constant Fraction64(3, 4).
+	*
+	*	@return the whole number as a Fraction64
+	*/
+	template <char... Digits>
+	constexpr Fraction64 operator""_r64() {
+		constexpr std::int64_t value = fractionLiteralValue<std::int64_t, Digits...>();
+		static_assert(value >= 0, "_r64 takes an integer literal that fits Fraction64");
+		return Fraction64(value);
+	}
+}
@@ -0,0 +1,217 @@
+#pragma once
+/**
+* @file		FractionArray.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Structure-of-arrays container for fractions. Numerators and denominators live in separate contiguous,
+*  cache-line aligned buffers, and the batched kernels work on whole arrays in loops the compiler can vectorise.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "Fraction.h"
+#include "GcdBatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+*	Allocator handing out storage aligned to the provided boundary, so that batched kernels start on a cache line.
+*/
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator
+{
+	using value_type = T;
+	template <typename U> struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+	AlignedAllocator() = default;
+	template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+	T* allocate(std::size_t count) {
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+	}
+
+	void deallocate(T* pointer, std::size_t) {
+		::operator delete(pointer, std::align_val_t(Alignment));
+	}
+
+	template <typename U> bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+	template <typename U> bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+/**
+*	Outcome of BasicFractionArray::appendParsed(). On failure, position is the offset of the offending character
+*	and count is the number of fractions appended before it.
+*/
+struct FractionBulkParseResult
+{
+	std::size_t count;
+	FractionParseError error;
+	std::size_t position;
+
+	explicit operator bool() const { return error == FractionParseError::None; }
+};
+
+/**
+*	Non-owning view of numerator and denominator columns holding fractions in simplest form, such as the
+*	columns of a FractionArray or of a memory-mapped fraction file. The batched kernels read their operands through it.
+*/
+template <typename IntT>
+class BasicFractionView
+{
+
+public:
+	BasicFractionView(const IntT* numerators, const IntT* denominators, std::size_t count);
+
+	std::size_t size() const;
+	const IntT* numerators() const;
+	const IntT* denominators() const;
+	BasicFraction<IntT> operator[](std::size_t index) const;
+
+private:
+	const IntT* numeratorData;
+	const IntT* denominatorData;
+	std::size_t count;
+
+};
+
+template <typename IntT>
+class BasicFractionArray
+{
+	static_assert(sizeof(typename BasicFraction<IntT>::WideInteger) > sizeof(IntT),
+		"the blocked kernels compute in the wide type, so IntT needs a wider native type");
+
+public:
+	using Integer = IntT;
+	using WideInteger = typename BasicFraction<IntT>::WideInteger;
+	using Element = BasicFraction<IntT>;
+	using Column = std::vector<IntT, AlignedAllocator<IntT, 64>>;
+	using Mask = std::vector<std::uint8_t>;
+	using View = BasicFractionView<IntT>;
+
+	BasicFractionArray();
+	explicit BasicFractionArray(std::size_t count);
+	BasicFractionArray(const std::vector<Element>& fractions);
+	static BasicFractionArray fromColumns(const IntT* numerators, const IntT* denominators, std::size_t count);
+
+	std::size_t size() const;
+	void resize(std::size_t count);
+	void reserve(std::size_t count);
+	void push_back(const Element& value);
+	void clear();
+
+	Element operator[](std::size_t index) const;
+	void set(std::size_t index, const Element& value);
+	std::vector<Element> toVector() const;
+
+	IntT* numerators();
+	IntT* denominators();
+	const IntT* numerators() const;
+	const IntT* denominators() const;
+	void normalize();
+	View view() const;
+	operator View() const;
+	void append(const View& values);
+	FractionBulkParseResult appendParsed(std::string_view text);
+
+	// Conversion from doubles and denominator limiting, element by element as in BasicFraction
+	static BasicFractionArray fromDoubles(const double* values, std::size_t count);
+	static BasicFractionArray fromDoubles(const double* values, std::size_t count, IntT maxDenominator);
+	static void limitDenominator(const View& values, IntT maxDenominator, BasicFractionArray& out);
+
+	// Numeric Conversion Kernels, element by element as in BasicFraction; out holds one value per fraction
+	static void toDoubles(const View& values, double* out);
+	static void toFloats(const View& values, float* out);
+	static void floor(const View& values, IntT* out);
+	static void ceil(const View& values, IntT* out);
+	static void trunc(const View& values, IntT* out);
+	static void roundHalfEven(const View& values, IntT* out);
+
+	// Batched Arithmetic Kernels, reading views (arrays convert implicitly); out may alias either operand
+	static void add(const View& lhs, const View& rhs, BasicFractionArray& out);
+	static void add(const View& lhs, const IntT rhs, BasicFractionArray& out);
+	static void subtract(const View& lhs, const View& rhs, BasicFractionArray& out);
+	static void subtract(const View& lhs, const IntT rhs, BasicFractionArray& out);
+	static void subtract(const IntT lhs, const View& rhs, BasicFractionArray& out);
+	static void multiply(const View& lhs, const View& rhs, BasicFractionArray& out);
+	static void multiply(const View& lhs, const IntT rhs, BasicFractionArray& out);
+	static void divide(const View& lhs, const View& rhs, BasicFractionArray& out);
+	static void divide(const View& lhs, const IntT rhs, BasicFractionArray& out);
+	static void divide(const IntT lhs, const View& rhs, BasicFractionArray& out);
+
+	// Batched Comparison Kernels, mask[i] is 1 where the comparison holds
+	static void compare(const View& lhs, const View& rhs, std::int8_t* order);
+	static void equal(const View& lhs, const View& rhs, Mask& mask);
+	static void less(const View& lhs, const View& rhs, Mask& mask);
+	static void less(const View& lhs, const IntT rhs, Mask& mask);
+	static void greater(const View& lhs, const View& rhs, Mask& mask);
+	static void greater(const View& lhs, const IntT rhs, Mask& mask);
+
+	// Element-wise Operator Overloads
+	BasicFractionArray operator+(const BasicFractionArray& rhs) const;
+	BasicFractionArray operator-(const BasicFractionArray& rhs) const;
+	BasicFractionArray operator*(const BasicFractionArray& rhs) const;
+	BasicFractionArray operator/(const BasicFractionArray& rhs) const;
+	BasicFractionArray operator+(const IntT rhs) const;
+	BasicFractionArray operator-(const IntT rhs) const;
+	BasicFractionArray operator*(const IntT rhs) const;
+	BasicFractionArray operator/(const IntT rhs) const;
+
+	static void reduce(const WideInteger* num, const WideInteger* den, IntT* outNum, IntT* outDen, std::size_t count);
+
+private:
+	// Elements handled per pass, sized so the wide scratch buffers stay in L1
+	static constexpr std::size_t kBlock = 256;
+
+	Column numerator;
+	Column denominator;
+
+	template <typename Kernel>
+	static void blocked(std::size_t count, BasicFractionArray& out, Kernel kernel, std::size_t offset = 0);
+	void normalizeFrom(std::size_t first);
+	static void multiplyCancelled(const IntT* a, const IntT* b, const IntT* c, const IntT* d, IntT* outNum, IntT* outDen, std::size_t count);
+
+};
+
+// Array of the original int fraction, and the fixed width variants
+using FractionArray = BasicFractionArray<int>;
+#ifdef __SIZEOF_INT128__
+using FractionArray64 = BasicFractionArray<std::int64_t>;
+#endif
+using FractionView = BasicFractionView<int>;
+using FractionView64 = BasicFractionView<std::int64_t>;
+
+#include "FractionArray.inl"
+
+// Instantiated once in FractionArray.cpp
+extern template class BasicFractionView<std::int32_t>;
+extern template class BasicFractionView<std::int64_t>;
+extern template class BasicFractionArray<std::int32_t>;
+#ifdef __SIZEOF_INT128__
+extern template class BasicFractionArray<std::int64_t>;
+#endif
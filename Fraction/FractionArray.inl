@@ -0,0 +1,992 @@
+#pragma once
+/**
+* @file		FractionArray.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the structure-of-arrays fraction container and its batched kernels.
+*  Included by FractionArray.h, since BasicFractionArray is a template over its integer type.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+*	Constructs a view of existing columns. The columns must outlive the view.
+*
+*	@param numerators first numerator
+*	@param denominators first denominator
+*	@param count number of fractions
+*/
+template <typename IntT>
+BasicFractionView<IntT>::BasicFractionView(const IntT* numerators, const IntT* denominators, std::size_t count)
+	: numeratorData(numerators), denominatorData(denominators), count(count) {
+}
+
+template <typename IntT>
+std::size_t BasicFractionView<IntT>::size() const {
+	return count;
+}
+
+template <typename IntT>
+const IntT* BasicFractionView<IntT>::numerators() const {
+	return numeratorData;
+}
+
+template <typename IntT>
+const IntT* BasicFractionView<IntT>::denominators() const {
+	return denominatorData;
+}
+
+/**
+*	Returns a copy of the fraction at the provided index.
+*
+*	@param index position of the element
+*	@return the fraction at that position
+*/
+template <typename IntT>
+BasicFraction<IntT> BasicFractionView<IntT>::operator[](std::size_t index) const {
+	return BasicFraction<IntT>(numeratorData[index], denominatorData[index], typename BasicFraction<IntT>::ReducedTag());
+}
+
+/**
+*	Constructs an empty array.
+*/
+template <typename IntT>
+BasicFractionArray<IntT>::BasicFractionArray() {
+}
+
+/**
+*	Constructs an array of the provided size where every element is 1/1, like a default constructed Fraction.
+*
+*	@param count the number of elements
+*/
+template <typename IntT>
+BasicFractionArray<IntT>::BasicFractionArray(std::size_t count) : numerator(count, 1), denominator(count, 1) {
+}
+
+/**
+*	Constructs an array holding the same values as the provided vector of fractions.
+*
+*	@param fractions the fractions to copy
+*/
+template <typename IntT>
+BasicFractionArray<IntT>::BasicFractionArray(const std::vector<Element>& fractions) {
+	reserve(fractions.size());
+	for (const Element& fraction : fractions)
+		push_back(fraction);
+}
+
+/**
+*	Builds an array from separate numerator and denominator columns, putting every element into simplest form.
+*
+*	@param numerators the numerators to copy
+*	@param denominators the denominators to copy
+*	@param count number of fractions
+*	@return the reduced array
+*/
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::fromColumns(const IntT* numerators, const IntT* denominators, std::size_t count) {
+	BasicFractionArray array;
+	array.numerator.assign(numerators, numerators + count);
+	array.denominator.assign(denominators, denominators + count);
+	array.normalize();
+	return array;
+}
+
+/**
+*	Returns the number of fractions in the array.
+*
+*	@return the number of elements
+*/
+template <typename IntT>
+std::size_t BasicFractionArray<IntT>::size() const {
+	return numerator.size();
+}
+
+/**
+*	Changes the number of fractions in the array. New elements are 1/1.
+*
+*	@param count the new number of elements
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::resize(std::size_t count) {
+	numerator.resize(count, 1);
+	denominator.resize(count, 1);
+}
+
+/**
+*	Reserves room for the provided number of fractions without changing the size.
+*
+*	@param count the number of elements to make room for
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::reserve(std::size_t count) {
+	numerator.reserve(count);
+	denominator.reserve(count);
+}
+
+/**
+*	Appends a fraction to the end of the array.
+*
+*	@param value the fraction to append
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::push_back(const Element& value) {
+	numerator.push_back(value.numerator);
+	denominator.push_back(value.denominator);
+}
+
+/**
+*	Removes every fraction from the array.
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::clear() {
+	numerator.clear();
+	denominator.clear();
+}
+
+/**
+*	Returns a copy of the fraction at the provided index. The array stores no Fraction objects, so there is no reference to hand out.
+*
+*	@param index position of the element
+*	@return the fraction at that position
+*/
+template <typename IntT>
+typename BasicFractionArray<IntT>::Element BasicFractionArray<IntT>::operator[](std::size_t index) const {
+	return Element(numerator[index], denominator[index], typename Element::ReducedTag());
+}
+
+/**
+*	Replaces the fraction at the provided index.
+*
+*	@param index position of the element
+*	@param value the new fraction
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::set(std::size_t index, const Element& value) {
+	numerator[index] = value.numerator;
+	denominator[index] = value.denominator;
+}
+
+/**
+*	Copies the array back into a vector of fractions.
+*
+*	@return a vector holding the same values
+*/
+template <typename IntT>
+std::vector<typename BasicFractionArray<IntT>::Element> BasicFractionArray<IntT>::toVector() const {
+	std::vector<Element> fractions;
+	fractions.reserve(size());
+	for (std::size_t i = 0; i < size(); ++i)
+		fractions.push_back((*this)[i]);
+	return fractions;
+}
+
+/**
+*	Gives direct access to the numerator column. Values written through it must stay in simplest form,
+*	with the denominator column holding positive denominators.
+*
+*	@return pointer to the first numerator, aligned to 64 bytes
+*/
+template <typename IntT>
+IntT* BasicFractionArray<IntT>::numerators() {
+	return numerator.data();
+}
+
+/**
+*	Gives direct access to the denominator column. Values written through it must stay in simplest form.
+*
+*	@return pointer to the first denominator, aligned to 64 bytes
+*/
+template <typename IntT>
+IntT* BasicFractionArray<IntT>::denominators() {
+	return denominator.data();
+}
+
+template <typename IntT>
+const IntT* BasicFractionArray<IntT>::numerators() const {
+	return numerator.data();
+}
+
+template <typename IntT>
+const IntT* BasicFractionArray<IntT>::denominators() const {
+	return denominator.data();
+}
+
+/**
+*	Returns a view of the columns of this array, valid until the array is resized or destroyed.
+*
+*	@return the view
+*/
+template <typename IntT>
+typename BasicFractionArray<IntT>::View BasicFractionArray<IntT>::view() const {
+	return View(numerator.data(), denominator.data(), size());
+}
+
+template <typename IntT>
+BasicFractionArray<IntT>::operator View() const {
+	return view();
+}
+
+/**
+*	Puts every element back into simplest form, with the same rules as Fraction::reduce(). Needed after
+*	writing values through numerators() and denominators(); 32-bit arrays use the vectorized gcd::reduceBatch().
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::normalize() {
+	normalizeFrom(0);
+}
+
+/**
+*	Puts the elements from the provided index onwards into simplest form.
+*
+*	@param first index of the first element to reduce
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::normalizeFrom(std::size_t first) {
+	if (first >= size())
+		return;
+	if constexpr (std::is_same<IntT, std::int32_t>::value) {
+		gcd::reduceBatch(numerator.data() + first, denominator.data() + first, size() - first);
+	}
+	else {
+		const IntT* a = numerator.data() + first;
+		const IntT* b = denominator.data() + first;
+		blocked(size() - first, *this, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+			for (std::size_t i = 0; i < length; ++i) {
+				num[i] = a[start + i];
+				den[i] = b[start + i];
+			}
+		}, first);
+	}
+}
+
+/**
+*	Appends the fractions of a view, which are already in simplest form, by copying its columns.
+*
+*	@param values the fractions to append; must not view this array
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::append(const View& values) {
+	numerator.insert(numerator.end(), values.numerators(), values.numerators() + values.size());
+	denominator.insert(denominator.end(), values.denominators(), values.denominators() + values.size());
+}
+
+/**
+*	Parses whitespace separated fractions from a whole buffer and appends them, in the format accepted by
+*	Fraction::parse(). The parsed parts are collected first and reduced in one batch at the end.
+*
+*	@param text the buffer to parse, for example a whole file
+*	@return how many fractions were appended, and where and why parsing stopped if the text was not all fractions
+*/
+template <typename IntT>
+FractionBulkParseResult BasicFractionArray<IntT>::appendParsed(std::string_view text) {
+	const char* first = text.data();
+	const char* last = first + text.size();
+	const char* position = first;
+	std::size_t start = size();
+	FractionParseError error = FractionParseError::None;
+	for (;;) {
+		while (position != last && isFractionSpace(*position))
+			++position;
+		if (position == last)
+			break;
+		IntT num = 0;
+		IntT den = 1;
+		error = parseFractionParts(position, last, num, den, position);
+		if (error != FractionParseError::None)
+			break;
+		numerator.push_back(num);
+		denominator.push_back(den);
+	}
+	normalizeFrom(start);
+	return { size() - start, error, static_cast<std::size_t>(position - first) };
+}
+
+/**
+*	Converts doubles to the fractions with exactly their values, as Fraction::fromDouble() does.
+*
+*	@param values the doubles to convert
+*	@param count number of doubles
+*	@return the fractions
+*	@throws std::domain_error if a value is NaN or infinite
+*	@throws std::overflow_error if a value needs a numerator or denominator beyond IntT
+*/
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::fromDoubles(const double* values, std::size_t count) {
+	BasicFractionArray array(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		Element value = Element::fromDouble(values[i]);
+		array.numerator[i] = value.numerator;
+		array.denominator[i] = value.denominator;
+	}
+	return array;
+}
+
+/**
+*	Converts doubles to the closest fractions with a bounded denominator, as Fraction::fromDouble() does, writing
+*	the columns directly.
+*
+*	@param values the doubles to convert
+*	@param count number of doubles
+*	@param maxDenominator positive bound on the denominators of the results
+*	@return the fractions
+*	@throws std::invalid_argument if maxDenominator is not positive
+*	@throws std::domain_error if a value is NaN or infinite
+*	@throws std::overflow_error if a result is beyond the range of IntT
+*/
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::fromDoubles(const double* values, std::size_t count, IntT maxDenominator) {
+	BasicFractionArray array(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		Element value = Element::fromDouble(values[i], maxDenominator);
+		array.numerator[i] = value.numerator;
+		array.denominator[i] = value.denominator;
+	}
+	return array;
+}
+
+/**
+*	Replaces every fraction by the closest one with a bounded denominator, as Fraction::limitDenominator() does.
+*
+*	@param values the fractions to approximate
+*	@param maxDenominator positive bound on the denominators of the results
+*	@param out receives the approximations; may alias values
+*	@throws std::invalid_argument if maxDenominator is not positive
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::limitDenominator(const View& values, IntT maxDenominator, BasicFractionArray& out) {
+	if (maxDenominator < 1)
+		throw std::invalid_argument("maximum denominator must be positive");
+	std::size_t count = values.size();
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	out.resize(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		if (b[i] <= maxDenominator) {
+			out.numerator[i] = a[i];
+			out.denominator[i] = b[i];
+			continue;
+		}
+		Element value = Element(a[i], b[i], typename Element::ReducedTag()).limitDenominator(maxDenominator);
+		out.numerator[i] = value.numerator;
+		out.denominator[i] = value.denominator;
+	}
+}
+
+/**
+*	Converts fractions to the closest doubles, as Fraction::toDouble() does. 32-bit fractions are a plain
+*	element-wise division, which the compiler vectorizes.
+*
+*	@param values the fractions to convert
+*	@param out receives one double per fraction
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::toDoubles(const View& values, double* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	std::size_t count = values.size();
+	if constexpr (sizeof(IntT) <= 4) {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = static_cast<double>(a[i]) / static_cast<double>(b[i]);
+	}
+	else {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = Element(a[i], b[i], typename Element::ReducedTag()).toDouble();
+	}
+}
+
+/**
+*	Converts fractions to the closest floats, as Fraction::toFloat() does.
+*
+*	@param values the fractions to convert
+*	@param out receives one float per fraction
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::toFloats(const View& values, float* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	std::size_t count = values.size();
+	if constexpr (sizeof(IntT) <= 4) {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = static_cast<float>(static_cast<double>(a[i]) / static_cast<double>(b[i]));
+	}
+	else {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = Element(a[i], b[i], typename Element::ReducedTag()).toFloat();
+	}
+}
+
+/**
+*	Rounds fractions down to integers, as Fraction::floor() does.
+*
+*	@param values the fractions to round
+*	@param out receives one integer per fraction
+*	@throws std::domain_error if a denominator is zero
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::floor(const View& values, IntT* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	for (std::size_t i = 0; i < values.size(); ++i)
+		out[i] = Element(a[i], b[i], typename Element::ReducedTag()).floor();
+}
+
+/**
+*	Rounds fractions up to integers, as Fraction::ceil() does.
+*
+*	@param values the fractions to round
+*	@param out receives one integer per fraction
+*	@throws std::domain_error if a denominator is zero
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::ceil(const View& values, IntT* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	for (std::size_t i = 0; i < values.size(); ++i)
+		out[i] = Element(a[i], b[i], typename Element::ReducedTag()).ceil();
+}
+
+/**
+*	Rounds fractions towards zero, as Fraction::trunc() does.
+*
+*	@param values the fractions to round
+*	@param out receives one integer per fraction
+*	@throws std::domain_error if a denominator is zero
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::trunc(const View& values, IntT* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	for (std::size_t i = 0; i < values.size(); ++i)
+		out[i] = Element(a[i], b[i], typename Element::ReducedTag()).trunc();
+}
+
+/**
+*	Rounds fractions to the nearest integers, ties to even, as Fraction::roundHalfEven() does.
+*
+*	@param values the fractions to round
+*	@param out receives one integer per fraction
+*	@throws std::domain_error if a denominator is zero
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::roundHalfEven(const View& values, IntT* out) {
+	const IntT* a = values.numerators();
+	const IntT* b = values.denominators();
+	for (std::size_t i = 0; i < values.size(); ++i)
+		out[i] = Element(a[i], b[i], typename Element::ReducedTag()).roundHalfEven();
+}
+
+/**
+*	Runs a kernel over the array one block at a time. The kernel fills wide numerator and denominator scratch
+*	buffers for its block with plain multiply/add loops, and the block is then reduced into out.
+*	Reading a whole block before writing it is what lets out alias an input.
+*
+*	@param count number of elements to process
+*	@param out array receiving the reduced results, already sized to count
+*	@param kernel callable (start, length, num, den) filling num[0..length) and den[0..length)
+*	@param offset index in out of the element the kernel calls start 0
+*/
+template <typename IntT>
+template <typename Kernel>
+void BasicFractionArray<IntT>::blocked(std::size_t count, BasicFractionArray& out, Kernel kernel, std::size_t offset) {
+	alignas(64) WideInteger num[kBlock];
+	alignas(64) WideInteger den[kBlock];
+	for (std::size_t start = 0; start < count; start += kBlock) {
+		std::size_t length = std::min(kBlock, count - start);
+		kernel(start, length, num, den);
+		reduce(num, den, out.numerator.data() + offset + start, out.denominator.data() + offset + start, length);
+	}
+}
+
+/**
+*	Multiplies a/b by c/d for 32-bit fractions by cancelling crosswise first. The pairs a/d and c/b are reduced
+*	with the vectorized gcd::reduceBatch(), after which the product of what is left is already in simplest form,
+*	so no gcd of the wide product is ever needed. Passing d/c as the second fraction divides instead: the sign rule
+*	of reduceBatch() moves the sign of c onto the numerator.
+*
+*	@param a numerators of the first fractions
+*	@param b positive denominators of the first fractions
+*	@param c numerators of the second fractions
+*	@param d denominators of the second fractions
+*	@param outNum receives the numerators of the products
+*	@param outDen receives the denominators of the products
+*	@param count number of fractions
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::multiplyCancelled(const IntT* a, const IntT* b, const IntT* c, const IntT* d, IntT* outNum, IntT* outDen, std::size_t count) {
+	alignas(64) std::int32_t leftNum[kBlock];
+	alignas(64) std::int32_t leftDen[kBlock];
+	alignas(64) std::int32_t rightNum[kBlock];
+	alignas(64) std::int32_t rightDen[kBlock];
+	for (std::size_t start = 0; start < count; start += kBlock) {
+		std::size_t length = std::min(kBlock, count - start);
+		for (std::size_t i = 0; i < length; ++i) {
+			leftNum[i] = static_cast<std::int32_t>(a[start + i]);
+			leftDen[i] = static_cast<std::int32_t>(d[start + i]);
+			rightNum[i] = static_cast<std::int32_t>(c[start + i]);
+			rightDen[i] = static_cast<std::int32_t>(b[start + i]);
+		}
+		gcd::reduceBatch(leftNum, leftDen, length);
+		gcd::reduceBatch(rightNum, rightDen, length);
+		for (std::size_t i = 0; i < length; ++i) {
+			outNum[start + i] = static_cast<IntT>(WideInteger(leftNum[i]) * rightNum[i]);
+			outDen[start + i] = static_cast<IntT>(WideInteger(rightDen[i]) * leftDen[i]);
+		}
+	}
+}
+
+/**
+*	Puts a run of wide fractions into simplest form and narrows them, with the same rules as Fraction::reduce()
+*	(the sign ends up on the numerator).
+*
+*	@param num wide numerators
+*	@param den wide denominators
+*	@param outNum receives the reduced numerators
+*	@param outDen receives the reduced, positive denominators
+*	@param count number of fractions
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::reduce(const WideInteger* num, const WideInteger* den, IntT* outNum, IntT* outDen, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) {
+		WideInteger top = num[i];
+		WideInteger bottom = den[i];
+		WideInteger gcd = static_cast<WideInteger>(gcd::compute(top, bottom));
+		if (gcd != 0) {
+			top /= gcd;
+			bottom /= gcd;
+		}
+		if (bottom < 0) {
+			bottom *= -1;
+			top *= -1;
+		}
+		outNum[i] = static_cast<IntT>(top);
+		outDen[i] = static_cast<IntT>(bottom);
+	}
+}
+
+/**
+*	Adds two arrays element by element. Both arrays must have the same size.
+*
+*	@param lhs first operands
+*	@param rhs second operands
+*	@param out receives lhs[i] + rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::add(const View& lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(a[start + i]) * d[start + i] + WideInteger(c[start + i]) * b[start + i];
+			den[i] = WideInteger(b[start + i]) * d[start + i];
+		}
+	});
+}
+
+/**
+*	Adds an integer to every element, mirroring Fraction + int. Adding a multiple of the denominator
+*	cannot introduce a common factor, so this kernel needs no gcd at all.
+*
+*	@param lhs fractions to be added to
+*	@param rhs integer to be added to every fraction
+*	@param out receives lhs[i] + rhs
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::add(const View& lhs, const IntT rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	IntT* outNum = out.numerators();
+	IntT* outDen = out.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		outNum[i] = static_cast<IntT>(WideInteger(a[i]) + WideInteger(b[i]) * rhs);
+		outDen[i] = b[i];
+	}
+}
+
+/**
+*	Subtracts two arrays element by element. Both arrays must have the same size.
+*
+*	@param lhs fractions to be subtracted from
+*	@param rhs fractions to be subtracted
+*	@param out receives lhs[i] - rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::subtract(const View& lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(a[start + i]) * d[start + i] - WideInteger(c[start + i]) * b[start + i];
+			den[i] = WideInteger(b[start + i]) * d[start + i];
+		}
+	});
+}
+
+/**
+*	Subtracts an integer from every element, mirroring Fraction - int. Needs no gcd, like add().
+*
+*	@param lhs fractions to be subtracted from
+*	@param rhs integer to be subtracted from every fraction
+*	@param out receives lhs[i] - rhs
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::subtract(const View& lhs, const IntT rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	IntT* outNum = out.numerators();
+	IntT* outDen = out.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		outNum[i] = static_cast<IntT>(WideInteger(a[i]) - WideInteger(b[i]) * rhs);
+		outDen[i] = b[i];
+	}
+}
+
+/**
+*	Subtracts every element from an integer, mirroring int - Fraction. Needs no gcd, like add().
+*
+*	@param lhs integer to be subtracted from
+*	@param rhs fractions to be subtracted
+*	@param out receives lhs - rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::subtract(const IntT lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(rhs.size());
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	IntT* outNum = out.numerators();
+	IntT* outDen = out.denominators();
+	for (std::size_t i = 0; i < rhs.size(); ++i) {
+		outNum[i] = static_cast<IntT>(WideInteger(lhs) * d[i] - c[i]);
+		outDen[i] = d[i];
+	}
+}
+
+/**
+*	Multiplies two arrays element by element. Both arrays must have the same size.
+*
+*	@param lhs first factors
+*	@param rhs second factors
+*	@param out receives lhs[i] * rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::multiply(const View& lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	if constexpr (std::is_same<IntT, std::int32_t>::value) {
+		multiplyCancelled(a, b, c, d, out.numerators(), out.denominators(), lhs.size());
+		return;
+	}
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(a[start + i]) * c[start + i];
+			den[i] = WideInteger(b[start + i]) * d[start + i];
+		}
+	});
+}
+
+/**
+*	Multiplies every element by an integer, mirroring Fraction * int.
+*
+*	@param lhs fractions to be multiplied
+*	@param rhs integer to multiply every fraction by
+*	@param out receives lhs[i] * rhs
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::multiply(const View& lhs, const IntT rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(a[start + i]) * rhs;
+			den[i] = b[start + i];
+		}
+	});
+}
+
+/**
+*	Divides two arrays element by element. Both arrays must have the same size.
+*
+*	@param lhs dividends
+*	@param rhs divisors
+*	@param out receives lhs[i] / rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::divide(const View& lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	if constexpr (std::is_same<IntT, std::int32_t>::value) {
+		multiplyCancelled(a, b, d, c, out.numerators(), out.denominators(), lhs.size());
+		return;
+	}
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(a[start + i]) * d[start + i];
+			den[i] = WideInteger(b[start + i]) * c[start + i];
+		}
+	});
+}
+
+/**
+*	Divides every element by an integer, mirroring Fraction / int.
+*
+*	@param lhs fractions to be divided
+*	@param rhs integer to divide every fraction by
+*	@param out receives lhs[i] / rhs
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::divide(const View& lhs, const IntT rhs, BasicFractionArray& out) {
+	out.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	blocked(lhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = a[start + i];
+			den[i] = WideInteger(b[start + i]) * rhs;
+		}
+	});
+}
+
+/**
+*	Divides an integer by every element, mirroring int / Fraction.
+*
+*	@param lhs integer to be divided
+*	@param rhs fractions to divide the integer by
+*	@param out receives lhs / rhs[i]
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::divide(const IntT lhs, const View& rhs, BasicFractionArray& out) {
+	out.resize(rhs.size());
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	blocked(rhs.size(), out, [=](std::size_t start, std::size_t length, WideInteger* num, WideInteger* den) {
+		for (std::size_t i = 0; i < length; ++i) {
+			num[i] = WideInteger(lhs) * d[start + i];
+			den[i] = c[start + i];
+		}
+	});
+}
+
+/**
+*	Three-way compares two arrays element by element. Both arrays must have the same size.
+*
+*	@param lhs left hand fractions
+*	@param rhs right hand fractions
+*	@param order receives -1, 0 or 1 for every element, like Fraction::compare()
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::compare(const View& lhs, const View& rhs, std::int8_t* order) {
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		if constexpr (sizeof(WideInteger) > sizeof(IntT)) {
+			WideInteger lhsCross = WideInteger(a[i]) * d[i];
+			WideInteger rhsCross = WideInteger(c[i]) * b[i];
+			order[i] = static_cast<std::int8_t>((lhsCross > rhsCross) - (lhsCross < rhsCross));
+		}
+		else {
+			order[i] = static_cast<std::int8_t>(Element::compare(a[i], b[i], c[i], d[i]));
+		}
+	}
+}
+
+/**
+*	Tests two arrays for equality element by element. Both arrays must have the same size.
+*
+*	@param lhs left hand fractions
+*	@param rhs right hand fractions
+*	@param mask receives 1 where lhs[i] == rhs[i], 0 elsewhere
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::equal(const View& lhs, const View& rhs, Mask& mask) {
+	mask.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i)
+		mask[i] = static_cast<std::uint8_t>((a[i] == c[i]) & (b[i] == d[i]));
+}
+
+/**
+*	Tests lhs[i] < rhs[i] element by element. Both arrays must have the same size.
+*
+*	@param lhs left hand fractions
+*	@param rhs right hand fractions
+*	@param mask receives 1 where lhs[i] < rhs[i], 0 elsewhere
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::less(const View& lhs, const View& rhs, Mask& mask) {
+	mask.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	const IntT* c = rhs.numerators();
+	const IntT* d = rhs.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		if constexpr (sizeof(WideInteger) > sizeof(IntT))
+			mask[i] = static_cast<std::uint8_t>(WideInteger(a[i]) * d[i] < WideInteger(c[i]) * b[i]);
+		else
+			mask[i] = static_cast<std::uint8_t>(Element::compare(a[i], b[i], c[i], d[i]) < 0);
+	}
+}
+
+/**
+*	Tests lhs[i] < rhs element by element, mirroring Fraction < int.
+*
+*	@param lhs left hand fractions
+*	@param rhs integer to compare every fraction with
+*	@param mask receives 1 where lhs[i] < rhs, 0 elsewhere
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::less(const View& lhs, const IntT rhs, Mask& mask) {
+	mask.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		if constexpr (sizeof(WideInteger) > sizeof(IntT))
+			mask[i] = static_cast<std::uint8_t>(WideInteger(a[i]) < WideInteger(rhs) * b[i]);
+		else
+			mask[i] = static_cast<std::uint8_t>(Element::compare(a[i], b[i], rhs, 1) < 0);
+	}
+}
+
+/**
+*	Tests lhs[i] > rhs[i] element by element. Both arrays must have the same size.
+*
+*	@param lhs left hand fractions
+*	@param rhs right hand fractions
+*	@param mask receives 1 where lhs[i] > rhs[i], 0 elsewhere
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::greater(const View& lhs, const View& rhs, Mask& mask) {
+	less(rhs, lhs, mask);
+}
+
+/**
+*	Tests lhs[i] > rhs element by element, mirroring Fraction > int.
+*
+*	@param lhs left hand fractions
+*	@param rhs integer to compare every fraction with
+*	@param mask receives 1 where lhs[i] > rhs, 0 elsewhere
+*/
+template <typename IntT>
+void BasicFractionArray<IntT>::greater(const View& lhs, const IntT rhs, Mask& mask) {
+	mask.resize(lhs.size());
+	const IntT* a = lhs.numerators();
+	const IntT* b = lhs.denominators();
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		if constexpr (sizeof(WideInteger) > sizeof(IntT))
+			mask[i] = static_cast<std::uint8_t>(WideInteger(a[i]) > WideInteger(rhs) * b[i]);
+		else
+			mask[i] = static_cast<std::uint8_t>(Element::compare(a[i], b[i], rhs, 1) > 0);
+	}
+}
+
+/**
+*	Returns a new array holding the element-wise sum of this array and the provided one.
+*
+*	@param rhs array to be added to this one, of the same size
+*	@return the sums as a new array
+*/
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator+(const BasicFractionArray& rhs) const {
+	BasicFractionArray result;
+	add(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator-(const BasicFractionArray& rhs) const {
+	BasicFractionArray result;
+	subtract(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator*(const BasicFractionArray& rhs) const {
+	BasicFractionArray result;
+	multiply(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator/(const BasicFractionArray& rhs) const {
+	BasicFractionArray result;
+	divide(*this, rhs, result);
+	return result;
+}
+
+/**
+*	Returns a new array holding every element of this array plus the provided integer.
+*
+*	@param rhs integer to be added to every element
+*	@return the sums as a new array
+*/
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator+(const IntT rhs) const {
+	BasicFractionArray result;
+	add(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator-(const IntT rhs) const {
+	BasicFractionArray result;
+	subtract(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator*(const IntT rhs) const {
+	BasicFractionArray result;
+	multiply(*this, rhs, result);
+	return result;
+}
+
+template <typename IntT>
+BasicFractionArray<IntT> BasicFractionArray<IntT>::operator/(const IntT rhs) const {
+	BasicFractionArray result;
+	divide(*this, rhs, result);
+	return result;
+}
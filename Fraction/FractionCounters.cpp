@@ -0,0 +1,216 @@
+/**
+* @file		FractionCounters.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Registry of the per-thread instrumentation counters, and their snapshot and dump functions.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "FractionCounters.h"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#if FRACTION_COUNTERS
+namespace {
+
+	/**
+	*	Blocks of the live threads, and the totals of the threads that have exited.
+	*/
+	struct Registry
+	{
+		std::mutex mutex;
+		std::vector<counters::Block*> blocks;
+		std::uint64_t retired[counters::kCounterCount] = {};
+	};
+
+	// Never destroyed, so that threads exiting during static destruction can still fold their counts in
+	Registry& registry() {
+		static Registry* instance = new Registry();
+		return *instance;
+	}
+
+}
+
+/**
+*	Zeroes this thread's counters and registers them for snapshot().
+*/
+counters::ThreadBlock::ThreadBlock() {
+	for (std::atomic<std::uint64_t>& value : block.values)
+		value.store(0, std::memory_order_relaxed);
+	Registry& shared = registry();
+	std::lock_guard<std::mutex> lock(shared.mutex);
+	shared.blocks.push_back(&block);
+}
+
+/**
+*	Folds this thread's counters into the totals of finished threads and unregisters them.
+*/
+counters::ThreadBlock::~ThreadBlock() {
+	Registry& shared = registry();
+	std::lock_guard<std::mutex> lock(shared.mutex);
+	for (std::size_t i = 0; i < kCounterCount; ++i)
+		shared.retired[i] += block.values[i].load(std::memory_order_relaxed);
+	shared.blocks.erase(std::find(shared.blocks.begin(), shared.blocks.end(), &block));
+}
+#endif
+
+/**
+*	Names a counter, for reports.
+*
+*	@param counter the counter to name
+*	@return a static, lower case name
+*/
+const char* counters::name(Counter counter) {
+	switch (counter) {
+	case Counter::Construction:
+		return "construction";
+	case Counter::Reduce:
+		return "reduce";
+	case Counter::Gcd:
+		return "gcd";
+	case Counter::GcdIteration:
+		return "gcd iteration";
+	case Counter::SignFlip:
+		return "sign flip";
+	case Counter::Add:
+		return "add";
+	case Counter::AddInteger:
+		return "add integer";
+	case Counter::AddAssign:
+		return "add assign";
+	case Counter::AddAssignInteger:
+		return "add assign integer";
+	case Counter::Subtract:
+		return "subtract";
+	case Counter::SubtractInteger:
+		return "subtract integer";
+	case Counter::SubtractAssign:
+		return "subtract assign";
+	case Counter::SubtractAssignInteger:
+		return "subtract assign integer";
+	case Counter::Multiply:
+		return "multiply";
+	case Counter::MultiplyInteger:
+		return "multiply integer";
+	case Counter::MultiplyAssign:
+		return "multiply assign";
+	case Counter::MultiplyAssignInteger:
+		return "multiply assign integer";
+	case Counter::Divide:
+		return "divide";
+	case Counter::DivideInteger:
+		return "divide integer";
+	case Counter::DivideAssign:
+		return "divide assign";
+	case Counter::DivideAssignInteger:
+		return "divide assign integer";
+	case Counter::Equal:
+		return "equal";
+	case Counter::NotEqual:
+		return "not equal";
+	case Counter::Less:
+		return "less";
+	case Counter::LessEqual:
+		return "less equal";
+	case Counter::Greater:
+		return "greater";
+	case Counter::GreaterEqual:
+		return "greater equal";
+	case Counter::ThreeWay:
+		return "three-way";
+	case Counter::Overflow:
+		return "overflow";
+	default:
+		return "unknown";
+	}
+}
+
+/**
+*	Subtracts an earlier snapshot from this one.
+*
+*	@param rhs the earlier snapshot
+*	@return the counts between the two snapshots
+*/
+counters::Snapshot counters::Snapshot::operator-(const Snapshot& rhs) const {
+	Snapshot difference;
+	for (std::size_t i = 0; i < kCounterCount; ++i)
+		difference.values[i] = values[i] - rhs.values[i];
+	return difference;
+}
+
+/**
+*	Totals the counters of every thread, live or finished. Counts still being made by other threads
+*	may or may not be included.
+*
+*	@return the totals; all zero unless FRACTION_COUNTERS is set
+*/
+counters::Snapshot counters::snapshot() {
+	Snapshot totals = {};
+#if FRACTION_COUNTERS
+	Registry& shared = registry();
+	std::lock_guard<std::mutex> lock(shared.mutex);
+	for (std::size_t i = 0; i < kCounterCount; ++i) {
+		totals.values[i] = shared.retired[i];
+		for (const Block* block : shared.blocks)
+			totals.values[i] += block->values[i].load(std::memory_order_relaxed);
+	}
+#endif
+	return totals;
+}
+
+/**
+*	Zeroes the counters of every thread. Intended for quiet points, such as between benchmark runs;
+*	an increment racing with it may survive. Subtracting snapshots needs no reset.
+*/
+void counters::reset() {
+#if FRACTION_COUNTERS
+	Registry& shared = registry();
+	std::lock_guard<std::mutex> lock(shared.mutex);
+	std::fill(std::begin(shared.retired), std::end(shared.retired), 0);
+	for (Block* block : shared.blocks) {
+		for (std::atomic<std::uint64_t>& value : block->values)
+			value.store(0, std::memory_order_relaxed);
+	}
+#endif
+}
+
+/**
+*	Writes one line per counter, followed by the mean gcd depth.
+*
+*	@param out stream to write to
+*	@param counts the counts to write, usually the difference of two snapshots
+*/
+void counters::dump(std::ostream& out, const Snapshot& counts) {
+	for (std::size_t i = 0; i < kCounterCount; ++i)
+		out << std::left << std::setw(26) << name(static_cast<Counter>(i)) << counts.values[i] << '\n';
+	if (counts[Counter::Gcd] != 0)
+		out << std::left << std::setw(26) << "gcd mean depth"
+			<< static_cast<double>(counts[Counter::GcdIteration]) / static_cast<double>(counts[Counter::Gcd]) << '\n';
+}
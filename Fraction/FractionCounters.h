@@ -0,0 +1,152 @@
+#pragma once
+/**
+* @file		FractionCounters.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Compile-time switchable instrumentation of the fraction hot paths: constructions, reductions, gcd calls and
+*  iterations, sign flips, operators and overflows, counted per thread with a snapshot and dump API.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+// Set to 1 to count the hot paths of the fraction classes; off by default, when every count compiles to nothing
+#ifndef FRACTION_COUNTERS
+#define FRACTION_COUNTERS 0
+#endif
+
+/**
+*	Counts an event in the calling thread's counters. Expands to nothing unless FRACTION_COUNTERS is set, and counts
+*	nothing during constant evaluation. Used inside the library, after Gcd.h, for gcd::constantEvaluated().
+*/
+#if FRACTION_COUNTERS
+#define FRACTION_COUNT_ADD(counter, amount) \
+	(gcd::constantEvaluated() ? void() : ::counters::add(::counters::Counter::counter, static_cast<std::uint64_t>(amount)))
+#else
+#define FRACTION_COUNT_ADD(counter, amount) ((void)0)
+#endif
+#define FRACTION_COUNT(counter) FRACTION_COUNT_ADD(counter, 1)
+
+namespace counters {
+
+	constexpr bool kEnabled = FRACTION_COUNTERS != 0;
+
+	enum class Counter {
+		Construction,		// fractions built by a constructor, including every temporary an operator returns
+		Reduce,				// full reductions, by reduce() or of a wide result
+		Gcd,				// gcd::compute() calls outside constant evaluation
+		GcdIteration,		// loop iterations of the gcd kernels; divided by Gcd, the mean depth
+		SignFlip,			// negative denominators moved onto the numerator
+		// One counter per arithmetic operator overload. The Integer forms count both operand orders, and the
+		// compound assignments count only themselves, not the binary operator they share their work with
+		Add,
+		AddInteger,
+		AddAssign,
+		AddAssignInteger,
+		Subtract,
+		SubtractInteger,
+		SubtractAssign,
+		SubtractAssignInteger,
+		Multiply,
+		MultiplyInteger,
+		MultiplyAssign,
+		MultiplyAssignInteger,
+		Divide,
+		DivideInteger,
+		DivideAssign,
+		DivideAssignInteger,
+		// One counter per comparison operator, counting the fraction and integer forms together, and compare()
+		Equal,
+		NotEqual,
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		ThreeWay,
+		Overflow,			// checked results that did not fit and went to the overflow policy
+		Count
+	};
+
+	constexpr std::size_t kCounterCount = static_cast<std::size_t>(Counter::Count);
+
+	const char* name(Counter counter);
+
+	/**
+	*	Totals of every counter at one point in time. Subtracting two snapshots gives the counts of the code between them.
+	*/
+	struct Snapshot
+	{
+		std::uint64_t values[kCounterCount];
+
+		std::uint64_t operator[](Counter counter) const { return values[static_cast<std::size_t>(counter)]; }
+		Snapshot operator-(const Snapshot& rhs) const;
+	};
+
+	Snapshot snapshot();
+	void reset();
+	void dump(std::ostream& out, const Snapshot& counts);
+
+#if FRACTION_COUNTERS
+	/**
+	*	One thread's counters, on cache lines of their own so that threads counting at once never share a line.
+	*	Only the owning thread writes them; the atomics let snapshot() read them from other threads.
+	*/
+	struct alignas(64) Block
+	{
+		std::atomic<std::uint64_t> values[kCounterCount];
+	};
+
+	/**
+	*	Registers the calling thread's block on first use, and folds its counts into the totals of finished
+	*	threads when the thread exits.
+	*/
+	struct ThreadBlock
+	{
+		Block block;
+
+		ThreadBlock();
+		~ThreadBlock();
+	};
+
+	inline thread_local ThreadBlock threadBlock;
+
+	/**
+	*	Adds to one of the calling thread's counters. A plain load and store rather than a read-modify-write,
+	*	since no other thread writes the block.
+	*
+	*	@param counter the counter to add to
+	*	@param amount the amount to add
+	*/
+	inline void add(Counter counter, std::uint64_t amount) {
+		std::atomic<std::uint64_t>& value = threadBlock.block.values[static_cast<std::size_t>(counter)];
+		value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+#endif
+}
@@ -0,0 +1,440 @@
+#pragma once
+/**
+* @file		FractionExpression.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Expression templates over BasicFraction. A whole expression such as a*b + c*d - e/f is captured and
+*  evaluated with one unreduced numerator and denominator and a single final gcd, instead of one reduced
+*  temporary (and one gcd) per operator.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+
+#include "CheckedFraction.h"
+#include "Fraction.h"
+#include "Gcd.h"
+#include <cstdint>
+#include <type_traits>
+
+/**
+*	Expression templates over BasicFraction. Wrapping one operand with fused::fuse() makes the operators build a tree
+*	instead of a value; the tree is evaluated when it is converted to a fraction, or by fused::evaluate().
+*
+*		Fraction price = fused::fuse(a) * b + c * d - e / f;
+*		Fraction same = fused::apply([](auto a, auto b, auto c) { return a * b + c; }, x, y, z);
+*
+*	Every node knows at compile time how many bits its unreduced numerator and denominator can need, so evaluation
+*	accumulates in a 64 bit integer without overflow checks when the bounds allow it, and otherwise tries checked 64
+*	and 128 bit arithmetic before falling back to the ordinary operators one step at a time. The result is the one the
+*	ordinary operators produce whenever none of their temporaries overflow.
+*/
+namespace fused {
+
+	/**
+	*	Bits needed by the magnitude of an IntT (the most negative value needs all of them but the sign).
+	*/
+	template <typename IntT>
+	constexpr int bitsOf() {
+		return static_cast<int>(sizeof(IntT)) * 8 - 1;
+	}
+
+	/**
+	*	True if a value needing the provided number of bits can be held in an Acc without overflow checks,
+	*	leaving a bit spare so the most negative value never appears.
+	*/
+	template <typename Acc>
+	constexpr bool fitsUnchecked(int bits) {
+		return bits <= bitsOf<Acc>() - 1;
+	}
+
+	/**
+	*	Integer steps used while expanding an expression. Each stores its result and returns false if it overflowed,
+	*	which only the Checked forms can report.
+	*/
+	template <bool Checked, typename Acc>
+	bool add(Acc lhs, Acc rhs, Acc& result) {
+		if constexpr (Checked)
+			return !checked::addOverflows(lhs, rhs, result);
+		result = lhs + rhs;
+		return true;
+	}
+
+	template <bool Checked, typename Acc>
+	bool subtract(Acc lhs, Acc rhs, Acc& result) {
+		if constexpr (Checked)
+			return !checked::subtractOverflows(lhs, rhs, result);
+		result = lhs - rhs;
+		return true;
+	}
+
+	template <bool Checked, typename Acc>
+	bool multiply(Acc lhs, Acc rhs, Acc& result) {
+		if constexpr (Checked)
+			return !checked::multiplyOverflows(lhs, rhs, result);
+		result = lhs * rhs;
+		return true;
+	}
+
+	/**
+	*	Stores value in result, returning false if an IntT wider than the accumulator does not fit in it.
+	*/
+	template <typename Acc, typename IntT>
+	bool load(IntT value, Acc& result) {
+		if constexpr (sizeof(IntT) > sizeof(Acc)) {
+			constexpr IntT kHighest = static_cast<IntT>(~gcd::UnsignedOf<Acc>(0) >> 1);
+			if (value > kHighest || value < -kHighest)
+				return false;
+		}
+		result = static_cast<Acc>(value);
+		return true;
+	}
+
+	/**
+	*	Sum operation. Operands over the same denominator only add their numerators.
+	*/
+	struct Add {
+		static constexpr int numeratorBits(int lhsNum, int lhsDen, int rhsNum, int rhsDen) {
+			return (lhsNum + rhsDen > rhsNum + lhsDen ? lhsNum + rhsDen : rhsNum + lhsDen) + 1;
+		}
+
+		static constexpr int denominatorBits(int, int lhsDen, int, int rhsDen) {
+			return lhsDen + rhsDen;
+		}
+
+		template <bool Checked, typename Acc>
+		static bool combine(Acc& num, Acc& den, Acc rhsNum, Acc rhsDen) {
+			if (den == rhsDen)
+				return add<Checked>(num, rhsNum, num);
+			Acc lhsTerm, rhsTerm;
+			return multiply<Checked>(num, rhsDen, lhsTerm) && multiply<Checked>(rhsNum, den, rhsTerm)
+				&& add<Checked>(lhsTerm, rhsTerm, num) && multiply<Checked>(den, rhsDen, den);
+		}
+
+		template <typename IntT>
+		static BasicFraction<IntT> apply(const BasicFraction<IntT>& lhs, const BasicFraction<IntT>& rhs) {
+			return lhs + rhs;
+		}
+	};
+
+	/**
+	*	Difference operation, bounded like the sum.
+	*/
+	struct Subtract {
+		static constexpr int numeratorBits(int lhsNum, int lhsDen, int rhsNum, int rhsDen) {
+			return Add::numeratorBits(lhsNum, lhsDen, rhsNum, rhsDen);
+		}
+
+		static constexpr int denominatorBits(int lhsNum, int lhsDen, int rhsNum, int rhsDen) {
+			return Add::denominatorBits(lhsNum, lhsDen, rhsNum, rhsDen);
+		}
+
+		template <bool Checked, typename Acc>
+		static bool combine(Acc& num, Acc& den, Acc rhsNum, Acc rhsDen) {
+			if (den == rhsDen)
+				return subtract<Checked>(num, rhsNum, num);
+			Acc lhsTerm, rhsTerm;
+			return multiply<Checked>(num, rhsDen, lhsTerm) && multiply<Checked>(rhsNum, den, rhsTerm)
+				&& subtract<Checked>(lhsTerm, rhsTerm, num) && multiply<Checked>(den, rhsDen, den);
+		}
+
+		template <typename IntT>
+		static BasicFraction<IntT> apply(const BasicFraction<IntT>& lhs, const BasicFraction<IntT>& rhs) {
+			return lhs - rhs;
+		}
+	};
+
+	/**
+	*	Product operation.
+	*/
+	struct Multiply {
+		static constexpr int numeratorBits(int lhsNum, int, int rhsNum, int) {
+			return lhsNum + rhsNum;
+		}
+
+		static constexpr int denominatorBits(int, int lhsDen, int, int rhsDen) {
+			return lhsDen + rhsDen;
+		}
+
+		template <bool Checked, typename Acc>
+		static bool combine(Acc& num, Acc& den, Acc rhsNum, Acc rhsDen) {
+			return multiply<Checked>(num, rhsNum, num) && multiply<Checked>(den, rhsDen, den);
+		}
+
+		template <typename IntT>
+		static BasicFraction<IntT> apply(const BasicFraction<IntT>& lhs, const BasicFraction<IntT>& rhs) {
+			return lhs * rhs;
+		}
+	};
+
+	/**
+	*	Quotient operation. The sign of the denominator is left to the final reduction.
+	*/
+	struct Divide {
+		static constexpr int numeratorBits(int lhsNum, int, int, int rhsDen) {
+			return lhsNum + rhsDen;
+		}
+
+		static constexpr int denominatorBits(int, int lhsDen, int rhsNum, int) {
+			return lhsDen + rhsNum;
+		}
+
+		template <bool Checked, typename Acc>
+		static bool combine(Acc& num, Acc& den, Acc rhsNum, Acc rhsDen) {
+			return multiply<Checked>(num, rhsDen, num) && multiply<Checked>(den, rhsNum, den);
+		}
+
+		template <typename IntT>
+		static BasicFraction<IntT> apply(const BasicFraction<IntT>& lhs, const BasicFraction<IntT>& rhs) {
+			return lhs / rhs;
+		}
+	};
+
+	/**
+	*	Leaf holding a fraction operand by value.
+	*/
+	template <typename IntT>
+	struct Operand {
+		using Integer = IntT;
+		static constexpr int kNumeratorBits = bitsOf<IntT>();
+		static constexpr int kDenominatorBits = bitsOf<IntT>();
+
+		BasicFraction<IntT> value;
+
+		template <bool Checked, typename Acc>
+		bool expand(Acc& num, Acc& den) const {
+			return load(value.getNumerator(), num) && load(value.getDenominator(), den);
+		}
+
+		BasicFraction<IntT> stepwise() const {
+			return value;
+		}
+	};
+
+	/**
+	*	Leaf holding an integer operand, whose denominator of one costs no bits.
+	*/
+	template <typename IntT>
+	struct Whole {
+		using Integer = IntT;
+		static constexpr int kNumeratorBits = bitsOf<IntT>();
+		static constexpr int kDenominatorBits = 0;
+
+		IntT value;
+
+		template <bool Checked, typename Acc>
+		bool expand(Acc& num, Acc& den) const {
+			den = 1;
+			return load(value, num);
+		}
+
+		BasicFraction<IntT> stepwise() const {
+			return BasicFraction<IntT>(value);
+		}
+	};
+
+	template <typename Expression> BasicFraction<typename Expression::Integer> evaluate(const Expression& expression);
+
+	/**
+	*	Interior node applying Op to two subexpressions held by value.
+	*/
+	template <typename Op, typename Lhs, typename Rhs>
+	struct Node {
+		using Integer = typename Lhs::Integer;
+		static_assert(std::is_same<Integer, typename Rhs::Integer>::value, "operands of one expression must share an integer type");
+		static constexpr int kNumeratorBits = Op::numeratorBits(Lhs::kNumeratorBits, Lhs::kDenominatorBits, Rhs::kNumeratorBits, Rhs::kDenominatorBits);
+		static constexpr int kDenominatorBits = Op::denominatorBits(Lhs::kNumeratorBits, Lhs::kDenominatorBits, Rhs::kNumeratorBits, Rhs::kDenominatorBits);
+
+		Lhs lhs;
+		Rhs rhs;
+
+		/**
+		*	Expands the unreduced value of this node into num/den.
+		*
+		*	@return false if an intermediate value overflowed (only possible when Checked)
+		*/
+		template <bool Checked, typename Acc>
+		bool expand(Acc& num, Acc& den) const {
+			Acc rhsNum, rhsDen;
+			return lhs.template expand<Checked>(num, den) && rhs.template expand<Checked>(rhsNum, rhsDen)
+				&& Op::template combine<Checked>(num, den, rhsNum, rhsDen);
+		}
+
+		/**
+		*	Evaluates this node with the ordinary operators, reducing after every step.
+		*/
+		BasicFraction<Integer> stepwise() const {
+			return Op::apply(lhs.stepwise(), rhs.stepwise());
+		}
+
+		operator BasicFraction<Integer>() const {
+			return evaluate(*this);
+		}
+	};
+
+	template <typename T> struct IsExpression : std::false_type {};
+	template <typename IntT> struct IsExpression<Operand<IntT>> : std::true_type {};
+	template <typename IntT> struct IsExpression<Whole<IntT>> : std::true_type {};
+	template <typename Op, typename Lhs, typename Rhs> struct IsExpression<Node<Op, Lhs, Rhs>> : std::true_type {};
+
+	/**
+	*	Integer type of an operator whose operands are Lhs and Rhs, taken from whichever is an expression.
+	*/
+	template <typename Lhs, typename Rhs>
+	using IntegerOf = typename std::conditional_t<IsExpression<Lhs>::value, Lhs, Rhs>::Integer;
+
+	/**
+	*	Turns an operand of an expression operator into a node: expressions stay as they are, fractions become
+	*	Operand leaves and integers Whole leaves.
+	*/
+	template <typename IntT, typename T>
+	auto wrap(const T& value) {
+		if constexpr (IsExpression<T>::value)
+			return value;
+		else if constexpr (std::is_same<T, BasicFraction<IntT>>::value)
+			return Operand<IntT>{ value };
+		else
+			return Whole<IntT>{ static_cast<IntT>(value) };
+	}
+
+	template <typename Op, typename Lhs, typename Rhs>
+	auto makeNode(const Lhs& lhs, const Rhs& rhs) {
+		using IntT = IntegerOf<Lhs, Rhs>;
+		using LhsNode = decltype(wrap<IntT>(lhs));
+		using RhsNode = decltype(wrap<IntT>(rhs));
+		return Node<Op, LhsNode, RhsNode>{ wrap<IntT>(lhs), wrap<IntT>(rhs) };
+	}
+
+	template <typename Lhs, typename Rhs>
+	using EnableIfExpression = std::enable_if_t<IsExpression<Lhs>::value || IsExpression<Rhs>::value>;
+
+	template <typename Lhs, typename Rhs, typename = EnableIfExpression<Lhs, Rhs>>
+	auto operator+(const Lhs& lhs, const Rhs& rhs) {
+		return makeNode<Add>(lhs, rhs);
+	}
+
+	template <typename Lhs, typename Rhs, typename = EnableIfExpression<Lhs, Rhs>>
+	auto operator-(const Lhs& lhs, const Rhs& rhs) {
+		return makeNode<Subtract>(lhs, rhs);
+	}
+
+	template <typename Lhs, typename Rhs, typename = EnableIfExpression<Lhs, Rhs>>
+	auto operator*(const Lhs& lhs, const Rhs& rhs) {
+		return makeNode<Multiply>(lhs, rhs);
+	}
+
+	template <typename Lhs, typename Rhs, typename = EnableIfExpression<Lhs, Rhs>>
+	auto operator/(const Lhs& lhs, const Rhs& rhs) {
+		return makeNode<Divide>(lhs, rhs);
+	}
+
+	/**
+	*	Reduces an expanded value once and narrows it back into a fraction.
+	*/
+	template <typename IntT>
+	struct Finish {
+		/**
+		*	@return false if the reduced value does not fit an IntT, the denominator is zero or an accumulator
+		*	holds its most negative value; the caller then falls back to the ordinary operators
+		*/
+		template <typename Acc>
+		static bool narrow(Acc num, Acc den, BasicFraction<IntT>& result) {
+			constexpr Acc kLowest = static_cast<Acc>(gcd::UnsignedOf<Acc>(1) << bitsOf<Acc>());
+			if (den == 0 || num == kLowest || den == kLowest)
+				return false;
+
+			Acc common;
+			if constexpr (sizeof(Acc) > sizeof(std::int64_t)) {
+				// Most results are small again after the wide products, and the narrow gcd is much cheaper
+				if (num >= -INT64_MAX && num <= INT64_MAX && den >= -INT64_MAX && den <= INT64_MAX)
+					common = static_cast<Acc>(gcd::compute(static_cast<std::int64_t>(num), static_cast<std::int64_t>(den)));
+				else
+					common = static_cast<Acc>(gcd::compute(num, den));
+			}
+			else
+				common = static_cast<Acc>(gcd::compute(num, den));
+			num /= common;
+			den /= common;
+			if (den < 0) {
+				num = -num;
+				den = -den;
+			}
+
+			if constexpr (sizeof(Acc) > sizeof(IntT)) {
+				constexpr Acc kHighest = static_cast<Acc>(~gcd::UnsignedOf<IntT>(0) >> 1);
+				if (num > kHighest || num < -kHighest - 1 || den > kHighest)
+					return false;
+			}
+			result = BasicFraction<IntT>(static_cast<IntT>(num), static_cast<IntT>(den), typename BasicFraction<IntT>::ReducedTag());
+			return true;
+		}
+	};
+
+	/**
+	*	Evaluates an expression with a single reduction, choosing the narrowest accumulator its bounds allow.
+	*
+	*	@param expression the expression to evaluate
+	*	@return the reduced value of the expression
+	*/
+	template <typename Expression>
+	BasicFraction<typename Expression::Integer> evaluate(const Expression& expression) {
+		using IntT = typename Expression::Integer;
+		constexpr int kBits = Expression::kNumeratorBits > Expression::kDenominatorBits
+			? Expression::kNumeratorBits : Expression::kDenominatorBits;
+
+		BasicFraction<IntT> result;
+		std::int64_t num, den;
+		if (expression.template expand<!fitsUnchecked<std::int64_t>(kBits)>(num, den) && Finish<IntT>::narrow(num, den, result))
+			return result;
+#ifdef __SIZEOF_INT128__
+		if constexpr (!fitsUnchecked<std::int64_t>(kBits)) {
+			__int128 wideNum, wideDen;
+			if (expression.template expand<!fitsUnchecked<__int128>(kBits)>(wideNum, wideDen) && Finish<IntT>::narrow(wideNum, wideDen, result))
+				return result;
+		}
+#endif
+		return expression.stepwise();
+	}
+
+	/**
+	*	Starts an expression. The operators of the returned leaf build nodes rather than values.
+	*/
+	template <typename IntT>
+	Operand<IntT> fuse(const BasicFraction<IntT>& value) {
+		return Operand<IntT>{ value };
+	}
+
+	/**
+	*	Evaluates formula over the provided fractions, each of which is passed to it as an expression leaf.
+	*
+	*	@param formula a callable such as a generic lambda building the expression from its arguments
+	*	@return the value of the formula, as the ordinary operators would produce it
+	*/
+	template <typename Formula, typename IntT, typename... Rest>
+	BasicFraction<IntT> apply(Formula formula, const BasicFraction<IntT>& first, const Rest&... rest) {
+		return evaluate(formula(fuse(first), fuse(rest)...));
+	}
+}
@@ -0,0 +1,543 @@
+/**
+* @file		FractionFile.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the binary fraction file writer, the memory-mapped reader and the CRC-32C block checksums.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "FractionFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FRACTION_CRC_HARDWARE 1
+#include <nmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define FRACTION_TARGET_SSE42
+#else
+#define FRACTION_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif
+#else
+#define FRACTION_CRC_HARDWARE 0
+#endif
+
+namespace {
+
+	const char kMagic[8] = { 'F', 'R', 'A', 'C', 'T', 'I', 'O', 'N' };
+	constexpr std::uint32_t kVersion = 1;
+	constexpr std::uint32_t kEndianTag = 0x01020304;
+	// Varint blocks must fit their byte counts into 32 bits, at up to 10 bytes per value
+	constexpr std::uint32_t kMaxBlockSize = 1u << 26;
+
+	/**
+	*	Lookup tables for slicing-by-8 CRC-32C: entry k of table i is the CRC of byte k followed by i zero bytes.
+	*/
+	struct CrcTables
+	{
+		std::uint32_t entries[8][256];
+
+		CrcTables() {
+			for (std::uint32_t i = 0; i < 256; ++i) {
+				std::uint32_t crc = i;
+				for (int bit = 0; bit < 8; ++bit)
+					crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1)));
+				entries[0][i] = crc;
+			}
+			for (int table = 1; table < 8; ++table) {
+				for (int i = 0; i < 256; ++i)
+					entries[table][i] = (entries[table - 1][i] >> 8) ^ entries[0][entries[table - 1][i] & 0xff];
+			}
+		}
+	};
+
+	std::uint32_t crcSoftware(std::uint32_t crc, const unsigned char* bytes, std::size_t count) {
+		static const CrcTables tables;
+		const auto& t = tables.entries;
+		for (; count >= 8; count -= 8, bytes += 8) {
+			std::uint64_t word;
+			std::memcpy(&word, bytes, 8);
+			word ^= crc;
+			crc = t[7][word & 0xff] ^ t[6][(word >> 8) & 0xff] ^ t[5][(word >> 16) & 0xff] ^ t[4][(word >> 24) & 0xff]
+				^ t[3][(word >> 32) & 0xff] ^ t[2][(word >> 40) & 0xff] ^ t[1][(word >> 48) & 0xff] ^ t[0][word >> 56];
+		}
+		for (; count > 0; --count, ++bytes)
+			crc = t[0][(crc ^ *bytes) & 0xff] ^ (crc >> 8);
+		return crc;
+	}
+
+#if FRACTION_CRC_HARDWARE
+	FRACTION_TARGET_SSE42
+	std::uint32_t crcHardware(std::uint32_t crc, const unsigned char* bytes, std::size_t count) {
+		std::uint64_t wide = crc;
+		for (; count >= 8; count -= 8, bytes += 8) {
+			std::uint64_t word;
+			std::memcpy(&word, bytes, 8);
+			wide = _mm_crc32_u64(wide, word);
+		}
+		crc = static_cast<std::uint32_t>(wide);
+		for (; count > 0; --count, ++bytes)
+			crc = _mm_crc32_u8(crc, *bytes);
+		return crc;
+	}
+
+	bool hasCrcInstruction() {
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 20)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse4.2");
+#endif
+	}
+#endif
+
+	bool isLittleEndian() {
+		std::uint32_t probe = 1;
+		unsigned char first;
+		std::memcpy(&first, &probe, 1);
+		return first == 1;
+	}
+
+	std::uint64_t alignUp(std::uint64_t offset, std::uint64_t alignment) {
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	/**
+	*	Appends a signed value as a zigzag LEB128 varint, so that small magnitudes of either sign take few bytes.
+	*/
+	void appendVarint(std::vector<unsigned char>& out, std::int64_t value) {
+		std::uint64_t zigzag = (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+		while (zigzag >= 0x80) {
+			out.push_back(static_cast<unsigned char>(zigzag | 0x80));
+			zigzag >>= 7;
+		}
+		out.push_back(static_cast<unsigned char>(zigzag));
+	}
+
+	/**
+	*	Reads one zigzag LEB128 varint, refusing to run past the end of its block.
+	*/
+	std::int64_t readVarint(const unsigned char*& position, const unsigned char* last) {
+		std::uint64_t zigzag = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (position == last)
+				throw std::runtime_error("fraction file: varint runs past the end of its block");
+			unsigned char byte = *position++;
+			zigzag |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+			if ((byte & 0x80) == 0)
+				return static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+		}
+		throw std::runtime_error("fraction file: varint longer than 10 bytes");
+	}
+
+	template <typename IntT>
+	std::vector<unsigned char> encodeBlock(const IntT* values, std::size_t count, FractionEncoding encoding) {
+		std::vector<unsigned char> bytes;
+		if (encoding == FractionEncoding::Fixed) {
+			bytes.resize(count * sizeof(IntT));
+			if (count != 0)
+				std::memcpy(bytes.data(), values, bytes.size());
+		}
+		else {
+			bytes.reserve(count * 2);
+			for (std::size_t i = 0; i < count; ++i)
+				appendVarint(bytes, values[i]);
+		}
+		return bytes;
+	}
+
+	void writeBytes(std::ofstream& file, const void* bytes, std::size_t count) {
+		file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+	}
+
+	void padTo(std::ofstream& file, std::uint64_t& position, std::uint64_t target) {
+		static const char zeros[64] = {};
+		while (position < target) {
+			std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(sizeof(zeros), target - position));
+			writeBytes(file, zeros, count);
+			position += count;
+		}
+	}
+}
+
+/**
+*	Computes the CRC-32C (Castagnoli) checksum of a byte range, with the SSE4.2 instruction when the processor has it.
+*
+*	@param data first byte
+*	@param length number of bytes
+*	@return the checksum
+*/
+std::uint32_t fractionFileChecksum(const void* data, std::size_t length) {
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+#if FRACTION_CRC_HARDWARE
+	static const bool hardware = hasCrcInstruction();
+	if (hardware)
+		return ~crcHardware(~0u, bytes, length);
+#endif
+	return ~crcSoftware(~0u, bytes, length);
+}
+
+/**
+*	Writes fractions to a new file. Fixed encoding stores each column contiguously and 64-byte aligned, so a reader
+*	can use it in place; varint encoding trades that for size when the values are small.
+*
+*	@param path file to create or overwrite
+*	@param fractions the fractions to store, in simplest form
+*	@param encoding how the columns are stored
+*	@param blockSize fractions per checksummed block
+*/
+template <typename IntT>
+void writeFractionFile(const std::string& path, const BasicFractionView<IntT>& fractions, FractionEncoding encoding, std::uint32_t blockSize) {
+	if (blockSize == 0 || blockSize > kMaxBlockSize)
+		throw std::invalid_argument("fraction file: block size must be between 1 and 2^26");
+	if (!isLittleEndian())
+		throw std::runtime_error("fraction file: only little-endian machines are supported");
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file)
+		throw std::runtime_error("fraction file: cannot create " + path);
+
+	FractionFileHeader header = {};
+	std::memcpy(header.magic, kMagic, sizeof(kMagic));
+	header.version = kVersion;
+	header.endianTag = kEndianTag;
+	header.encoding = static_cast<std::uint32_t>(encoding);
+	header.integerBytes = sizeof(IntT);
+	header.blockSize = blockSize;
+	header.count = fractions.size();
+	header.blockCount = (header.count + blockSize - 1) / blockSize;
+
+	// Header and block table are written last, once the offsets and checksums are known
+	std::vector<FractionFileBlock> blocks(static_cast<std::size_t>(header.blockCount));
+	std::uint64_t position = 0;
+	padTo(file, position, sizeof(header) + blocks.size() * sizeof(FractionFileBlock));
+
+	const IntT* columns[2] = { fractions.numerators(), fractions.denominators() };
+	for (int column = 0; column < 2; ++column) {
+		padTo(file, position, alignUp(position, 64));
+		(column == 0 ? header.numeratorOffset : header.denominatorOffset) = position;
+		for (std::size_t block = 0; block < blocks.size(); ++block) {
+			std::size_t first = block * blockSize;
+			std::size_t count = std::min<std::size_t>(blockSize, fractions.size() - first);
+			std::vector<unsigned char> bytes = encodeBlock(columns[column] + first, count, encoding);
+			std::uint32_t checksum = fractionFileChecksum(bytes.data(), bytes.size());
+			if (column == 0) {
+				blocks[block].numeratorOffset = position;
+				blocks[block].numeratorBytes = static_cast<std::uint32_t>(bytes.size());
+				blocks[block].numeratorChecksum = checksum;
+			}
+			else {
+				blocks[block].denominatorOffset = position;
+				blocks[block].denominatorBytes = static_cast<std::uint32_t>(bytes.size());
+				blocks[block].denominatorChecksum = checksum;
+			}
+			writeBytes(file, bytes.data(), bytes.size());
+			position += bytes.size();
+		}
+	}
+
+	header.headerChecksum = fractionFileChecksum(&header, sizeof(header));
+	file.seekp(0);
+	writeBytes(file, &header, sizeof(header));
+	if (!blocks.empty())
+		writeBytes(file, blocks.data(), blocks.size() * sizeof(FractionFileBlock));
+	file.flush();
+	if (!file)
+		throw std::runtime_error("fraction file: failed writing " + path);
+}
+
+/**
+*	Maps a fraction file into memory and checks its header and block table. Column data is only touched when read,
+*	and its checksums only when verify() or verifyBlock() is called.
+*
+*	@param path file to open
+*/
+FractionFileReader::FractionFileReader(const std::string& path) : data(nullptr), length(0), fileHandle(nullptr), mappingHandle(nullptr), blocks(nullptr) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("fraction file: cannot open " + path);
+	fileHandle = file;
+	LARGE_INTEGER size;
+	GetFileSizeEx(file, &size);
+	length = static_cast<std::size_t>(size.QuadPart);
+	if (length != 0) {
+		mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle != nullptr)
+			data = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (data == nullptr) {
+			unmap();
+			throw std::runtime_error("fraction file: cannot map " + path);
+		}
+	}
+#else
+	int file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0)
+		throw std::runtime_error("fraction file: cannot open " + path);
+	struct stat status;
+	if (::fstat(file, &status) != 0) {
+		::close(file);
+		throw std::runtime_error("fraction file: cannot stat " + path);
+	}
+	length = static_cast<std::size_t>(status.st_size);
+	if (length != 0) {
+		void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, 0);
+		if (mapped == MAP_FAILED) {
+			::close(file);
+			throw std::runtime_error("fraction file: cannot map " + path);
+		}
+		data = static_cast<const unsigned char*>(mapped);
+		::madvise(mapped, length, MADV_SEQUENTIAL);
+	}
+	// The mapping keeps the file contents alive on its own
+	::close(file);
+#endif
+
+	try {
+		if (length < sizeof(header))
+			throw std::runtime_error("fraction file: too short for a header");
+		std::memcpy(&header, data, sizeof(header));
+		if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+			throw std::runtime_error("fraction file: not a fraction file");
+		if (header.version != kVersion)
+			throw std::runtime_error("fraction file: unsupported version");
+		if (header.endianTag != kEndianTag)
+			throw std::runtime_error("fraction file: written with a different byte order");
+
+		FractionFileHeader unchecked = header;
+		unchecked.headerChecksum = 0;
+		if (fractionFileChecksum(&unchecked, sizeof(unchecked)) != header.headerChecksum)
+			throw std::runtime_error("fraction file: header checksum mismatch");
+		if ((header.integerBytes != 4 && header.integerBytes != 8) || header.encoding > 1 || header.blockSize == 0 || header.blockSize > kMaxBlockSize)
+			throw std::runtime_error("fraction file: invalid header");
+		if (header.blockCount != (header.count + header.blockSize - 1) / header.blockSize
+			|| header.blockCount > (length - sizeof(header)) / sizeof(FractionFileBlock))
+			throw std::runtime_error("fraction file: invalid block table");
+
+		blocks = reinterpret_cast<const FractionFileBlock*>(data + sizeof(header));
+		for (std::uint64_t block = 0; block < header.blockCount; ++block) {
+			const FractionFileBlock& entry = blocks[block];
+			std::uint64_t elements = std::min<std::uint64_t>(header.blockSize, header.count - block * header.blockSize);
+			bool fixed = encoding() == FractionEncoding::Fixed;
+			if (entry.numeratorOffset > length || entry.numeratorBytes > length - entry.numeratorOffset
+				|| entry.denominatorOffset > length || entry.denominatorBytes > length - entry.denominatorOffset
+				|| (fixed && (entry.numeratorBytes != elements * header.integerBytes || entry.denominatorBytes != elements * header.integerBytes
+					|| entry.numeratorOffset != header.numeratorOffset + block * header.blockSize * header.integerBytes
+					|| entry.denominatorOffset != header.denominatorOffset + block * header.blockSize * header.integerBytes)))
+				throw std::runtime_error("fraction file: block outside the file");
+		}
+	}
+	catch (...) {
+		unmap();
+		throw;
+	}
+}
+
+FractionFileReader::~FractionFileReader() {
+	unmap();
+}
+
+void FractionFileReader::unmap() {
+#ifdef _WIN32
+	if (data != nullptr)
+		UnmapViewOfFile(data);
+	if (mappingHandle != nullptr)
+		CloseHandle(mappingHandle);
+	if (fileHandle != nullptr)
+		CloseHandle(fileHandle);
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+#else
+	if (data != nullptr)
+		::munmap(const_cast<unsigned char*>(data), length);
+#endif
+	data = nullptr;
+}
+
+std::uint64_t FractionFileReader::size() const {
+	return header.count;
+}
+
+FractionEncoding FractionFileReader::encoding() const {
+	return static_cast<FractionEncoding>(header.encoding);
+}
+
+std::uint32_t FractionFileReader::integerBytes() const {
+	return header.integerBytes;
+}
+
+std::uint32_t FractionFileReader::blockSize() const {
+	return header.blockSize;
+}
+
+std::uint64_t FractionFileReader::blockCount() const {
+	return header.blockCount;
+}
+
+/**
+*	Checks both columns of one block against their stored checksums.
+*
+*	@param block index of the block
+*	@return true if the block is intact
+*/
+bool FractionFileReader::verifyBlock(std::uint64_t block) const {
+	const FractionFileBlock& entry = blocks[block];
+	return fractionFileChecksum(data + entry.numeratorOffset, entry.numeratorBytes) == entry.numeratorChecksum
+		&& fractionFileChecksum(data + entry.denominatorOffset, entry.denominatorBytes) == entry.denominatorChecksum;
+}
+
+/**
+*	Checks every block of the file against its stored checksums.
+*
+*	@return true if the whole file is intact
+*/
+bool FractionFileReader::verify() const {
+	for (std::uint64_t block = 0; block < header.blockCount; ++block) {
+		if (!verifyBlock(block))
+			return false;
+	}
+	return true;
+}
+
+/**
+*	Returns the columns of a fixed width file in place, without copying or decoding. The view is valid for the
+*	lifetime of the reader and can be passed straight to the FractionArray kernels. Checksums are not verified here.
+*
+*	@return a view of every fraction in the file
+*/
+template <typename IntT>
+BasicFractionView<IntT> FractionFileReader::view() const {
+	if (encoding() != FractionEncoding::Fixed || header.integerBytes != sizeof(IntT))
+		throw std::logic_error("fraction file: only fixed width files of the same integer size can be viewed in place");
+	// The mapping starts on a page boundary, so aligned offsets give aligned columns
+	if (header.numeratorOffset % alignof(IntT) != 0 || header.denominatorOffset % alignof(IntT) != 0)
+		throw std::runtime_error("fraction file: columns are not aligned for use in place");
+	return BasicFractionView<IntT>(reinterpret_cast<const IntT*>(data + header.numeratorOffset),
+		reinterpret_cast<const IntT*>(data + header.denominatorOffset), static_cast<std::size_t>(header.count));
+}
+
+/**
+*	Decodes one block into the provided columns, widening 32-bit files into 64-bit fractions when asked to.
+*/
+template <typename IntT>
+void FractionFileReader::decodeBlock(std::uint64_t block, IntT* numerators, IntT* denominators) const {
+	const FractionFileBlock& entry = blocks[block];
+	std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(header.blockSize, header.count - block * header.blockSize));
+	const unsigned char* sources[2] = { data + entry.numeratorOffset, data + entry.denominatorOffset };
+	const std::uint32_t sizes[2] = { entry.numeratorBytes, entry.denominatorBytes };
+	IntT* targets[2] = { numerators, denominators };
+
+	for (int column = 0; column < 2; ++column) {
+		if (encoding() == FractionEncoding::Fixed) {
+			if (header.integerBytes == sizeof(IntT)) {
+				std::memcpy(targets[column], sources[column], count * sizeof(IntT));
+			}
+			else {
+				for (std::size_t i = 0; i < count; ++i) {
+					std::int32_t value;
+					std::memcpy(&value, sources[column] + i * sizeof(value), sizeof(value));
+					targets[column][i] = value;
+				}
+			}
+		}
+		else {
+			const unsigned char* position = sources[column];
+			const unsigned char* last = position + sizes[column];
+			for (std::size_t i = 0; i < count; ++i) {
+				std::int64_t value = readVarint(position, last);
+				if (sizeof(IntT) < sizeof(value) && static_cast<IntT>(value) != value)
+					throw std::runtime_error("fraction file: value does not fit the integer type");
+				targets[column][i] = static_cast<IntT>(value);
+			}
+		}
+	}
+}
+
+/**
+*	Copies every fraction in the file into an array, decoding varint files. Checksums are not verified here.
+*
+*	@param out array receiving the fractions
+*/
+template <typename IntT>
+void FractionFileReader::read(BasicFractionArray<IntT>& out) const {
+	if (header.integerBytes > sizeof(IntT))
+		throw std::logic_error("fraction file: 64-bit fractions cannot be read into a 32-bit array");
+	out.resize(static_cast<std::size_t>(header.count));
+	for (std::uint64_t block = 0; block < header.blockCount; ++block) {
+		std::size_t first = static_cast<std::size_t>(block * header.blockSize);
+		decodeBlock(block, out.numerators() + first, out.denominators() + first);
+	}
+}
+
+/**
+*	Copies the fractions of one block into an array, replacing its contents. Checksums are not verified here.
+*
+*	@param block index of the block
+*	@param out array receiving the fractions
+*/
+template <typename IntT>
+void FractionFileReader::readBlock(std::uint64_t block, BasicFractionArray<IntT>& out) const {
+	if (header.integerBytes > sizeof(IntT))
+		throw std::logic_error("fraction file: 64-bit fractions cannot be read into a 32-bit array");
+	if (block >= header.blockCount)
+		throw std::out_of_range("fraction file: no such block");
+	out.resize(static_cast<std::size_t>(std::min<std::uint64_t>(header.blockSize, header.count - block * header.blockSize)));
+	decodeBlock(block, out.numerators(), out.denominators());
+}
+
+template void writeFractionFile<std::int32_t>(const std::string&, const BasicFractionView<std::int32_t>&, FractionEncoding, std::uint32_t);
+template void writeFractionFile<std::int64_t>(const std::string&, const BasicFractionView<std::int64_t>&, FractionEncoding, std::uint32_t);
+template BasicFractionView<std::int32_t> FractionFileReader::view<std::int32_t>() const;
+template BasicFractionView<std::int64_t> FractionFileReader::view<std::int64_t>() const;
+template void FractionFileReader::read<std::int32_t>(BasicFractionArray<std::int32_t>&) const;
+#ifdef __SIZEOF_INT128__
+template void FractionFileReader::read<std::int64_t>(BasicFractionArray<std::int64_t>&) const;
+#endif
+template void FractionFileReader::readBlock<std::int32_t>(std::uint64_t, BasicFractionArray<std::int32_t>&) const;
+#ifdef __SIZEOF_INT128__
+template void FractionFileReader::readBlock<std::int64_t>(std::uint64_t, BasicFractionArray<std::int64_t>&) const;
+#endif
@@ -0,0 +1,132 @@
+#pragma once
+/**
+* @file		FractionFile.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Binary columnar file format for large collections of fractions, and a memory-mapped reader.
+*  A file holds a header, a table of blocks and the numerator and denominator columns, stored either as
+*  fixed width little-endian integers (which the reader hands out in place, without copying) or as zigzag
+*  varints. Every block of every column carries a CRC-32C checksum.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "FractionArray.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class FractionEncoding : std::uint32_t {
+	Fixed = 0,
+	Varint = 1
+};
+
+/**
+*	First 64 bytes of a fraction file. All fields are little-endian.
+*/
+struct FractionFileHeader
+{
+	char magic[8];
+	std::uint32_t version;
+	// 0x01020304 as written by the producer, so a reader on a big-endian machine can refuse the file
+	std::uint32_t endianTag;
+	std::uint32_t encoding;
+	std::uint32_t integerBytes;
+	std::uint32_t blockSize;
+	// CRC-32C of the header with this field set to 0
+	std::uint32_t headerChecksum;
+	std::uint64_t count;
+	std::uint64_t blockCount;
+	std::uint64_t numeratorOffset;
+	std::uint64_t denominatorOffset;
+};
+
+/**
+*	Entry of the block table that follows the header: where each column of a block lives, and its checksum.
+*/
+struct FractionFileBlock
+{
+	std::uint64_t numeratorOffset;
+	std::uint64_t denominatorOffset;
+	std::uint32_t numeratorBytes;
+	std::uint32_t denominatorBytes;
+	std::uint32_t numeratorChecksum;
+	std::uint32_t denominatorChecksum;
+};
+
+static_assert(sizeof(FractionFileHeader) == 64, "the file header must stay 64 bytes");
+static_assert(sizeof(FractionFileBlock) == 32, "block table entries must stay 32 bytes");
+
+constexpr std::uint32_t kFractionFileBlockSize = 1 << 16;
+
+std::uint32_t fractionFileChecksum(const void* data, std::size_t length);
+
+template <typename IntT>
+void writeFractionFile(const std::string& path, const BasicFractionView<IntT>& fractions,
+	FractionEncoding encoding = FractionEncoding::Fixed, std::uint32_t blockSize = kFractionFileBlockSize);
+
+/**
+*	Read-only, memory-mapped access to a fraction file. Opening checks the header, its checksum and that every
+*	block lies inside the file; view(), read() and readBlock() then trust the column contents, and only
+*	verify() and verifyBlock() compare them against their checksums. Call verify() first on untrusted files.
+*/
+class FractionFileReader
+{
+
+public:
+	explicit FractionFileReader(const std::string& path);
+	~FractionFileReader();
+
+	FractionFileReader(const FractionFileReader&) = delete;
+	FractionFileReader& operator=(const FractionFileReader&) = delete;
+
+	std::uint64_t size() const;
+	FractionEncoding encoding() const;
+	std::uint32_t integerBytes() const;
+	std::uint32_t blockSize() const;
+	std::uint64_t blockCount() const;
+
+	bool verifyBlock(std::uint64_t block) const;
+	bool verify() const;
+
+	template <typename IntT> BasicFractionView<IntT> view() const;
+	template <typename IntT> void read(BasicFractionArray<IntT>& out) const;
+	template <typename IntT> void readBlock(std::uint64_t block, BasicFractionArray<IntT>& out) const;
+
+private:
+	const unsigned char* data;
+	std::size_t length;
+	// Windows file and mapping handles; unused elsewhere
+	void* fileHandle;
+	void* mappingHandle;
+
+	FractionFileHeader header;
+	const FractionFileBlock* blocks;
+
+	template <typename IntT> void decodeBlock(std::uint64_t block, IntT* numerators, IntT* denominators) const;
+	void unmap();
+
+};
@@ -0,0 +1,136 @@
+#pragma once
+/**
+* @file		FractionHashMap.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Open-addressing hash map keyed by fractions, and an interning table that gives each distinct fraction
+*  a small integer id so that equal values compare as a single integer.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "Fraction.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+*	Hash map from fractions to values, using open addressing with linear probing over a power of two table.
+*	A byte per slot holds a 7 bit tag taken from the top of the key's hash (zero marks an empty slot), so a probe
+*	compares keys only when the tags match; erasing shifts the rest of the probe run back, leaving no tombstones.
+*	Pointers returned by find() and operator[] stay valid until the next insertion or erasure.
+*/
+template <typename IntT, typename Value>
+class BasicFractionHashMap
+{
+
+public:
+	using Key = BasicFraction<IntT>;
+
+	BasicFractionHashMap();
+	explicit BasicFractionHashMap(std::size_t count);
+
+	std::size_t size() const;
+	bool empty() const;
+	std::size_t capacity() const;
+	void reserve(std::size_t count);
+	void clear();
+
+	Value& operator[](const Key& key);
+	bool insert(const Key& key, const Value& value);
+	std::pair<Value*, bool> tryEmplace(const Key& key, const Value& value);
+	Value* find(const Key& key);
+	const Value* find(const Key& key) const;
+	bool contains(const Key& key) const;
+	bool erase(const Key& key);
+	template <typename Function> void forEach(Function function) const;
+
+private:
+	struct Slot
+	{
+		Key key;
+		Value value;
+
+		Slot() : key(0), value() {}
+	};
+
+	// Slots are kept at most three quarters full, which keeps probe runs short under linear probing
+	static constexpr std::size_t kMinimumSlots = 16;
+	static constexpr std::uint8_t kEmpty = 0;
+
+	std::vector<std::uint8_t> tags;
+	std::vector<Slot> slots;
+	std::size_t count;
+
+	static std::uint8_t tagOf(std::uint64_t hash);
+	std::size_t slotMask() const;
+	std::size_t locate(const Key& key, std::uint64_t hash, std::uint8_t tag) const;
+	std::size_t emplace(const Key& key, bool& inserted);
+	void rehash(std::size_t slotCount);
+
+};
+
+/**
+*	Interning table giving each distinct fraction a dense id, in order of first appearance. Interned values are
+*	stored once, and two ids from the same table are equal exactly when their fractions are, so comparing and
+*	hashing interned values costs a single integer operation.
+*/
+template <typename IntT>
+class BasicFractionInterner
+{
+
+public:
+	using Id = std::uint32_t;
+	using Element = BasicFraction<IntT>;
+
+	BasicFractionInterner();
+
+	Id intern(const Element& value);
+	bool lookup(const Element& value, Id& id) const;
+	const Element& operator[](Id id) const;
+
+	std::size_t size() const;
+	void reserve(std::size_t count);
+	void clear();
+
+private:
+	BasicFractionHashMap<IntT, Id> ids;
+	std::vector<Element> values;
+
+};
+
+// Interning tables of the original int fraction, and the fixed width variant
+using FractionInterner = BasicFractionInterner<int>;
+using FractionInterner64 = BasicFractionInterner<std::int64_t>;
+
+#include "FractionHashMap.inl"
+
+// Instantiated once in FractionHashMap.cpp
+extern template class BasicFractionHashMap<std::int32_t, std::uint32_t>;
+extern template class BasicFractionHashMap<std::int64_t, std::uint32_t>;
+extern template class BasicFractionInterner<std::int32_t>;
+extern template class BasicFractionInterner<std::int64_t>;
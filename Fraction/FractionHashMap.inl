@@ -0,0 +1,382 @@
+/**
+* @file		FractionHashMap.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Template implementation of the fraction hash map and interning table, included from FractionHashMap.h.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <algorithm>
+
+/**
+*	Constructs an empty map. No table is allocated until the first insertion.
+*/
+template <typename IntT, typename Value>
+BasicFractionHashMap<IntT, Value>::BasicFractionHashMap()
+	: count(0) {
+}
+
+/**
+*	Constructs an empty map with room for the provided number of entries.
+*
+*	@param count number of entries to make room for
+*/
+template <typename IntT, typename Value>
+BasicFractionHashMap<IntT, Value>::BasicFractionHashMap(std::size_t count)
+	: count(0) {
+	reserve(count);
+}
+
+/**
+*	@return the number of entries in the map
+*/
+template <typename IntT, typename Value>
+std::size_t BasicFractionHashMap<IntT, Value>::size() const {
+	return count;
+}
+
+/**
+*	@return true if the map holds no entries
+*/
+template <typename IntT, typename Value>
+bool BasicFractionHashMap<IntT, Value>::empty() const {
+	return count == 0;
+}
+
+/**
+*	@return the number of entries the map can hold before its table grows
+*/
+template <typename IntT, typename Value>
+std::size_t BasicFractionHashMap<IntT, Value>::capacity() const {
+	return slots.size() / 4 * 3;
+}
+
+/**
+*	Grows the table so that the provided number of entries fit without a further rehash.
+*
+*	@param count number of entries to make room for
+*/
+template <typename IntT, typename Value>
+void BasicFractionHashMap<IntT, Value>::reserve(std::size_t count) {
+	std::size_t slotCount = kMinimumSlots;
+	while (slotCount / 4 * 3 < count)
+		slotCount *= 2;
+	if (slotCount > slots.size())
+		rehash(slotCount);
+}
+
+/**
+*	Removes every entry, keeping the table.
+*/
+template <typename IntT, typename Value>
+void BasicFractionHashMap<IntT, Value>::clear() {
+	std::fill(tags.begin(), tags.end(), kEmpty);
+	std::fill(slots.begin(), slots.end(), Slot());
+	count = 0;
+}
+
+/**
+*	Returns the value stored for the provided key, inserting a value initialised one if there is none.
+*
+*	@param key fraction to look up
+*	@return a reference to the stored value
+*/
+template <typename IntT, typename Value>
+Value& BasicFractionHashMap<IntT, Value>::operator[](const Key& key) {
+	bool inserted;
+	return slots[emplace(key, inserted)].value;
+}
+
+/**
+*	Inserts the provided entry unless the key is already present, in which case the stored value is kept.
+*
+*	@param key fraction to insert
+*	@param value value to store for it
+*	@return true if the entry was inserted
+*/
+template <typename IntT, typename Value>
+bool BasicFractionHashMap<IntT, Value>::insert(const Key& key, const Value& value) {
+	return tryEmplace(key, value).second;
+}
+
+/**
+*	Inserts the provided entry unless the key is already present, and returns the stored value either way,
+*	so that a lookup followed by an insertion costs a single probe.
+*
+*	@param key fraction to insert
+*	@param value value to store for it
+*	@return a pointer to the stored value, and true if the entry was inserted
+*/
+template <typename IntT, typename Value>
+std::pair<Value*, bool> BasicFractionHashMap<IntT, Value>::tryEmplace(const Key& key, const Value& value) {
+	bool inserted;
+	Slot& slot = slots[emplace(key, inserted)];
+	if (inserted)
+		slot.value = value;
+	return { &slot.value, inserted };
+}
+
+/**
+*	Looks up the value stored for the provided key.
+*
+*	@param key fraction to look up
+*	@return a pointer to the stored value, or nullptr if the key is absent
+*/
+template <typename IntT, typename Value>
+Value* BasicFractionHashMap<IntT, Value>::find(const Key& key) {
+	return const_cast<Value*>(static_cast<const BasicFractionHashMap&>(*this).find(key));
+}
+
+/**
+*	Looks up the value stored for the provided key.
+*
+*	@param key fraction to look up
+*	@return a pointer to the stored value, or nullptr if the key is absent
+*/
+template <typename IntT, typename Value>
+const Value* BasicFractionHashMap<IntT, Value>::find(const Key& key) const {
+	if (count == 0)
+		return nullptr;
+	std::uint64_t hash = key.hash();
+	std::size_t index = locate(key, hash, tagOf(hash));
+	return tags[index] == kEmpty ? nullptr : &slots[index].value;
+}
+
+/**
+*	@param key fraction to look up
+*	@return true if the map holds an entry for the key
+*/
+template <typename IntT, typename Value>
+bool BasicFractionHashMap<IntT, Value>::contains(const Key& key) const {
+	return find(key) != nullptr;
+}
+
+/**
+*	Removes the entry for the provided key. Entries after it in the same probe run are shifted back into the gap
+*	when their home slot allows it, so that every run stays unbroken without tombstones.
+*
+*	@param key fraction to remove
+*	@return true if an entry was removed
+*/
+template <typename IntT, typename Value>
+bool BasicFractionHashMap<IntT, Value>::erase(const Key& key) {
+	if (count == 0)
+		return false;
+	std::uint64_t hash = key.hash();
+	std::size_t hole = locate(key, hash, tagOf(hash));
+	if (tags[hole] == kEmpty)
+		return false;
+
+	std::size_t mask = slotMask();
+	for (std::size_t next = (hole + 1) & mask; tags[next] != kEmpty; next = (next + 1) & mask) {
+		// The entry may move back only if its home slot is not between the hole and itself
+		std::size_t home = static_cast<std::size_t>(slots[next].key.hash()) & mask;
+		if (((next - home) & mask) >= ((next - hole) & mask)) {
+			tags[hole] = tags[next];
+			slots[hole] = std::move(slots[next]);
+			hole = next;
+		}
+	}
+	tags[hole] = kEmpty;
+	slots[hole] = Slot();
+	--count;
+	return true;
+}
+
+/**
+*	Calls function(key, value) for every entry, in table order.
+*
+*	@param function callable taking a const Key& and a const Value&
+*/
+template <typename IntT, typename Value>
+template <typename Function>
+void BasicFractionHashMap<IntT, Value>::forEach(Function function) const {
+	for (std::size_t index = 0; index < slots.size(); ++index) {
+		if (tags[index] != kEmpty)
+			function(slots[index].key, slots[index].value);
+	}
+}
+
+/**
+*	Returns the tag stored for a key with the provided hash, never kEmpty. The slot index comes from the low bits
+*	of the hash, so the tag takes the top ones.
+*
+*	@param hash hash of the key
+*	@return a tag with its high bit set
+*/
+template <typename IntT, typename Value>
+std::uint8_t BasicFractionHashMap<IntT, Value>::tagOf(std::uint64_t hash) {
+	return static_cast<std::uint8_t>(hash >> 57 | 0x80);
+}
+
+/**
+*	@return the mask reducing a hash to a slot index; the table must be allocated
+*/
+template <typename IntT, typename Value>
+std::size_t BasicFractionHashMap<IntT, Value>::slotMask() const {
+	return slots.size() - 1;
+}
+
+/**
+*	Probes for the provided key from its home slot. The table is never full, so every probe run ends in an empty slot.
+*
+*	@param key fraction to look for
+*	@param hash hash of the key
+*	@param tag tag of the key
+*	@return the index of the key's slot, or of the empty slot ending its probe run if it is absent
+*/
+template <typename IntT, typename Value>
+std::size_t BasicFractionHashMap<IntT, Value>::locate(const Key& key, std::uint64_t hash, std::uint8_t tag) const {
+	std::size_t mask = slotMask();
+	for (std::size_t index = static_cast<std::size_t>(hash) & mask;; index = (index + 1) & mask) {
+		std::uint8_t found = tags[index];
+		if (found == kEmpty || (found == tag && slots[index].key == key))
+			return index;
+	}
+}
+
+/**
+*	Finds the slot of the provided key, claiming an empty one for it if it is absent. Grows the table first
+*	if one more entry would take it past three quarters full.
+*
+*	@param key fraction to find or insert
+*	@param inserted set to true if the key was absent
+*	@return the index of the key's slot
+*/
+template <typename IntT, typename Value>
+std::size_t BasicFractionHashMap<IntT, Value>::emplace(const Key& key, bool& inserted) {
+	if ((count + 1) * 4 > slots.size() * 3)
+		rehash(std::max(kMinimumSlots, slots.size() * 2));
+
+	std::uint64_t hash = key.hash();
+	std::uint8_t tag = tagOf(hash);
+	std::size_t index = locate(key, hash, tag);
+	inserted = tags[index] == kEmpty;
+	if (inserted) {
+		tags[index] = tag;
+		slots[index].key = key;
+		++count;
+	}
+	return index;
+}
+
+/**
+*	Moves every entry into a table of the provided size.
+*
+*	@param slotCount new number of slots, a power of two
+*/
+template <typename IntT, typename Value>
+void BasicFractionHashMap<IntT, Value>::rehash(std::size_t slotCount) {
+	std::vector<std::uint8_t> oldTags(slotCount, kEmpty);
+	std::vector<Slot> oldSlots(slotCount);
+	tags.swap(oldTags);
+	slots.swap(oldSlots);
+
+	std::size_t mask = slotMask();
+	for (std::size_t from = 0; from < oldSlots.size(); ++from) {
+		if (oldTags[from] == kEmpty)
+			continue;
+		std::size_t index = static_cast<std::size_t>(oldSlots[from].key.hash()) & mask;
+		while (tags[index] != kEmpty)
+			index = (index + 1) & mask;
+		tags[index] = oldTags[from];
+		slots[index] = std::move(oldSlots[from]);
+	}
+}
+
+/**
+*	Constructs an empty interning table.
+*/
+template <typename IntT>
+BasicFractionInterner<IntT>::BasicFractionInterner() {
+}
+
+/**
+*	Returns the id of the provided fraction, giving it the next free id if it has not been seen before.
+*
+*	@param value fraction to intern
+*	@return the id shared by every fraction equal to value
+*/
+template <typename IntT>
+typename BasicFractionInterner<IntT>::Id BasicFractionInterner<IntT>::intern(const Element& value) {
+	std::pair<Id*, bool> found = ids.tryEmplace(value, static_cast<Id>(values.size()));
+	if (found.second)
+		values.push_back(value);
+	return *found.first;
+}
+
+/**
+*	Looks up the id of the provided fraction without interning it.
+*
+*	@param value fraction to look up
+*	@param id set to the fraction's id if it has one
+*	@return true if the fraction has been interned
+*/
+template <typename IntT>
+bool BasicFractionInterner<IntT>::lookup(const Element& value, Id& id) const {
+	const Id* found = ids.find(value);
+	if (found != nullptr)
+		id = *found;
+	return found != nullptr;
+}
+
+/**
+*	@param id an id returned by intern()
+*	@return the fraction with that id
+*/
+template <typename IntT>
+const typename BasicFractionInterner<IntT>::Element& BasicFractionInterner<IntT>::operator[](Id id) const {
+	return values[id];
+}
+
+/**
+*	@return the number of distinct fractions interned
+*/
+template <typename IntT>
+std::size_t BasicFractionInterner<IntT>::size() const {
+	return values.size();
+}
+
+/**
+*	Makes room for the provided number of distinct fractions.
+*
+*	@param count number of fractions to make room for
+*/
+template <typename IntT>
+void BasicFractionInterner<IntT>::reserve(std::size_t count) {
+	ids.reserve(count);
+	values.reserve(count);
+}
+
+/**
+*	Forgets every interned fraction. Ids handed out before are no longer valid.
+*/
+template <typename IntT>
+void BasicFractionInterner<IntT>::clear() {
+	ids.clear();
+	values.clear();
+}
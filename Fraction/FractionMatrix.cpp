@@ -0,0 +1,135 @@
+/**
+* @file		FractionMatrix.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Fraction-free elimination over BigInteger behind the fraction matrices, and their explicit instantiations.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "FractionMatrix.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+	// Entries left to update below which a step runs on the calling thread; smaller steps cost less than a handoff
+	constexpr std::size_t kParallelEntries = 2048;
+
+}
+
+/**
+*	Eliminates below the pivots of the first pivotColumns columns, in place, applying every step to all columns.
+*	Step k replaces each entry below and to the right of pivot p by (p * entry - below * right) / previous, where
+*	previous is the pivot of step k - 1; the division is exact. Columns without a non-zero candidate are skipped,
+*	so the rank comes out of singular matrices too. The first non-zero candidate is taken as the pivot.
+*
+*	@param matrix the integer matrix, eliminated in place
+*	@param pivotColumns number of leading columns to take pivots from; the rest are carried along
+*	@param pool thread pool for the row updates, or nullptr to run on the calling thread
+*/
+void bareiss::eliminate(Elimination& matrix, std::size_t pivotColumns, ThreadPool* pool) {
+	const BigInteger one(1);
+	BigInteger previous(1);
+	matrix.pivots.clear();
+	matrix.negated = false;
+
+	std::size_t row = 0;
+	for (std::size_t column = 0; column < pivotColumns && row < matrix.rows; ++column) {
+		std::size_t candidate = row;
+		while (candidate < matrix.rows && matrix.at(candidate, column).sign() == 0)
+			++candidate;
+		if (candidate == matrix.rows)
+			continue;
+		if (candidate != row) {
+			std::swap_ranges(&matrix.at(row, 0), &matrix.at(row, 0) + matrix.columns, &matrix.at(candidate, 0));
+			std::swap(matrix.order[row], matrix.order[candidate]);
+			matrix.negated = !matrix.negated;
+		}
+
+		const BigInteger& pivot = matrix.at(row, column);
+		bool divide = previous != one;
+		auto update = [&](std::size_t below) {
+			const BigInteger& factor = matrix.at(below, column);
+			for (std::size_t j = column + 1; j < matrix.columns; ++j) {
+				BigInteger& entry = matrix.at(below, j);
+				entry *= pivot;
+				if (factor.sign() != 0)
+					entry -= factor * matrix.at(row, j);
+				if (divide)
+					entry = entry / previous;
+			}
+		};
+
+		std::size_t remaining = matrix.rows - row - 1;
+		if (pool != nullptr && remaining > 1 && remaining * (matrix.columns - column) >= kParallelEntries)
+			pool->run(remaining, [&](std::size_t task) { update(row + 1 + task); });
+		else {
+			for (std::size_t below = row + 1; below < matrix.rows; ++below)
+				update(below);
+		}
+
+		matrix.pivots.push_back(column);
+		previous = pivot;
+		++row;
+	}
+}
+
+/**
+*	Back substitutes a full rank elimination of size rows without fractions. Each column past the first size
+*	columns is replaced by d * x, where x solves the system for that column and d is the last pivot: working up,
+*	d * x(i) = (d * c(i) - sum of entry(i, j) * d * x(j) for j > i) / pivot(i), an exact division.
+*
+*	@param matrix an elimination of a square, non-singular matrix, augmented with right hand sides
+*	@param size number of rows and of leading columns
+*	@param pool thread pool for the right hand side columns, or nullptr to run on the calling thread
+*/
+void bareiss::substitute(Elimination& matrix, std::size_t size, ThreadPool* pool) {
+	if (size == 0)
+		return;
+	const BigInteger& last = matrix.at(size - 1, size - 1);
+	auto column = [&](std::size_t task) {
+		std::size_t c = size + task;
+		for (std::size_t i = size; i-- > 0;) {
+			BigInteger value = last * matrix.at(i, c);
+			for (std::size_t j = i + 1; j < size; ++j)
+				value -= matrix.at(i, j) * matrix.at(j, c);
+			matrix.at(i, c) = value / matrix.at(i, i);
+		}
+	};
+
+	std::size_t count = matrix.columns - size;
+	if (pool != nullptr && count > 1 && count * size * size >= kParallelEntries)
+		pool->run(count, column);
+	else {
+		for (std::size_t task = 0; task < count; ++task)
+			column(task);
+	}
+}
+
+template class BasicFractionMatrix<Fraction>;
+template class BasicFractionMatrix<Fraction64>;
+template class BasicFractionMatrix<BigFraction>;
@@ -0,0 +1,144 @@
+#pragma once
+/**
+* @file		FractionMatrix.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Row-major matrices of fractions with exact linear algebra: determinant, rank, solve, inverse and LU
+*  decomposition by fraction-free (Bareiss) elimination over BigInteger, optionally on a thread pool.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "BigFraction.h"
+#include "CheckedFraction.h"
+#include "Fraction.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/**
+*	Fraction-free Gaussian elimination (Bareiss, 1968) on integer matrices. Every entry after step k is a minor of
+*	order k + 1 of the input, so the exact division by the previous pivot keeps entries as small as the minors and no
+*	gcd is ever taken. The fraction matrices scale each row to integers, eliminate here and convert back once.
+*/
+namespace bareiss {
+
+	struct Elimination
+	{
+		std::size_t rows;
+		std::size_t columns;
+		// Row-major entries; below each pivot, the entry of the step that eliminated it is kept for the LU factors
+		std::vector<BigInteger> entries;
+		// Input row of each row, after the row exchanges
+		std::vector<std::size_t> order;
+		// Column of the pivot of each of the first rank rows
+		std::vector<std::size_t> pivots;
+		bool negated;
+
+		BigInteger& at(std::size_t row, std::size_t column) { return entries[row * columns + column]; }
+		const BigInteger& at(std::size_t row, std::size_t column) const { return entries[row * columns + column]; }
+		std::size_t rank() const { return pivots.size(); }
+	};
+
+	void eliminate(Elimination& matrix, std::size_t pivotColumns, ThreadPool* pool);
+	void substitute(Elimination& matrix, std::size_t size, ThreadPool* pool);
+}
+
+/**
+*	Dense matrix of fractions (Fraction, Fraction64 or BigFraction), stored row-major in one contiguous block.
+*	The linear algebra is exact whatever the element type: it runs on BigInteger and only the results are converted
+*	back, throwing std::overflow_error if one does not fit the element type. Solving with or inverting a singular
+*	matrix throws std::domain_error, and mismatched dimensions throw std::invalid_argument.
+*	Passing a thread pool spreads the row updates of each elimination step over its threads.
+*/
+template <typename Element>
+class BasicFractionMatrix
+{
+
+public:
+	/**
+	*	LU factors with row pivoting, such that row i of the product lower * upper is row permutation[i] of the matrix.
+	*	lower is unit lower triangular.
+	*/
+	struct Decomposition
+	{
+		BasicFractionMatrix lower;
+		BasicFractionMatrix upper;
+		std::vector<std::size_t> permutation;
+	};
+
+	BasicFractionMatrix();
+	BasicFractionMatrix(std::size_t rows, std::size_t columns);
+	BasicFractionMatrix(std::size_t rows, std::size_t columns, std::initializer_list<Element> values);
+	static BasicFractionMatrix identity(std::size_t size);
+
+	std::size_t rows() const;
+	std::size_t columns() const;
+	Element& operator()(std::size_t row, std::size_t column);
+	const Element& operator()(std::size_t row, std::size_t column) const;
+	Element* row(std::size_t index);
+	const Element* row(std::size_t index) const;
+
+	// Equality Operator Overloads
+	bool operator==(const BasicFractionMatrix& rhs) const;
+	bool operator!=(const BasicFractionMatrix& rhs) const;
+
+	// Products, accumulated exactly and converted once per entry
+	BasicFractionMatrix operator*(const BasicFractionMatrix& rhs) const;
+	std::vector<Element> operator*(const std::vector<Element>& rhs) const;
+
+	// Exact Linear Algebra
+	Element determinant(ThreadPool* pool = nullptr) const;
+	std::size_t rank(ThreadPool* pool = nullptr) const;
+	std::vector<Element> solve(const std::vector<Element>& rhs, ThreadPool* pool = nullptr) const;
+	BasicFractionMatrix solve(const BasicFractionMatrix& rhs, ThreadPool* pool = nullptr) const;
+	BasicFractionMatrix inverse(ThreadPool* pool = nullptr) const;
+	Decomposition decompose(ThreadPool* pool = nullptr) const;
+
+private:
+	std::size_t rowCount;
+	std::size_t columnCount;
+	std::vector<Element> entries;
+
+	bareiss::Elimination scaled(const BasicFractionMatrix* augment, std::vector<BigInteger>& scales) const;
+	void requireSquare() const;
+	static BigFraction widen(const Element& value);
+	static Element narrow(const BigFraction& value);
+
+};
+
+// Matrices of the original int fraction, the fixed width variant and arbitrary precision fractions
+using FractionMatrix = BasicFractionMatrix<Fraction>;
+using FractionMatrix64 = BasicFractionMatrix<Fraction64>;
+using BigFractionMatrix = BasicFractionMatrix<BigFraction>;
+
+#include "FractionMatrix.inl"
+
+// Instantiated once in FractionMatrix.cpp
+extern template class BasicFractionMatrix<Fraction>;
+extern template class BasicFractionMatrix<Fraction64>;
+extern template class BasicFractionMatrix<BigFraction>;
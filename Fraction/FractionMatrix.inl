@@ -0,0 +1,402 @@
+/**
+* @file		FractionMatrix.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Template implementation of the fraction matrix, included from FractionMatrix.h.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+*	Constructs an empty matrix, with no rows and no columns.
+*/
+template <typename Element>
+BasicFractionMatrix<Element>::BasicFractionMatrix()
+	: rowCount(0), columnCount(0) {
+}
+
+/**
+*	Constructs a matrix of the provided size where every entry is zero.
+*
+*	@param rows number of rows
+*	@param columns number of columns
+*/
+template <typename Element>
+BasicFractionMatrix<Element>::BasicFractionMatrix(std::size_t rows, std::size_t columns)
+	: rowCount(rows), columnCount(columns), entries(rows * columns, Element(0)) {
+}
+
+/**
+*	Constructs a matrix of the provided size from its entries, row by row.
+*
+*	@param rows number of rows
+*	@param columns number of columns
+*	@param values rows * columns entries in row-major order
+*/
+template <typename Element>
+BasicFractionMatrix<Element>::BasicFractionMatrix(std::size_t rows, std::size_t columns, std::initializer_list<Element> values)
+	: rowCount(rows), columnCount(columns), entries(values) {
+	if (entries.size() != rows * columns)
+		throw std::invalid_argument("matrix needs rows * columns values");
+}
+
+/**
+*	Returns the identity matrix of the provided size.
+*
+*	@param size number of rows and columns
+*	@return a matrix with ones on its diagonal and zeros elsewhere
+*/
+template <typename Element>
+BasicFractionMatrix<Element> BasicFractionMatrix<Element>::identity(std::size_t size) {
+	BasicFractionMatrix result(size, size);
+	for (std::size_t i = 0; i < size; ++i)
+		result(i, i) = Element(1);
+	return result;
+}
+
+/**
+*	@return the number of rows
+*/
+template <typename Element>
+std::size_t BasicFractionMatrix<Element>::rows() const {
+	return rowCount;
+}
+
+/**
+*	@return the number of columns
+*/
+template <typename Element>
+std::size_t BasicFractionMatrix<Element>::columns() const {
+	return columnCount;
+}
+
+/**
+*	@param row index of the row
+*	@param column index of the column
+*	@return the entry at that position
+*/
+template <typename Element>
+Element& BasicFractionMatrix<Element>::operator()(std::size_t row, std::size_t column) {
+	return entries[row * columnCount + column];
+}
+
+/**
+*	@param row index of the row
+*	@param column index of the column
+*	@return the entry at that position
+*/
+template <typename Element>
+const Element& BasicFractionMatrix<Element>::operator()(std::size_t row, std::size_t column) const {
+	return entries[row * columnCount + column];
+}
+
+/**
+*	@param index index of the row
+*	@return the first of the row's columns() contiguous entries
+*/
+template <typename Element>
+Element* BasicFractionMatrix<Element>::row(std::size_t index) {
+	return entries.data() + index * columnCount;
+}
+
+/**
+*	@param index index of the row
+*	@return the first of the row's columns() contiguous entries
+*/
+template <typename Element>
+const Element* BasicFractionMatrix<Element>::row(std::size_t index) const {
+	return entries.data() + index * columnCount;
+}
+
+/**
+*	Tests if this matrix has the same size and entries as the provided one.
+*
+*	@param rhs matrix to compare with
+*	@return true if the matrices are equal
+*/
+template <typename Element>
+bool BasicFractionMatrix<Element>::operator==(const BasicFractionMatrix& rhs) const {
+	return rowCount == rhs.rowCount && columnCount == rhs.columnCount && entries == rhs.entries;
+}
+
+/**
+*	Tests if this matrix differs from the provided one in size or in any entry.
+*
+*	@param rhs matrix to compare with
+*	@return true if the matrices differ
+*/
+template <typename Element>
+bool BasicFractionMatrix<Element>::operator!=(const BasicFractionMatrix& rhs) const {
+	return !((*this) == rhs);
+}
+
+/**
+*	Multiplies this matrix by the provided one. Each entry is accumulated in BigFraction and converted once.
+*
+*	@param rhs matrix with as many rows as this one has columns
+*	@return the product
+*/
+template <typename Element>
+BasicFractionMatrix<Element> BasicFractionMatrix<Element>::operator*(const BasicFractionMatrix& rhs) const {
+	if (columnCount != rhs.rowCount)
+		throw std::invalid_argument("matrix product needs matching inner dimensions");
+	std::vector<BigFraction> right;
+	right.reserve(rhs.entries.size());
+	for (const Element& value : rhs.entries)
+		right.push_back(widen(value));
+
+	BasicFractionMatrix result(rowCount, rhs.columnCount);
+	std::vector<BigFraction> sums(rhs.columnCount);
+	for (std::size_t i = 0; i < rowCount; ++i) {
+		std::fill(sums.begin(), sums.end(), BigFraction(0));
+		for (std::size_t k = 0; k < columnCount; ++k) {
+			BigFraction left = widen((*this)(i, k));
+			if (left == 0)
+				continue;
+			for (std::size_t j = 0; j < rhs.columnCount; ++j)
+				sums[j] += left * right[k * rhs.columnCount + j];
+		}
+		for (std::size_t j = 0; j < rhs.columnCount; ++j)
+			result(i, j) = narrow(sums[j]);
+	}
+	return result;
+}
+
+/**
+*	Multiplies this matrix by the provided column vector.
+*
+*	@param rhs vector with as many entries as this matrix has columns
+*	@return the product
+*/
+template <typename Element>
+std::vector<Element> BasicFractionMatrix<Element>::operator*(const std::vector<Element>& rhs) const {
+	BasicFractionMatrix column(rhs.size(), 1);
+	column.entries = rhs;
+	return ((*this) * column).entries;
+}
+
+/**
+*	Computes the determinant of this square matrix exactly.
+*
+*	@param pool thread pool for the row updates, or nullptr to run on the calling thread
+*	@return the determinant
+*/
+template <typename Element>
+Element BasicFractionMatrix<Element>::determinant(ThreadPool* pool) const {
+	requireSquare();
+	std::vector<BigInteger> scales;
+	bareiss::Elimination matrix = scaled(nullptr, scales);
+	bareiss::eliminate(matrix, columnCount, pool);
+	if (matrix.rank() < rowCount)
+		return Element(0);
+
+	// The last pivot is the determinant of the scaled rows in their final order
+	BigInteger value = rowCount == 0 ? BigInteger(1) : matrix.at(rowCount - 1, rowCount - 1);
+	BigInteger scale(1);
+	for (const BigInteger& rowScale : scales)
+		scale *= rowScale;
+	return narrow(BigFraction(matrix.negated ? -value : value, scale));
+}
+
+/**
+*	Computes the rank of this matrix exactly.
+*
+*	@param pool thread pool for the row updates, or nullptr to run on the calling thread
+*	@return the number of linearly independent rows
+*/
+template <typename Element>
+std::size_t BasicFractionMatrix<Element>::rank(ThreadPool* pool) const {
+	std::vector<BigInteger> scales;
+	bareiss::Elimination matrix = scaled(nullptr, scales);
+	bareiss::eliminate(matrix, columnCount, pool);
+	return matrix.rank();
+}
+
+/**
+*	Solves this square system for the provided right hand side.
+*
+*	@param rhs vector with one entry per row
+*	@param pool thread pool for the row updates, or nullptr to run on the calling thread
+*	@return the vector x for which this matrix times x is rhs
+*/
+template <typename Element>
+std::vector<Element> BasicFractionMatrix<Element>::solve(const std::vector<Element>& rhs, ThreadPool* pool) const {
+	BasicFractionMatrix column(rhs.size(), 1);
+	column.entries = rhs;
+	return solve(column, pool).entries;
+}
+
+/**
+*	Solves this square system for every column of the provided right hand side at once. The columns are
+*	eliminated alongside the matrix and back substituted without fractions: with d the last pivot, d * x is
+*	integral (Cramer's rule), so each step divides exactly and only the final x = (d * x) / d is reduced.
+*
+*	@param rhs matrix with one row per row of this one
+*	@param pool thread pool for the row updates and the columns, or nullptr to run on the calling thread
+*	@return the matrix X for which this matrix times X is rhs
+*/
+template <typename Element>
+BasicFractionMatrix<Element> BasicFractionMatrix<Element>::solve(const BasicFractionMatrix& rhs, ThreadPool* pool) const {
+	requireSquare();
+	if (rhs.rowCount != rowCount)
+		throw std::invalid_argument("right hand side needs one row per row of the matrix");
+	std::vector<BigInteger> scales;
+	bareiss::Elimination matrix = scaled(&rhs, scales);
+	bareiss::eliminate(matrix, columnCount, pool);
+	if (matrix.rank() < rowCount)
+		throw std::domain_error("matrix is singular");
+	bareiss::substitute(matrix, rowCount, pool);
+
+	BasicFractionMatrix result(rowCount, rhs.columnCount);
+	if (rowCount == 0)
+		return result;
+	const BigInteger& last = matrix.at(rowCount - 1, rowCount - 1);
+	for (std::size_t i = 0; i < rowCount; ++i) {
+		for (std::size_t j = 0; j < rhs.columnCount; ++j)
+			result(i, j) = narrow(BigFraction(matrix.at(i, columnCount + j), last));
+	}
+	return result;
+}
+
+/**
+*	Inverts this square matrix exactly.
+*
+*	@param pool thread pool for the row updates and the columns, or nullptr to run on the calling thread
+*	@return the inverse
+*/
+template <typename Element>
+BasicFractionMatrix<Element> BasicFractionMatrix<Element>::inverse(ThreadPool* pool) const {
+	return solve(identity(rowCount), pool);
+}
+
+/**
+*	Factors this square, non-singular matrix into unit lower and upper triangular factors with row pivoting.
+*	Both come straight from the fraction-free elimination: with B the eliminated entries and p the pivots,
+*	lower(i, k) = B(i, k) / p(k) and upper(k, j) = B(k, j) / p(k - 1), corrected for the row scales.
+*
+*	@param pool thread pool for the row updates, or nullptr to run on the calling thread
+*	@return the factors and the row permutation
+*/
+template <typename Element>
+typename BasicFractionMatrix<Element>::Decomposition BasicFractionMatrix<Element>::decompose(ThreadPool* pool) const {
+	requireSquare();
+	std::vector<BigInteger> scales;
+	bareiss::Elimination matrix = scaled(nullptr, scales);
+	bareiss::eliminate(matrix, columnCount, pool);
+	if (matrix.rank() < rowCount)
+		throw std::domain_error("matrix is singular");
+
+	Decomposition result{ BasicFractionMatrix(rowCount, rowCount), BasicFractionMatrix(rowCount, rowCount), matrix.order };
+	BigInteger previous(1);
+	for (std::size_t k = 0; k < rowCount; ++k) {
+		const BigInteger& pivot = matrix.at(k, k);
+		const BigInteger& scale = scales[matrix.order[k]];
+		result.lower(k, k) = Element(1);
+		for (std::size_t i = k + 1; i < rowCount; ++i)
+			result.lower(i, k) = narrow(BigFraction(matrix.at(i, k) * scale, pivot * scales[matrix.order[i]]));
+		for (std::size_t j = k; j < rowCount; ++j)
+			result.upper(k, j) = narrow(BigFraction(matrix.at(k, j), previous * scale));
+		previous = pivot;
+	}
+	return result;
+}
+
+/**
+*	Scales every row of this matrix, joined with the same row of augment if there is one, by the least common
+*	multiple of its denominators, giving an integer matrix with the same solutions.
+*
+*	@param augment matrix whose columns are appended, or nullptr
+*	@param scales set to the scale of each row
+*	@return the integer matrix, ready for elimination
+*/
+template <typename Element>
+bareiss::Elimination BasicFractionMatrix<Element>::scaled(const BasicFractionMatrix* augment, std::vector<BigInteger>& scales) const {
+	bareiss::Elimination matrix;
+	matrix.rows = rowCount;
+	matrix.columns = columnCount + (augment != nullptr ? augment->columnCount : 0);
+	matrix.entries.reserve(matrix.rows * matrix.columns);
+	matrix.order.resize(rowCount);
+	matrix.negated = false;
+	scales.assign(rowCount, BigInteger(1));
+
+	const BigInteger one(1);
+	std::vector<BigFraction> values(matrix.columns);
+	for (std::size_t i = 0; i < rowCount; ++i) {
+		matrix.order[i] = i;
+		for (std::size_t j = 0; j < matrix.columns; ++j)
+			values[j] = widen(j < columnCount ? (*this)(i, j) : (*augment)(i, j - columnCount));
+
+		BigInteger& scale = scales[i];
+		for (const BigFraction& value : values) {
+			if (value.getDenominator() != one)
+				scale = scale / BigInteger::gcd(scale, value.getDenominator()) * value.getDenominator();
+		}
+		for (const BigFraction& value : values)
+			matrix.entries.push_back(value.getDenominator() == scale ? value.getNumerator() : value.getNumerator() * (scale / value.getDenominator()));
+	}
+	return matrix;
+}
+
+/**
+*	Throws std::invalid_argument unless this matrix is square.
+*/
+template <typename Element>
+void BasicFractionMatrix<Element>::requireSquare() const {
+	if (rowCount != columnCount)
+		throw std::invalid_argument("matrix must be square");
+}
+
+/**
+*	@param value an entry
+*	@return the entry as a BigFraction
+*/
+template <typename Element>
+BigFraction BasicFractionMatrix<Element>::widen(const Element& value) {
+	return BigFraction(value);
+}
+
+/**
+*	Converts an exact result to the element type.
+*
+*	@param value the result, in simplest form
+*	@return the result as an element
+*/
+template <typename Element>
+Element BasicFractionMatrix<Element>::narrow(const BigFraction& value) {
+	if constexpr (std::is_same<Element, BigFraction>::value) {
+		return value;
+	}
+	else {
+		using IntT = typename Element::Integer;
+		if (!checked::fits<IntT>(value.getNumerator()) || !checked::fits<IntT>(value.getDenominator()))
+			throw std::overflow_error("matrix result does not fit the element type");
+		return Element(static_cast<IntT>(value.getNumerator().toSmall()), static_cast<IntT>(value.getDenominator().toSmall()));
+	}
+}
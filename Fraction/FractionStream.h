@@ -0,0 +1,123 @@
+#pragma once
+/**
+* @file		FractionStream.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Streaming parser for large newline-delimited fraction text. A reader thread cuts the input into chunks that
+*  end on a newline, a ThreadPool parses a window of chunks at a time, and the fractions are emitted in input
+*  order. The reader stays at most one window ahead, which bounds the memory used whatever the size of the input.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "FractionArray.h"
+#include "ThreadPool.h"
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Bytes read for each chunk before it is extended to the end of its last line
+constexpr std::size_t kFractionStreamChunkBytes = 1 << 20;
+
+/**
+*	Parses whitespace separated fractions, one or more per line, from a stream on the threads of a pool.
+*	A reader thread fills a window of chunks cut at newlines while the pool parses the previous window, every chunk
+*	into its own array with appendParsed(), so each chunk is reduced in one batch. The fractions are then emitted
+*	chunk by chunk in input order. There are two windows: once the reader is a full window ahead it waits for the
+*	consumer, so memory stays near 2 * chunksPerWindow * chunkBytes. The buffers are kept between calls; one
+*	parse() runs at a time.
+*/
+template <typename IntT>
+class BasicFractionStreamParser
+{
+
+public:
+	using Array = BasicFractionArray<IntT>;
+	using View = BasicFractionView<IntT>;
+	using Callback = std::function<void(const View&)>;
+
+	explicit BasicFractionStreamParser(ThreadPool& pool = ThreadPool::shared(),
+		std::size_t chunkBytes = kFractionStreamChunkBytes, std::size_t chunksPerWindow = 0);
+
+	BasicFractionStreamParser(const BasicFractionStreamParser&) = delete;
+	BasicFractionStreamParser& operator=(const BasicFractionStreamParser&) = delete;
+
+	std::size_t chunkBytes() const;
+	std::size_t chunksPerWindow() const;
+
+	FractionBulkParseResult parse(std::istream& input, const Callback& emit);
+	FractionBulkParseResult parse(std::istream& input, Array& out);
+
+private:
+	struct Chunk {
+		std::string text;
+		// Offset of text[0] in the stream
+		std::size_t offset;
+		Array fractions;
+		FractionBulkParseResult result;
+	};
+
+	struct Window {
+		std::vector<Chunk> chunks;
+		std::size_t used;
+		// Filled by the reader and not yet handed back by the consumer
+		bool full;
+		bool last;
+	};
+
+	ThreadPool& pool;
+	std::size_t chunkSize;
+	Window windows[2];
+
+	// Guards the window flags, stopping and readError between the reader thread and parse()
+	std::mutex mutex;
+	std::condition_variable changed;
+	bool stopping;
+	std::exception_ptr readError;
+
+	void read(std::istream& input);
+	bool fillChunk(std::istream& input, Chunk& chunk, std::string& carry, std::size_t& offset);
+
+};
+
+using FractionStreamParser = BasicFractionStreamParser<int>;
+#ifdef __SIZEOF_INT128__
+using FractionStreamParser64 = BasicFractionStreamParser<std::int64_t>;
+#endif
+
+#include "FractionStream.inl"
+
+// Instantiated once in FractionStream.cpp
+extern template class BasicFractionStreamParser<std::int32_t>;
+#ifdef __SIZEOF_INT128__
+extern template class BasicFractionStreamParser<std::int64_t>;
+#endif
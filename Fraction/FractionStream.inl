@@ -0,0 +1,239 @@
+/**
+* @file		FractionStream.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Template implementation of the streaming fraction parser, included from FractionStream.h.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <thread>
+
+/**
+*	Constructs a parser running on the provided pool.
+*
+*	@param pool pool parsing the chunks of a window, the shared one by default
+*	@param chunkBytes bytes read for each chunk; a chunk extends to the end of its last line
+*	@param chunksPerWindow chunks parsed together, 0 for twice the pool size so that uneven chunks balance out
+*	@throws std::invalid_argument if chunkBytes is 0
+*/
+template <typename IntT>
+BasicFractionStreamParser<IntT>::BasicFractionStreamParser(ThreadPool& pool, std::size_t chunkBytes, std::size_t chunksPerWindow)
+	: pool(pool), chunkSize(chunkBytes), stopping(false) {
+	if (chunkBytes == 0)
+		throw std::invalid_argument("BasicFractionStreamParser: chunkBytes must be positive");
+	if (chunksPerWindow == 0)
+		chunksPerWindow = 2 * static_cast<std::size_t>(pool.size());
+	for (Window& window : windows) {
+		window.chunks.resize(chunksPerWindow);
+		window.used = 0;
+		window.full = false;
+		window.last = false;
+	}
+}
+
+/**
+*	@return the bytes read for each chunk
+*/
+template <typename IntT>
+std::size_t BasicFractionStreamParser<IntT>::chunkBytes() const {
+	return chunkSize;
+}
+
+/**
+*	@return the number of chunks parsed together on the pool
+*/
+template <typename IntT>
+std::size_t BasicFractionStreamParser<IntT>::chunksPerWindow() const {
+	return windows[0].chunks.size();
+}
+
+/**
+*	Parses the stream to its end and emits the fractions in input order, in runs of consecutive fractions.
+*	Parsing stops at the first text that is not a fraction; the fractions before it are still emitted.
+*
+*	@param input stream to read, from its current position
+*	@param emit callable receiving each run of reduced fractions; the view is only valid during the call
+*	@return how many fractions were emitted, and where in the stream and why parsing stopped if the input was not all
+*		fractions (on success, position is the number of bytes read)
+*	@throws whatever reading the stream or emit throws, once the reader thread has stopped
+*/
+template <typename IntT>
+FractionBulkParseResult BasicFractionStreamParser<IntT>::parse(std::istream& input, const Callback& emit) {
+	stopping = false;
+	readError = nullptr;
+	for (Window& window : windows) {
+		window.full = false;
+		window.last = false;
+	}
+
+	std::thread reader([this, &input] { read(input); });
+	FractionBulkParseResult total = { 0, FractionParseError::None, 0 };
+	std::exception_ptr failure;
+	try {
+		for (std::size_t index = 0;; ++index) {
+			Window& window = windows[index % 2];
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				changed.wait(lock, [this, &window] { return window.full || readError; });
+				if (!window.full)
+					break;
+			}
+
+			pool.run(window.used, [&window](std::size_t i) {
+				Chunk& chunk = window.chunks[i];
+				chunk.fractions.clear();
+				chunk.result = chunk.fractions.appendParsed(chunk.text);
+			});
+
+			bool failed = false;
+			for (std::size_t i = 0; i < window.used && !failed; ++i) {
+				Chunk& chunk = window.chunks[i];
+				if (chunk.fractions.size() != 0)
+					emit(chunk.fractions.view());
+				total.count += chunk.result.count;
+				total.position = chunk.offset + chunk.result.position;
+				if (!chunk.result) {
+					total.error = chunk.result.error;
+					failed = true;
+				}
+			}
+
+			bool last = window.last;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				window.full = false;
+				stopping = failed;
+			}
+			changed.notify_all();
+			if (failed || last)
+				break;
+		}
+	}
+	catch (...) {
+		failure = std::current_exception();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		changed.notify_all();
+	}
+
+	reader.join();
+	if (failure)
+		std::rethrow_exception(failure);
+	if (readError)
+		std::rethrow_exception(readError);
+	return total;
+}
+
+/**
+*	Parses the stream to its end and appends the fractions to an array, in input order.
+*
+*	@param input stream to read, from its current position
+*	@param out array the fractions are appended to
+*	@return how many fractions were appended, and where in the stream and why parsing stopped if the input was not all
+*		fractions
+*/
+template <typename IntT>
+FractionBulkParseResult BasicFractionStreamParser<IntT>::parse(std::istream& input, Array& out) {
+	return parse(input, [&out](const View& fractions) { out.append(fractions); });
+}
+
+/**
+*	Body of the reader thread: fills the windows in turn, waiting while the next one is still held by the consumer.
+*	An exception from the stream is kept in readError for parse() to rethrow.
+*
+*	@param input stream to read
+*/
+template <typename IntT>
+void BasicFractionStreamParser<IntT>::read(std::istream& input) {
+	std::string carry;
+	std::size_t offset = 0;
+	bool more = true;
+	try {
+		for (std::size_t index = 0; more; ++index) {
+			Window& window = windows[index % 2];
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				changed.wait(lock, [this, &window] { return stopping || !window.full; });
+				if (stopping)
+					return;
+			}
+
+			window.used = 0;
+			while (more && window.used < window.chunks.size())
+				more = fillChunk(input, window.chunks[window.used++], carry, offset);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				window.last = !more;
+				window.full = true;
+			}
+			changed.notify_all();
+		}
+	}
+	catch (...) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			readError = std::current_exception();
+		}
+		changed.notify_all();
+	}
+}
+
+/**
+*	Reads the next chunk: the partial line left over from the previous chunk, then chunkSize bytes, extended until
+*	the chunk ends on a newline so that no fraction is split between two chunks.
+*
+*	@param input stream to read
+*	@param chunk chunk receiving the text and its stream offset
+*	@param carry partial line after the last newline of the previous chunk, replaced by the one after this chunk
+*	@param offset number of bytes read from the stream so far, advanced by this read
+*	@return false once the stream is exhausted (this chunk then holds the rest of the input)
+*/
+template <typename IntT>
+bool BasicFractionStreamParser<IntT>::fillChunk(std::istream& input, Chunk& chunk, std::string& carry, std::size_t& offset) {
+	chunk.offset = offset - carry.size();
+	chunk.text.assign(carry);
+	carry.clear();
+	for (;;) {
+		std::size_t start = chunk.text.size();
+		chunk.text.resize(start + chunkSize);
+		input.read(&chunk.text[start], static_cast<std::streamsize>(chunkSize));
+		std::size_t length = static_cast<std::size_t>(input.gcount());
+		chunk.text.resize(start + length);
+		offset += length;
+		if (length < chunkSize)
+			return false;
+
+		std::size_t newline = chunk.text.rfind('\n');
+		if (newline != std::string::npos) {
+			carry.assign(chunk.text, newline + 1, std::string::npos);
+			chunk.text.resize(newline + 1);
+			return true;
+		}
+	}
+}
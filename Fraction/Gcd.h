@@ -0,0 +1,389 @@
+#pragma once
+/**
+* @file		Gcd.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.1>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Greatest common divisor kernels used to keep fractions in their simplest form.
+*  Provides an iterative Euclid, a Stein (binary) GCD built on count-trailing-zeros and a
+*  hybrid Lehmer GCD. The kernel used by Fraction is chosen at compile time through
+*  FRACTION_GCD_KERNEL, or at startup through gcd::setKernel() when it is set to FRACTION_GCD_DISPATCH.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "FractionCounters.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Kernel identifiers for FRACTION_GCD_KERNEL
+#define FRACTION_GCD_DISPATCH	0
+#define FRACTION_GCD_EUCLID		1
+#define FRACTION_GCD_BINARY		2
+#define FRACTION_GCD_LEHMER		3
+
+#ifndef FRACTION_GCD_KERNEL
+#define FRACTION_GCD_KERNEL FRACTION_GCD_BINARY
+#endif
+
+namespace gcd {
+
+	enum class Kernel { Euclid, Binary, Lehmer };
+
+	/**
+	*	Maps an integer type onto the unsigned type holding its magnitude and the signed type of the same width.
+	*	Spelled out by hand so that __int128 works even when the standard traits do not know about it.
+	*/
+	template <typename T> struct IntTraits {
+		using Unsigned = std::make_unsigned_t<T>;
+		using Signed = std::make_signed_t<T>;
+	};
+
+#ifdef __SIZEOF_INT128__
+	template <> struct IntTraits<__int128> {
+		using Unsigned = unsigned __int128;
+		using Signed = __int128;
+	};
+
+	template <> struct IntTraits<unsigned __int128> {
+		using Unsigned = unsigned __int128;
+		using Signed = __int128;
+	};
+#endif
+
+	template <typename T> using UnsignedOf = typename IntTraits<T>::Unsigned;
+	template <typename T> using SignedOf = typename IntTraits<T>::Signed;
+
+	/**
+	*	Returns the magnitude of the provided value as an unsigned number. Safe for the most negative value.
+	*
+	*	@param value the value whose magnitude is wanted
+	*	@return |value| as the matching unsigned type
+	*/
+	template <typename T>
+	constexpr UnsignedOf<T> magnitude(T value) {
+		using U = UnsignedOf<T>;
+		return value < 0 ? U(0) - U(value) : U(value);
+	}
+
+	/**
+	*	Tells whether the caller is being evaluated at compile time, so that constexpr code can step around
+	*	intrinsics that are not usable in constant expressions. Always false on compilers without the builtin.
+	*
+	*	@return true during constant evaluation
+	*/
+	constexpr bool constantEvaluated() {
+#if defined(__GNUC__) && __GNUC__ >= 9 || defined(__clang__) && __clang_major__ >= 9 || defined(_MSC_VER) && _MSC_VER >= 1925
+		return __builtin_is_constant_evaluated();
+#else
+		return false;
+#endif
+	}
+
+	/**
+	*	Counts the trailing zero bits of a non-zero unsigned number.
+	*
+	*	@param value non-zero number to inspect
+	*	@return the number of trailing zero bits
+	*/
+	template <typename U>
+	int countTrailingZeros(U value) {
+		static_assert(std::is_unsigned<U>::value || sizeof(U) == 16, "countTrailingZeros expects an unsigned type");
+		if constexpr (sizeof(U) > 8) {
+			std::uint64_t low = static_cast<std::uint64_t>(value);
+			return low != 0 ? countTrailingZeros(low) : 64 + countTrailingZeros(static_cast<std::uint64_t>(value >> 64));
+		}
+		else {
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+			_BitScanForward64(&index, static_cast<unsigned __int64>(value));
+#else
+			std::uint64_t wide = static_cast<std::uint64_t>(value);
+			if (!_BitScanForward(&index, static_cast<unsigned long>(wide))) {
+				_BitScanForward(&index, static_cast<unsigned long>(wide >> 32));
+				index += 32;
+			}
+#endif
+			return static_cast<int>(index);
+#else
+			if constexpr (sizeof(U) <= sizeof(unsigned int))
+				return __builtin_ctz(static_cast<unsigned int>(value));
+			else
+				return __builtin_ctzll(static_cast<unsigned long long>(value));
+#endif
+		}
+	}
+
+	/**
+	*	Returns the number of significant bits of an unsigned number (0 for 0).
+	*
+	*	@param value number to inspect
+	*	@return position of the highest set bit plus one
+	*/
+	template <typename U>
+	int bitLength(U value) {
+		int length = 0;
+		if constexpr (sizeof(U) > 8) {
+			if (value >> 64) {
+				length = 64;
+				value >>= 64;
+			}
+		}
+		std::uint64_t wide = static_cast<std::uint64_t>(value);
+		if (wide == 0)
+			return length;
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+		_BitScanReverse64(&index, wide);
+#else
+		if (wide >> 32) {
+			_BitScanReverse(&index, static_cast<unsigned long>(wide >> 32));
+			index += 32;
+		}
+		else {
+			_BitScanReverse(&index, static_cast<unsigned long>(wide));
+		}
+#endif
+		return length + static_cast<int>(index) + 1;
+#else
+		return length + 64 - __builtin_clzll(wide);
+#endif
+	}
+
+	/**
+	*	Finds the greatest common divisor of two unsigned numbers with the iterative Euclidean algorithm.
+	*
+	*	@param a first number
+	*	@param b second number
+	*	@return the greatest common divisor (0 only when both numbers are 0)
+	*/
+	template <typename U>
+	constexpr U euclid(U a, U b) {
+		while (b != 0) {
+			FRACTION_COUNT(GcdIteration);
+			U remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+		return a;
+	}
+
+	/**
+	*	Half-extended Euclidean algorithm: the Euclidean algorithm tracking the cofactor of a alone, which is all that
+	*	modular inverses and rational reconstruction need. On return cofactor * a and the result agree modulo m.
+	*
+	*	@param a first number
+	*	@param m second number, the modulus; below 2^(bits - 1) so that the cofactor fits the signed type
+	*	@param cofactor set to the cofactor of a, with magnitude at most m / 2
+	*	@return the greatest common divisor of a and m
+	*/
+	template <typename U>
+	constexpr U halfExtended(U a, U m, SignedOf<U>& cofactor) {
+		using S = SignedOf<U>;
+		S current = 1;
+		S next = 0;
+		while (m != 0) {
+			FRACTION_COUNT(GcdIteration);
+			U quotient = a / m;
+			U remainder = a - quotient * m;
+			a = m;
+			m = remainder;
+			S t = current - static_cast<S>(quotient) * next;
+			current = next;
+			next = t;
+		}
+		cofactor = current;
+		return a;
+	}
+
+	/**
+	*	Finds the greatest common divisor of two unsigned numbers with Stein's binary algorithm.
+	*	Strips powers of two with count-trailing-zeros and replaces the compare-and-swap of the textbook
+	*	version with min/absolute difference, which compiles to conditional moves instead of branches.
+	*
+	*	@param a first number
+	*	@param b second number
+	*	@return the greatest common divisor (0 only when both numbers are 0)
+	*/
+	template <typename U>
+	U binary(U a, U b) {
+		if (a == 0)
+			return b;
+		if (b == 0)
+			return a;
+
+		int aZeros = countTrailingZeros(a);
+		int bZeros = countTrailingZeros(b);
+		int shift = aZeros < bZeros ? aZeros : bZeros;
+		a >>= aZeros;
+		for (;;) {
+			FRACTION_COUNT(GcdIteration);
+			b >>= bZeros;
+			// b - a and a - b have the same trailing zeros, so the next shift can be counted before the swap
+			U difference = b - a;
+			if (difference == 0)
+				break;
+			bZeros = countTrailingZeros(difference);
+			U smaller = a < b ? a : b;
+			b = a < b ? difference : a - b;
+			a = smaller;
+		}
+		return a << shift;
+	}
+
+	/**
+	*	Finds the greatest common divisor of two unsigned numbers with a hybrid Lehmer algorithm.
+	*	For types wider than a machine word, the quotient sequence is simulated on 62-bit leading digits
+	*	and applied to the full values in one step, which skips most of the (library call) full-width divisions.
+	*	For machine-word types a single division step first cuts the larger number down to the size of the
+	*	smaller one, which is where binary GCD loses most of its iterations on unbalanced pairs.
+	*	Once the numbers are balanced the binary kernel finishes the job, on 32 bits when they fit.
+	*
+	*	@param a first number
+	*	@param b second number
+	*	@return the greatest common divisor (0 only when both numbers are 0)
+	*/
+	template <typename U>
+	U lehmer(U a, U b) {
+		if (a < b)
+			std::swap(a, b);
+
+		if constexpr (sizeof(U) > 8) {
+			constexpr int digitBits = 62;
+			while (b != 0 && (a >> digitBits) != 0) {
+				FRACTION_COUNT(GcdIteration);
+				int shift = bitLength(a) - digitBits;
+				std::int64_t x = static_cast<std::int64_t>(a >> shift);
+				std::int64_t y = static_cast<std::int64_t>(b >> shift);
+				std::int64_t A = 1, B = 0, C = 0, D = 1;
+
+				// Knuth vol. 2, algorithm L: run Euclid on the leading digits while both quotient estimates agree
+				while (y + C != 0 && y + D != 0) {
+					std::int64_t quotient = (x + A) / (y + C);
+					if (quotient != (x + B) / (y + D))
+						break;
+					std::int64_t t = A - quotient * C; A = C; C = t;
+					t = B - quotient * D; B = D; D = t;
+					t = x - quotient * y; x = y; y = t;
+				}
+
+				if (B == 0) {
+					U remainder = a % b;
+					a = b;
+					b = remainder;
+				}
+				else {
+					// Both results are known to lie in [0, 2^128), so wrapping arithmetic gives them exactly
+					U nextA = U(A) * a + U(B) * b;
+					U nextB = U(C) * a + U(D) * b;
+					a = nextA;
+					b = nextB;
+				}
+			}
+		}
+		else if (b != 0 && (a >> 1) > b) {
+			FRACTION_COUNT(GcdIteration);
+			U remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+
+		if constexpr (sizeof(U) > 4) {
+			if ((a >> 32) == 0)
+				return U(binary(static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b)));
+		}
+		return binary(a, b);
+	}
+
+	/**
+	*	Returns the kernel used by compute() when FRACTION_GCD_KERNEL is FRACTION_GCD_DISPATCH.
+	*/
+	inline Kernel& activeKernel() {
+		static Kernel kernel = Kernel::Binary;
+		return kernel;
+	}
+
+	/**
+	*	Selects the kernel used by compute() when FRACTION_GCD_KERNEL is FRACTION_GCD_DISPATCH.
+	*	Intended to be called once at startup, before fractions are shared between threads.
+	*
+	*	@param kernel the kernel to use from now on
+	*/
+	inline void setKernel(Kernel kernel) {
+		activeKernel() = kernel;
+	}
+
+	/**
+	*	Finds the greatest common divisor of two unsigned numbers with the requested kernel.
+	*
+	*	@param kernel the kernel to run
+	*	@param a first number
+	*	@param b second number
+	*	@return the greatest common divisor (0 only when both numbers are 0)
+	*/
+	template <typename U>
+	U run(Kernel kernel, U a, U b) {
+		switch (kernel) {
+		case Kernel::Euclid:
+			return euclid(a, b);
+		case Kernel::Lehmer:
+			return lehmer(a, b);
+		default:
+			return binary(a, b);
+		}
+	}
+
+	/**
+	*	Finds the non-negative greatest common divisor of two integers with the configured kernel.
+	*	Constant evaluation always takes the Euclidean kernel, which needs no intrinsics or global state.
+	*
+	*	@param a first number
+	*	@param b second number
+	*	@return the greatest common divisor as an unsigned number (0 only when both numbers are 0)
+	*/
+	template <typename T>
+	constexpr UnsignedOf<T> compute(T a, T b) {
+		UnsignedOf<T> x = magnitude(a);
+		UnsignedOf<T> y = magnitude(b);
+		if (constantEvaluated())
+			return euclid(x, y);
+		FRACTION_COUNT(Gcd);
+#if FRACTION_GCD_KERNEL == FRACTION_GCD_EUCLID
+		return euclid(x, y);
+#elif FRACTION_GCD_KERNEL == FRACTION_GCD_LEHMER
+		return lehmer(x, y);
+#elif FRACTION_GCD_KERNEL == FRACTION_GCD_DISPATCH
+		return run(activeKernel(), x, y);
+#else
+		return binary(x, y);
+#endif
+	}
+}
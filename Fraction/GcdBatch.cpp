@@ -0,0 +1,313 @@
+/**
+* @file		GcdBatch.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the batched gcd and reduce kernels and their runtime instruction set dispatch.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "GcdBatch.h"
+#include "Gcd.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FRACTION_GCD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+// MSVC lets any function use any intrinsic
+#define FRACTION_TARGET_AVX2
+#define FRACTION_TARGET_AVX512
+#else
+#define FRACTION_TARGET_AVX2 __attribute__((target("avx2")))
+#define FRACTION_TARGET_AVX512 __attribute__((target("avx512f,avx512cd")))
+// The AVX-512 headers of some GCC releases start intrinsics from _mm512_undefined_*(), which trips these warnings
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#else
+#define FRACTION_GCD_X86 0
+#endif
+
+namespace gcd {
+
+	namespace {
+
+		/**
+		*	Reduces one fraction exactly like Fraction::reduce(). Used on processors without vector support
+		*	and for the tail of a batch that does not fill a whole vector.
+		*/
+		void reduceScalar(std::int32_t& numerator, std::int32_t& denominator) {
+			std::int32_t divisor = static_cast<std::int32_t>(compute(numerator, denominator));
+			if (divisor != 0) {
+				numerator /= divisor;
+				denominator /= divisor;
+			}
+			if (denominator < 0) {
+				denominator *= -1;
+				numerator *= -1;
+			}
+		}
+
+#if FRACTION_GCD_X86
+		Isa detect() {
+#if defined(_MSC_VER) && !defined(__clang__)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return Isa::Scalar;
+			__cpuid(info, 1);
+			// The operating system must save the AVX (and AVX-512) registers on a context switch
+			if ((info[2] & (1 << 27)) == 0)
+				return Isa::Scalar;
+			unsigned long long enabled = _xgetbv(0);
+			if ((enabled & 0x6) != 0x6)
+				return Isa::Scalar;
+			__cpuidex(info, 7, 0);
+			bool avx2 = (info[1] & (1 << 5)) != 0;
+			bool avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 28)) != 0 && (enabled & 0xe6) == 0xe6;
+#else
+			__builtin_cpu_init();
+			bool avx2 = __builtin_cpu_supports("avx2");
+			bool avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd");
+#endif
+			return avx512 ? Isa::Avx512 : avx2 ? Isa::Avx2 : Isa::Scalar;
+		}
+
+		/**
+		*	Counts the trailing zeros of eight lanes. The lowest set bit is isolated and converted to float,
+		*	whose exponent is its position. A zero lane gives a negative count, which the variable shifts
+		*	treat as shifting everything out.
+		*/
+		FRACTION_TARGET_AVX2
+		__m256i countTrailingZeros8(__m256i value) {
+			__m256i lowest = _mm256_and_si256(value, _mm256_sub_epi32(_mm256_setzero_si256(), value));
+			__m256i bits = _mm256_castps_si256(_mm256_cvtepi32_ps(lowest));
+			__m256i exponent = _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xff));
+			return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+		}
+
+		/**
+		*	Binary GCD on eight lanes. Lanes that have finished keep their value while the others iterate.
+		*/
+		FRACTION_TARGET_AVX2
+		__m256i gcd8(__m256i a, __m256i b) {
+			__m256i zero = _mm256_setzero_si256();
+			// gcd(0, b) = gcd(b, b), so a zero operand is replaced by the other one
+			a = _mm256_blendv_epi8(a, b, _mm256_cmpeq_epi32(a, zero));
+			b = _mm256_blendv_epi8(b, a, _mm256_cmpeq_epi32(b, zero));
+
+			__m256i shift = countTrailingZeros8(_mm256_or_si256(a, b));
+			a = _mm256_srlv_epi32(a, countTrailingZeros8(a));
+			b = _mm256_srlv_epi32(b, countTrailingZeros8(b));
+			for (;;) {
+				__m256i done = _mm256_cmpeq_epi32(a, b);
+				if (_mm256_movemask_epi8(done) == -1)
+					break;
+				__m256i smaller = _mm256_min_epu32(a, b);
+				__m256i difference = _mm256_sub_epi32(_mm256_max_epu32(a, b), smaller);
+				b = _mm256_blendv_epi8(_mm256_srlv_epi32(difference, countTrailingZeros8(difference)), smaller, done);
+				a = smaller;
+			}
+			return _mm256_sllv_epi32(a, shift);
+		}
+
+		/**
+		*	Divides eight lanes by their exact divisors. There is no vector integer division, but every
+		*	32-bit value and exact quotient is representable in a double.
+		*/
+		FRACTION_TARGET_AVX2
+		__m256i divideExact8(__m256i value, __m256i divisor) {
+			__m128i low = _mm256_cvttpd_epi32(_mm256_div_pd(
+				_mm256_cvtepi32_pd(_mm256_castsi256_si128(value)), _mm256_cvtepi32_pd(_mm256_castsi256_si128(divisor))));
+			__m128i high = _mm256_cvttpd_epi32(_mm256_div_pd(
+				_mm256_cvtepi32_pd(_mm256_extracti128_si256(value, 1)), _mm256_cvtepi32_pd(_mm256_extracti128_si256(divisor, 1))));
+			return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+		}
+
+		FRACTION_TARGET_AVX2
+		std::size_t gcdAvx2(const std::uint32_t* a, const std::uint32_t* b, std::uint32_t* out, std::size_t count) {
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), gcd8(x, y));
+			}
+			return i;
+		}
+
+		FRACTION_TARGET_AVX2
+		std::size_t reduceAvx2(std::int32_t* numerators, std::int32_t* denominators, std::size_t count) {
+			__m256i zero = _mm256_setzero_si256();
+			__m256i one = _mm256_set1_epi32(1);
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				__m256i num = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(numerators + i));
+				__m256i den = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(denominators + i));
+				// abs of the most negative value stays 0x80000000, which is its magnitude read as unsigned
+				__m256i divisor = gcd8(_mm256_abs_epi32(num), _mm256_abs_epi32(den));
+				// A gcd of 0 means 0/0, which Fraction::reduce() leaves alone; dividing by 1 does the same
+				divisor = _mm256_blendv_epi8(divisor, one, _mm256_cmpeq_epi32(divisor, zero));
+				num = divideExact8(num, divisor);
+				den = divideExact8(den, divisor);
+
+				__m256i negative = _mm256_cmpgt_epi32(zero, den);
+				num = _mm256_sub_epi32(_mm256_xor_si256(num, negative), negative);
+				den = _mm256_sub_epi32(_mm256_xor_si256(den, negative), negative);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(numerators + i), num);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(denominators + i), den);
+			}
+			return i;
+		}
+
+		/**
+		*	Counts the trailing zeros of sixteen lanes from the leading zero count of the lowest set bit.
+		*	A zero lane gives -1, which the variable shifts treat as shifting everything out.
+		*/
+		FRACTION_TARGET_AVX512
+		__m512i countTrailingZeros16(__m512i value) {
+			__m512i lowest = _mm512_and_si512(value, _mm512_sub_epi32(_mm512_setzero_si512(), value));
+			return _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(lowest));
+		}
+
+		/**
+		*	Binary GCD on sixteen lanes, iterating only the lanes whose operands still differ.
+		*/
+		FRACTION_TARGET_AVX512
+		__m512i gcd16(__m512i a, __m512i b) {
+			__m512i zero = _mm512_setzero_si512();
+			a = _mm512_mask_mov_epi32(a, _mm512_cmpeq_epi32_mask(a, zero), b);
+			b = _mm512_mask_mov_epi32(b, _mm512_cmpeq_epi32_mask(b, zero), a);
+
+			__m512i shift = countTrailingZeros16(_mm512_or_si512(a, b));
+			a = _mm512_srlv_epi32(a, countTrailingZeros16(a));
+			b = _mm512_srlv_epi32(b, countTrailingZeros16(b));
+			for (__mmask16 active = _mm512_cmpneq_epi32_mask(a, b); active != 0; active = _mm512_cmpneq_epi32_mask(a, b)) {
+				__m512i smaller = _mm512_min_epu32(a, b);
+				__m512i difference = _mm512_sub_epi32(_mm512_max_epu32(a, b), smaller);
+				b = _mm512_mask_srlv_epi32(b, active, difference, countTrailingZeros16(difference));
+				a = _mm512_mask_mov_epi32(a, active, smaller);
+			}
+			return _mm512_sllv_epi32(a, shift);
+		}
+
+		FRACTION_TARGET_AVX512
+		__m512i divideExact16(__m512i value, __m512i divisor) {
+			__m256i low = _mm512_cvttpd_epi32(_mm512_div_pd(
+				_mm512_cvtepi32_pd(_mm512_castsi512_si256(value)), _mm512_cvtepi32_pd(_mm512_castsi512_si256(divisor))));
+			__m256i high = _mm512_cvttpd_epi32(_mm512_div_pd(
+				_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(value, 1)), _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(divisor, 1))));
+			return _mm512_inserti64x4(_mm512_castsi256_si512(low), high, 1);
+		}
+
+		FRACTION_TARGET_AVX512
+		std::size_t gcdAvx512(const std::uint32_t* a, const std::uint32_t* b, std::uint32_t* out, std::size_t count) {
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+				_mm512_storeu_si512(out + i, gcd16(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+			return i;
+		}
+
+		FRACTION_TARGET_AVX512
+		std::size_t reduceAvx512(std::int32_t* numerators, std::int32_t* denominators, std::size_t count) {
+			__m512i zero = _mm512_setzero_si512();
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16) {
+				__m512i num = _mm512_loadu_si512(numerators + i);
+				__m512i den = _mm512_loadu_si512(denominators + i);
+				__m512i divisor = gcd16(_mm512_abs_epi32(num), _mm512_abs_epi32(den));
+				divisor = _mm512_mask_mov_epi32(divisor, _mm512_cmpeq_epi32_mask(divisor, zero), _mm512_set1_epi32(1));
+				num = divideExact16(num, divisor);
+				den = divideExact16(den, divisor);
+
+				__mmask16 negative = _mm512_cmplt_epi32_mask(den, zero);
+				num = _mm512_mask_sub_epi32(num, negative, zero, num);
+				den = _mm512_mask_sub_epi32(den, negative, zero, den);
+				_mm512_storeu_si512(numerators + i, num);
+				_mm512_storeu_si512(denominators + i, den);
+			}
+			return i;
+		}
+#else
+		Isa detect() {
+			return Isa::Scalar;
+		}
+#endif
+
+		Isa& activeIsa() {
+			static Isa isa = detect();
+			return isa;
+		}
+	}
+
+	Isa detectedIsa() {
+		static const Isa isa = detect();
+		return isa;
+	}
+
+	Isa batchIsa() {
+		return activeIsa();
+	}
+
+	void setBatchIsa(Isa isa) {
+		activeIsa() = static_cast<int>(isa) <= static_cast<int>(detectedIsa()) ? isa : detectedIsa();
+	}
+
+	void gcdBatch(const std::uint32_t* a, const std::uint32_t* b, std::uint32_t* out, std::size_t count) {
+		std::size_t done = 0;
+#if FRACTION_GCD_X86
+		switch (batchIsa()) {
+		case Isa::Avx512:
+			done = gcdAvx512(a, b, out, count);
+			break;
+		case Isa::Avx2:
+			done = gcdAvx2(a, b, out, count);
+			break;
+		default:
+			break;
+		}
+#endif
+		for (std::size_t i = done; i < count; ++i)
+			out[i] = binary(a[i], b[i]);
+	}
+
+	void reduceBatch(std::int32_t* numerators, std::int32_t* denominators, std::size_t count) {
+		std::size_t done = 0;
+#if FRACTION_GCD_X86
+		switch (batchIsa()) {
+		case Isa::Avx512:
+			done = reduceAvx512(numerators, denominators, count);
+			break;
+		case Isa::Avx2:
+			done = reduceAvx2(numerators, denominators, count);
+			break;
+		default:
+			break;
+		}
+#endif
+		for (std::size_t i = done; i < count; ++i)
+			reduceScalar(numerators[i], denominators[i]);
+	}
+}
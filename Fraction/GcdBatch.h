@@ -0,0 +1,81 @@
+#pragma once
+/**
+* @file		GcdBatch.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Batched greatest common divisor and reduction of 32-bit fractions. A vectorized binary GCD works on
+*  8 (AVX2) or 16 (AVX-512) lanes at once with masked iteration, chosen at runtime through CPUID; other
+*  processors use a portable scalar loop. Results match Fraction::reduce() exactly, sign rule included.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gcd {
+
+	enum class Isa { Scalar, Avx2, Avx512 };
+
+	/**
+	*	Returns the widest instruction set the batch kernels can use on this processor.
+	*/
+	Isa detectedIsa();
+
+	/**
+	*	Returns the instruction set currently used by gcdBatch() and reduceBatch().
+	*/
+	Isa batchIsa();
+
+	/**
+	*	Selects the instruction set used by gcdBatch() and reduceBatch(). Requests for an instruction set
+	*	the processor does not support fall back to the widest one it does. Intended for tests and benchmarks,
+	*	and to be called before batches are run from several threads.
+	*
+	*	@param isa the instruction set to use from now on
+	*/
+	void setBatchIsa(Isa isa);
+
+	/**
+	*	Finds the greatest common divisor of many pairs of unsigned numbers.
+	*
+	*	@param a first numbers
+	*	@param b second numbers
+	*	@param out receives gcd(a[i], b[i]); may alias a or b
+	*	@param count number of pairs
+	*/
+	void gcdBatch(const std::uint32_t* a, const std::uint32_t* b, std::uint32_t* out, std::size_t count);
+
+	/**
+	*	Puts many fractions into simplest form in place, with the same rules as Fraction::reduce():
+	*	both parts are divided by their gcd (unless it is 0) and the sign ends up on the numerator.
+	*
+	*	@param numerators numerators of the fractions
+	*	@param denominators denominators of the fractions
+	*	@param count number of fractions
+	*/
+	void reduceBatch(std::int32_t* numerators, std::int32_t* denominators, std::size_t count);
+}
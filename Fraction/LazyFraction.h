@@ -0,0 +1,143 @@
+#pragma once
+/**
+* @file		LazyFraction.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Opt-in fraction that defers reduce() until its value is observed. Arithmetic keeps the denominator positive
+*  but skips the gcd, tracking whether the value is in simplest form; it is reduced on ==, on stream output,
+*  on hashing, on reading the numerator or denominator, and whenever a result would no longer fit in IntT.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "Fraction.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+
+/**
+*	A fraction that defers reduce() until its value is observed. The observers that reduce are const and write the
+*	reduced parts back, so unlike BasicFraction a const lazy fraction is not safe to read from several threads at
+*	once. Call normalize() before sharing one; from then on const access only reads.
+*/
+template <typename IntT>
+class BasicLazyFraction
+{
+	static_assert(sizeof(typename BasicFraction<IntT>::WideInteger) > sizeof(IntT),
+		"lazy fractions detect overflow in the wide type, so IntT needs a wider native type");
+
+public:
+	using Integer = IntT;
+	using WideInteger = typename BasicFraction<IntT>::WideInteger;
+
+	explicit BasicLazyFraction();
+	BasicLazyFraction(IntT numerator);
+	BasicLazyFraction(IntT numerator, IntT denominator);
+	BasicLazyFraction(const BasicFraction<IntT>& fraction);
+
+	BasicFraction<IntT> toFraction() const;
+	bool isNormalized() const;
+	void normalize() const;
+	IntT getNumerator() const;
+	IntT getDenominator() const;
+
+	// Equality Operator Overloads, reduce both operands
+	bool operator==(const BasicLazyFraction& rhs) const;
+	bool operator!=(const BasicLazyFraction& rhs) const;
+
+	// Hashing, over the reduced form so that a lazy fraction hashes as the equal BasicFraction does
+	std::uint64_t hash() const;
+
+	// Comparison Operator Overloads, cross multiply without reducing
+	int compare(const BasicLazyFraction& rhs) const;
+	bool operator<(const BasicLazyFraction& rhs) const;
+	bool operator<=(const BasicLazyFraction& rhs) const;
+	bool operator>(const BasicLazyFraction& rhs) const;
+	bool operator>=(const BasicLazyFraction& rhs) const;
+
+	// Arithmetic Operator Overloads
+	BasicLazyFraction operator+(const BasicLazyFraction& rhs) const;
+	BasicLazyFraction operator+(const IntT rhs) const;
+	BasicLazyFraction& operator+=(const BasicLazyFraction& rhs);
+	BasicLazyFraction& operator+=(const IntT rhs);
+
+	BasicLazyFraction operator-(const BasicLazyFraction& rhs) const;
+	BasicLazyFraction operator-(const IntT rhs) const;
+	BasicLazyFraction& operator-=(const BasicLazyFraction& rhs);
+	BasicLazyFraction& operator-=(const IntT rhs);
+
+	BasicLazyFraction operator*(const BasicLazyFraction& rhs) const;
+	BasicLazyFraction operator*(const IntT rhs) const;
+	BasicLazyFraction& operator*=(const BasicLazyFraction& rhs);
+	BasicLazyFraction& operator*=(const IntT rhs);
+
+	BasicLazyFraction operator/(const BasicLazyFraction& rhs) const;
+	BasicLazyFraction operator/(const IntT rhs) const;
+	BasicLazyFraction& operator/=(const BasicLazyFraction& rhs);
+	BasicLazyFraction& operator/=(const IntT rhs);
+
+	// Stream Manipulation Operator Overloads
+	template <typename T> friend std::ostream& operator <<(std::ostream&, const BasicLazyFraction<T>&);
+	template <typename T> friend std::istream& operator >>(std::istream&, BasicLazyFraction<T>&);
+
+private:
+	// Reducing does not change the value, so observers that reduce stay const
+	mutable IntT numerator;
+	mutable IntT denominator;
+	mutable bool normalized;
+
+	void assign(WideInteger num, WideInteger den);
+	static bool fits(WideInteger value);
+
+};
+
+namespace std {
+	/**
+	*	Hashes a lazy fraction by its simplest form, so that equal values hash alike however they were computed.
+	*/
+	template <typename IntT>
+	struct hash<BasicLazyFraction<IntT>> {
+		std::size_t operator()(const BasicLazyFraction<IntT>& fraction) const {
+			return static_cast<std::size_t>(fraction.hash());
+		}
+	};
+}
+
+// Lazy variants of the original int fraction and the 64-bit fraction
+using LazyFraction = BasicLazyFraction<int>;
+#ifdef __SIZEOF_INT128__
+using LazyFraction64 = BasicLazyFraction<std::int64_t>;
+#endif
+
+#include "LazyFraction.inl"
+
+// Instantiated once in LazyFraction.cpp
+extern template class BasicLazyFraction<std::int32_t>;
+#ifdef __SIZEOF_INT128__
+extern template class BasicLazyFraction<std::int64_t>;
+#endif
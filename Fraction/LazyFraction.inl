@@ -0,0 +1,418 @@
+#pragma once
+/**
+* @file		LazyFraction.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the lazily reduced fraction. Included by LazyFraction.h, since BasicLazyFraction is a template over its integer type.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+/**
+*	Constructs a fraction equal to one, like the default Fraction.
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>::BasicLazyFraction() : BasicLazyFraction(1, 1) {
+}
+
+/**
+*	Constructs a whole number fraction, which is already in simplest form.
+*
+*	@param numerator the whole number
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>::BasicLazyFraction(IntT numerator) : numerator(numerator), denominator(1), normalized(true) {
+}
+
+/**
+*	Constructs a fraction from a numerator and denominator without reducing it. Only the sign is moved onto the numerator.
+*
+*	@param numerator the numerator
+*	@param denominator the denominator
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>::BasicLazyFraction(IntT numerator, IntT denominator) {
+	assign(numerator, denominator);
+}
+
+/**
+*	Constructs a lazy fraction from an ordinary one, which is always in simplest form.
+*
+*	@param fraction the fraction to copy
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>::BasicLazyFraction(const BasicFraction<IntT>& fraction)
+	: numerator(fraction.numerator), denominator(fraction.denominator), normalized(true) {
+}
+
+/**
+*	Returns the value of this fraction as an ordinary Fraction.
+*
+*	@return the reduced fraction
+*/
+template <typename IntT>
+BasicFraction<IntT> BasicLazyFraction<IntT>::toFraction() const {
+	normalize();
+	return BasicFraction<IntT>(numerator, denominator, typename BasicFraction<IntT>::ReducedTag());
+}
+
+/**
+*	Tells whether the fraction is currently stored in simplest form.
+*
+*	@return true if no reduce is pending
+*/
+template <typename IntT>
+bool BasicLazyFraction<IntT>::isNormalized() const {
+	return normalized;
+}
+
+/**
+*	Puts this fraction into simplest form if it is not already. The denominator is always kept positive,
+*	so only the division by the gcd was deferred.
+*/
+template <typename IntT>
+void BasicLazyFraction<IntT>::normalize() const {
+	if (normalized)
+		return;
+	IntT gcd = static_cast<IntT>(gcd::compute(numerator, denominator));
+	if (gcd != 0) {
+		numerator /= gcd;
+		denominator /= gcd;
+	}
+	normalized = true;
+}
+
+/**
+*	Returns the numerator of the fraction in simplest form.
+*
+*	@return the reduced numerator
+*/
+template <typename IntT>
+IntT BasicLazyFraction<IntT>::getNumerator() const {
+	normalize();
+	return numerator;
+}
+
+/**
+*	Returns the denominator of the fraction in simplest form.
+*
+*	@return the reduced, positive denominator
+*/
+template <typename IntT>
+IntT BasicLazyFraction<IntT>::getDenominator() const {
+	normalize();
+	return denominator;
+}
+
+/**
+*	Stores the result of an operation computed in the wide type. The sign is moved onto the numerator, and the
+*	value is only reduced when it would not otherwise fit in IntT; it is then narrowed just like Fraction does.
+*
+*	@param num wide numerator
+*	@param den wide denominator
+*/
+template <typename IntT>
+void BasicLazyFraction<IntT>::assign(WideInteger num, WideInteger den) {
+	if (den < 0) {
+		den *= -1;
+		num *= -1;
+	}
+	if (!fits(num) || !fits(den)) {
+		WideInteger gcd = static_cast<WideInteger>(gcd::compute(num, den));
+		if (gcd != 0) {
+			num /= gcd;
+			den /= gcd;
+		}
+		numerator = static_cast<IntT>(num);
+		denominator = static_cast<IntT>(den);
+		normalized = true;
+		return;
+	}
+	numerator = static_cast<IntT>(num);
+	denominator = static_cast<IntT>(den);
+	normalized = den == 1;
+}
+
+/**
+*	Tells whether a wide value can be stored in IntT without losing information.
+*
+*	@param value the wide value
+*	@return true if the value lies within the range of IntT
+*/
+template <typename IntT>
+bool BasicLazyFraction<IntT>::fits(WideInteger value) {
+	return value >= std::numeric_limits<IntT>::min() && value <= std::numeric_limits<IntT>::max();
+}
+
+/**
+*	Compares this fraction with the provided one for equality. Both are reduced first, after which equal values have equal parts.
+*
+*	@param rhs fraction to be compared with this one
+*	@return true if both fractions have the same value
+*/
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator==(const BasicLazyFraction& rhs) const {
+	normalize();
+	rhs.normalize();
+	return numerator == rhs.numerator && denominator == rhs.denominator;
+}
+
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator!=(const BasicLazyFraction& rhs) const {
+	return !(*this == rhs);
+}
+
+/**
+*	Hashes the fraction by its simplest form, with the same function as BasicFraction::hash(), so that a lazy
+*	fraction and a fraction of the same value hash alike.
+*
+*	@return the 64-bit hash
+*/
+template <typename IntT>
+std::uint64_t BasicLazyFraction<IntT>::hash() const {
+	normalize();
+	return BasicFraction<IntT>(numerator, denominator, typename BasicFraction<IntT>::ReducedTag()).hash();
+}
+
+/**
+*	Three-way compares this fraction with the provided one by cross multiplying in the wide type, which gives the
+*	right answer whether or not either side is reduced.
+*
+*	@param rhs fraction to be compared with this one
+*	@return a negative number, zero or a positive number when this fraction is less than, equal to or greater than rhs
+*/
+template <typename IntT>
+int BasicLazyFraction<IntT>::compare(const BasicLazyFraction& rhs) const {
+	WideInteger lhsCross = WideInteger(numerator) * rhs.denominator;
+	WideInteger rhsCross = WideInteger(rhs.numerator) * denominator;
+	return (lhsCross > rhsCross) - (lhsCross < rhsCross);
+}
+
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator<(const BasicLazyFraction& rhs) const {
+	return compare(rhs) < 0;
+}
+
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator<=(const BasicLazyFraction& rhs) const {
+	return compare(rhs) <= 0;
+}
+
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator>(const BasicLazyFraction& rhs) const {
+	return compare(rhs) > 0;
+}
+
+template <typename IntT>
+bool BasicLazyFraction<IntT>::operator>=(const BasicLazyFraction& rhs) const {
+	return compare(rhs) >= 0;
+}
+
+/**
+*	Returns a new fraction which is the sum of this one and the provided one.
+*
+*	@param rhs fraction to be added to this one
+*	@return a new, possibly unreduced, fraction holding the sum
+*/
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator+(const BasicLazyFraction& rhs) const {
+	BasicLazyFraction result(*this);
+	result += rhs;
+	return result;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator+(const IntT rhs) const {
+	BasicLazyFraction result(*this);
+	result += rhs;
+	return result;
+}
+
+/**
+*	Adds the provided fraction to this one without reducing. Equal denominators, the common case in
+*	accumulation loops over prices or probabilities, only add the numerators.
+*
+*	@param rhs fraction to be added to this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator+=(const BasicLazyFraction& rhs) {
+	if (denominator == rhs.denominator)
+		assign(WideInteger(numerator) + rhs.numerator, denominator);
+	else
+		assign(WideInteger(numerator) * rhs.denominator + WideInteger(rhs.numerator) * denominator, WideInteger(denominator) * rhs.denominator);
+	return *this;
+}
+
+/**
+*	Adds the provided integer to this fraction. Adding a multiple of the denominator cannot introduce a
+*	common factor, so a reduced fraction stays reduced.
+*
+*	@param rhs integer to be added to this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator+=(const IntT rhs) {
+	bool wasNormalized = normalized;
+	assign(WideInteger(numerator) + WideInteger(rhs) * denominator, denominator);
+	normalized = normalized || wasNormalized;
+	return *this;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator-(const BasicLazyFraction& rhs) const {
+	BasicLazyFraction result(*this);
+	result -= rhs;
+	return result;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator-(const IntT rhs) const {
+	BasicLazyFraction result(*this);
+	result -= rhs;
+	return result;
+}
+
+/**
+*	Subtracts the provided fraction from this one without reducing.
+*
+*	@param rhs fraction to be subtracted from this one
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator-=(const BasicLazyFraction& rhs) {
+	if (denominator == rhs.denominator)
+		assign(WideInteger(numerator) - rhs.numerator, denominator);
+	else
+		assign(WideInteger(numerator) * rhs.denominator - WideInteger(rhs.numerator) * denominator, WideInteger(denominator) * rhs.denominator);
+	return *this;
+}
+
+/**
+*	Subtracts the provided integer from this fraction. A reduced fraction stays reduced, as for +=.
+*
+*	@param rhs integer to be subtracted from this fraction
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator-=(const IntT rhs) {
+	bool wasNormalized = normalized;
+	assign(WideInteger(numerator) - WideInteger(rhs) * denominator, denominator);
+	normalized = normalized || wasNormalized;
+	return *this;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator*(const BasicLazyFraction& rhs) const {
+	BasicLazyFraction result(*this);
+	result *= rhs;
+	return result;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator*(const IntT rhs) const {
+	BasicLazyFraction result(*this);
+	result *= rhs;
+	return result;
+}
+
+/**
+*	Multiplies this fraction by the provided one without reducing.
+*
+*	@param rhs fraction to multiply this one by
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator*=(const BasicLazyFraction& rhs) {
+	assign(WideInteger(numerator) * rhs.numerator, WideInteger(denominator) * rhs.denominator);
+	return *this;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator*=(const IntT rhs) {
+	assign(WideInteger(numerator) * rhs, denominator);
+	return *this;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator/(const BasicLazyFraction& rhs) const {
+	BasicLazyFraction result(*this);
+	result /= rhs;
+	return result;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT> BasicLazyFraction<IntT>::operator/(const IntT rhs) const {
+	BasicLazyFraction result(*this);
+	result /= rhs;
+	return result;
+}
+
+/**
+*	Divides this fraction by the provided one without reducing.
+*
+*	@param rhs fraction to divide this one by
+*	@return a reference to this fraction, for chaining
+*/
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator/=(const BasicLazyFraction& rhs) {
+	assign(WideInteger(numerator) * rhs.denominator, WideInteger(denominator) * rhs.numerator);
+	return *this;
+}
+
+template <typename IntT>
+BasicLazyFraction<IntT>& BasicLazyFraction<IntT>::operator/=(const IntT rhs) {
+	assign(numerator, WideInteger(denominator) * rhs);
+	return *this;
+}
+
+/**
+*	Writes the fraction in simplest form, in the same format as Fraction.
+*
+*	@param os outputstream that the fraction string is written to
+*	@param rhs fraction whos string representation is inserted into the outputstream
+*	@return the provided outputstream after inserting into it
+*/
+template <typename IntT>
+std::ostream& operator <<(std::ostream& os, const BasicLazyFraction<IntT>& rhs) {
+	return os << rhs.toFraction();
+}
+
+/**
+*	Reads a fraction in the same format as Fraction, leaving it unreduced.
+*
+*	@param is inputstream that the fraction string is extracted from
+*	@param rhs fraction whos values are set from the contents of the stream
+*	@return the provided inputstream after extracting from it
+*/
+template <typename IntT>
+std::istream& operator >>(std::istream& is, BasicLazyFraction<IntT>& rhs) {
+	IntT num = 0;
+	IntT den = 1;
+	if (extractFractionParts(is, num, den))
+		rhs.assign(num, den);
+	return is;
+}
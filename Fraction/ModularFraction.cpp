@@ -0,0 +1,311 @@
+/**
+* @file		ModularFraction.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Montgomery fields, the prime table and Chinese remaindering with rational reconstruction.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "ModularFraction.h"
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	// Witnesses that make Miller-Rabin deterministic below 3.3 * 10^24 (Sorenson and Webster, 2015)
+	constexpr std::uint64_t kWitnesses[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+
+}
+
+/**
+*	Constructs the field of integers modulo the provided prime and precomputes its Montgomery constants.
+*	-prime^-1 mod 2^64 comes from Newton's iteration, which doubles the correct low bits each step from the three
+*	that any odd number has as its own inverse; R^2 comes from doubling R mod prime 64 times, which avoids a
+*	128-bit division.
+*
+*	@param prime an odd prime below 2^62; primality itself is not checked
+*	@throws std::invalid_argument if prime is even, below 3 or not below 2^62
+*/
+modular::Field::Field(std::uint64_t prime)
+	: modulus(prime), negatedInverse(0), rSquared(0), rCubed(0), divisionByZero(false) {
+	if (prime < 3 || prime % 2 == 0 || (prime >> 62) != 0)
+		throw std::invalid_argument("field modulus must be an odd prime below 2^62");
+
+	std::uint64_t inverse = prime;
+	for (int i = 0; i < 5; ++i)
+		inverse *= 2 - prime * inverse;
+	negatedInverse = 0 - inverse;
+
+	std::uint64_t r = (0 - prime) % prime;
+	for (int i = 0; i < 64; ++i) {
+		r <<= 1;
+		if (r >= prime)
+			r -= prime;
+	}
+	rSquared = r;
+	rCubed = multiply(rSquared, rSquared);
+}
+
+std::uint64_t modular::Field::prime() const {
+	return modulus;
+}
+
+/**
+*	Tells whether a division by zero happened in this field, meaning the prime divides a denominator met by the
+*	computation and its residue says nothing about the answer.
+*
+*	@return true once something was divided by zero
+*/
+bool modular::Field::unlucky() const {
+	return divisionByZero;
+}
+
+modular::Residue modular::Field::operator()(long long value) const {
+	return fromWord(static_cast<std::uint64_t>(gcd::magnitude(value) % modulus), value < 0);
+}
+
+modular::Residue modular::Field::operator()(const BigInteger& value) const {
+	long long remainder = (value % BigInteger(static_cast<long long>(modulus))).toSmall();
+	return fromWord(gcd::magnitude(remainder), remainder < 0);
+}
+
+modular::Residue modular::Field::operator()(const BigFraction& value) const {
+	return quotient((*this)(value.getNumerator()), (*this)(value.getDenominator()));
+}
+
+modular::Residue modular::Field::zero() const {
+	return Residue(this, 0);
+}
+
+modular::Residue modular::Field::one() const {
+	return Residue(this, toMontgomery(1));
+}
+
+/**
+*	Inverts a Montgomery form. The half-extended Euclidean algorithm inverts aR to a^-1 R^-1, and one Montgomery
+*	multiplication by R^3 turns that into the Montgomery form a^-1 R. Zero has no inverse: the field is marked
+*	unlucky and zero is returned, so the computation runs to the end and its residue is dropped.
+*
+*	@param value Montgomery form to invert
+*	@return the Montgomery form of the inverse
+*/
+std::uint64_t modular::Field::invert(std::uint64_t value) const {
+	if (value == 0) {
+		divisionByZero = true;
+		return 0;
+	}
+	std::int64_t cofactor;
+	gcd::halfExtended<std::uint64_t>(value, modulus, cofactor);
+	std::uint64_t inverse = cofactor < 0 ? static_cast<std::uint64_t>(cofactor) + modulus : static_cast<std::uint64_t>(cofactor);
+	return multiply(inverse, rCubed);
+}
+
+/**
+*	Makes the residue of a signed number from its magnitude reduced modulo the prime.
+*
+*	@param magnitude |value| mod prime
+*	@param negative whether the value is negative
+*	@return the residue of the value
+*/
+modular::Residue modular::Field::fromWord(std::uint64_t magnitude, bool negative) const {
+	std::uint64_t montgomery = toMontgomery(magnitude);
+	return Residue(this, negative ? subtract(0, montgomery) : montgomery);
+}
+
+modular::Residue modular::Field::quotient(Residue numerator, Residue denominator) const {
+	return Residue(this, multiply(numerator.montgomery, invert(denominator.montgomery)));
+}
+
+/**
+*	Constructs an empty reconstructor, which has seen no residues.
+*/
+modular::Reconstructor::Reconstructor()
+	: count(0), product(1), combined(0) {
+}
+
+/**
+*	Merges the residue of the number modulo a new prime. With c the residue modulo the product P so far, the merged
+*	residue is c + P * k where k = (residue - c) / P modulo the prime, so only word-sized residues of c and P are
+*	needed and the big numbers see one multiplication and one addition.
+*
+*	@param prime a prime not added before
+*	@param residue the number modulo prime
+*/
+void modular::Reconstructor::add(std::uint64_t prime, std::uint64_t residue) {
+	BigInteger big(static_cast<long long>(prime));
+	if (count == 0) {
+		combined = BigInteger(static_cast<long long>(residue));
+		product = big;
+	}
+	else {
+		Field field(prime);
+		std::uint64_t previous = field.toMontgomery(static_cast<std::uint64_t>((combined % big).toSmall()));
+		std::uint64_t modulus = field.toMontgomery(static_cast<std::uint64_t>((product % big).toSmall()));
+		std::uint64_t difference = field.subtract(field.toMontgomery(residue), previous);
+		std::uint64_t k = field.fromMontgomery(field.multiply(difference, field.invert(modulus)));
+		combined += product * BigInteger(static_cast<long long>(k));
+		product *= big;
+	}
+	++count;
+}
+
+std::size_t modular::Reconstructor::primes() const {
+	return count;
+}
+
+const BigInteger& modular::Reconstructor::modulus() const {
+	return product;
+}
+
+/**
+*	Finds the fraction n / d with |n| and d at most sqrt(P / 2) that is congruent to the combined residue modulo the
+*	product P, if there is one; it is unique. The half-extended Euclidean algorithm runs on (P, c) and stops at the
+*	first remainder r within the bound; the cofactor t of c at that point gives the candidate r / t, which is
+*	accepted when t is within the bound as well and coprime to r (Wang, 1981). The bound is computed once by Newton's
+*	iteration, which starts from 2^(31 k) for k primes and so is only a few steps from it, as every prime is close
+*	to 2^62; P is odd, so no remainder meets the bound with equality.
+*
+*	@param result receives the fraction in simplest form
+*	@return true if a fraction within the bounds exists
+*/
+bool modular::Reconstructor::reconstruct(BigFraction& result) const {
+	if (count == 0)
+		return false;
+	const BigInteger two(2);
+	BigInteger half = product / two;
+	BigInteger bound(1);
+	for (std::size_t i = 0; i < count; ++i)
+		bound *= BigInteger(1LL << 31);
+	for (;;) {
+		BigInteger next = (bound + half / bound) / two;
+		if (next >= bound)
+			break;
+		bound = std::move(next);
+	}
+
+	BigInteger previous = product;
+	BigInteger remainder = combined;
+	BigInteger previousCofactor(0);
+	BigInteger cofactor(1);
+	BigInteger quotient;
+	BigInteger next;
+	while (remainder > bound) {
+		BigInteger::divMod(previous, remainder, quotient, next);
+		previous = std::move(remainder);
+		remainder = std::move(next);
+		next = previousCofactor - quotient * cofactor;
+		previousCofactor = std::move(cofactor);
+		cofactor = std::move(next);
+	}
+	if (cofactor.sign() == 0 || cofactor > bound || -cofactor > bound)
+		return false;
+	if (BigInteger::gcd(remainder, cofactor) != BigInteger(1))
+		return false;
+	result = BigFraction(remainder, cofactor);
+	return true;
+}
+
+/**
+*	Tells whether a candidate answer is consistent with the residue of the answer modulo a further prime.
+*
+*	@param candidate the reconstructed fraction
+*	@param prime a prime that was not used to reconstruct the candidate
+*	@param residue the answer modulo prime
+*	@return true if the candidate reduces to residue modulo prime
+*/
+bool modular::Reconstructor::agrees(const BigFraction& candidate, std::uint64_t prime, std::uint64_t residue) {
+	Field field(prime);
+	Residue value = field(candidate);
+	return !field.unlucky() && value.value() == residue;
+}
+
+/**
+*	Returns the index-th largest prime below 2^62. The table is filled on demand by testing odd numbers downwards
+*	and is shared by all threads.
+*
+*	@param index position of the prime, counting from 0
+*	@return the prime
+*/
+std::uint64_t modular::prime(std::size_t index) {
+	static std::mutex mutex;
+	static std::vector<std::uint64_t> primes;
+	std::lock_guard<std::mutex> lock(mutex);
+	std::uint64_t candidate = primes.empty() ? (std::uint64_t(1) << 62) + 1 : primes.back();
+	while (primes.size() <= index) {
+		do {
+			candidate -= 2;
+		} while (!isPrime(candidate));
+		primes.push_back(candidate);
+	}
+	return primes[index];
+}
+
+/**
+*	Tells whether a number is prime, by trial division by the witnesses and deterministic Miller-Rabin.
+*
+*	@param value the number to test, below 2^62
+*	@return true if value is prime
+*/
+bool modular::isPrime(std::uint64_t value) {
+	if (value < 2)
+		return false;
+	for (std::uint64_t witness : kWitnesses) {
+		if (value % witness == 0)
+			return value == witness;
+	}
+
+	Field field(value);
+	std::uint64_t odd = value - 1;
+	int twos = 0;
+	while (odd % 2 == 0) {
+		odd /= 2;
+		++twos;
+	}
+	const std::uint64_t one = field.toMontgomery(1);
+	const std::uint64_t minusOne = field.subtract(0, one);
+	for (std::uint64_t witness : kWitnesses) {
+		std::uint64_t power = one;
+		std::uint64_t base = field.toMontgomery(witness);
+		for (std::uint64_t e = odd; e != 0; e >>= 1) {
+			if (e & 1)
+				power = field.multiply(power, base);
+			base = field.multiply(base, base);
+		}
+		if (power == one || power == minusOne)
+			continue;
+		bool composite = true;
+		for (int i = 1; i < twos && composite; ++i) {
+			power = field.multiply(power, power);
+			composite = power != minusOne;
+		}
+		if (composite)
+			return false;
+	}
+	return true;
+}
@@ -0,0 +1,173 @@
+#pragma once
+/**
+* @file		ModularFraction.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Modular evaluation of exact rational computations: Montgomery arithmetic modulo 62-bit primes, one thread
+*  per prime, Chinese remaindering and rational reconstruction, stopping as soon as the answer is confirmed.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "BigFraction.h"
+#include "Fraction.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+*	Exact rational computations evaluated modulo many word-sized primes instead of on growing fractions.
+*	A computation is written once against Field and Residue, which support the four operations like a fraction,
+*	and evaluate() runs it modulo one prime per task, combines the residues with the Chinese Remainder Theorem and
+*	recovers the fraction by rational reconstruction. Intermediate results never grow past a machine word, so the
+*	cost follows the size of the answer rather than the size of the coefficients met along the way.
+*/
+namespace modular {
+
+	// Residues that evaluate() may spend on one computation before giving up
+	constexpr std::size_t kMaxPrimes = 1024;
+
+	class Field;
+
+	/**
+	*	Element of the integers modulo a prime, kept in Montgomery form. Only meaningful with the field that made it.
+	*	Dividing by zero yields zero and marks the field unlucky, so that evaluate() drops the prime.
+	*/
+	class Residue
+	{
+
+	public:
+		std::uint64_t value() const;
+
+		// Equality Operator Overloads
+		bool operator==(const Residue& rhs) const;
+		bool operator!=(const Residue& rhs) const;
+
+		// Arithmetic Operator Overloads
+		Residue operator-() const;
+		Residue operator+(const Residue& rhs) const;
+		Residue operator-(const Residue& rhs) const;
+		Residue operator*(const Residue& rhs) const;
+		Residue operator/(const Residue& rhs) const;
+		Residue& operator+=(const Residue& rhs);
+		Residue& operator-=(const Residue& rhs);
+		Residue& operator*=(const Residue& rhs);
+		Residue& operator/=(const Residue& rhs);
+
+	private:
+		friend class Field;
+
+		const Field* field;
+		// value * 2^64 mod prime
+		std::uint64_t montgomery;
+
+		Residue(const Field* field, std::uint64_t montgomery);
+
+	};
+
+	/**
+	*	Integers modulo an odd prime below 2^62 with Montgomery multiplication (Montgomery, 1985): residues are kept
+	*	multiplied by R = 2^64, and a product is reduced with two word multiplications and a shift instead of a
+	*	division. The headroom of the 62-bit bound keeps every intermediate sum inside 128 bits.
+	*	Inverses come from the half-extended Euclidean algorithm in gcd::halfExtended.
+	*/
+	class Field
+	{
+
+	public:
+		explicit Field(std::uint64_t prime);
+
+		std::uint64_t prime() const;
+		bool unlucky() const;
+
+		// Conversions into the field; a denominator divisible by the prime marks the field unlucky
+		Residue operator()(long long value) const;
+		Residue operator()(const BigInteger& value) const;
+		Residue operator()(const BigFraction& value) const;
+		template <typename IntT> Residue operator()(const BasicFraction<IntT>& value) const;
+		Residue zero() const;
+		Residue one() const;
+
+		// Arithmetic on Montgomery forms in [0, prime)
+		std::uint64_t add(std::uint64_t lhs, std::uint64_t rhs) const;
+		std::uint64_t subtract(std::uint64_t lhs, std::uint64_t rhs) const;
+		std::uint64_t multiply(std::uint64_t lhs, std::uint64_t rhs) const;
+		std::uint64_t invert(std::uint64_t value) const;
+		std::uint64_t toMontgomery(std::uint64_t value) const;
+		std::uint64_t fromMontgomery(std::uint64_t value) const;
+
+	private:
+		std::uint64_t modulus;
+		// -modulus^-1 mod 2^64
+		std::uint64_t negatedInverse;
+		// R^2 and R^3 mod modulus, for entering Montgomery form and for inverses
+		std::uint64_t rSquared;
+		std::uint64_t rCubed;
+		mutable bool divisionByZero;
+
+		static std::uint64_t multiplyWide(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& low);
+		std::uint64_t reduce(std::uint64_t high, std::uint64_t low) const;
+		Residue fromWord(std::uint64_t magnitude, bool negative) const;
+		Residue quotient(Residue numerator, Residue denominator) const;
+
+	};
+
+	/**
+	*	Accumulates residues of one rational number modulo distinct primes and reconstructs it. The residues are
+	*	merged into a single residue modulo the product of the primes as they arrive (Garner's form of the Chinese
+	*	Remainder Theorem), and reconstruction runs the half-extended Euclidean algorithm on that pair (Wang, 1981).
+	*/
+	class Reconstructor
+	{
+
+	public:
+		Reconstructor();
+
+		void add(std::uint64_t prime, std::uint64_t residue);
+		std::size_t primes() const;
+		const BigInteger& modulus() const;
+		bool reconstruct(BigFraction& result) const;
+		static bool agrees(const BigFraction& candidate, std::uint64_t prime, std::uint64_t residue);
+
+	private:
+		std::size_t count;
+		BigInteger product;
+		// Residue modulo product, in [0, product)
+		BigInteger combined;
+
+	};
+
+	std::uint64_t prime(std::size_t index);
+	bool isPrime(std::uint64_t value);
+
+	template <typename Computation>
+	BigFraction evaluate(Computation&& computation, ThreadPool& pool = ThreadPool::shared(), std::size_t maxPrimes = kMaxPrimes);
+
+	template <typename IntT, typename Computation>
+	BasicFraction<IntT> evaluateAs(Computation&& computation, ThreadPool& pool = ThreadPool::shared(), std::size_t maxPrimes = kMaxPrimes);
+}
+
+#include "ModularFraction.inl"
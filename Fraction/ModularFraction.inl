@@ -0,0 +1,262 @@
+/**
+* @file		ModularFraction.inl
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Template implementation of the modular evaluation engine, included from ModularFraction.h.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "CheckedFraction.h"
+#include "Gcd.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+*	Multiplies two words into a double word.
+*
+*	@param lhs first factor
+*	@param rhs second factor
+*	@param low receives the low word of the product
+*	@return the high word of the product
+*/
+inline std::uint64_t modular::Field::multiplyWide(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& low) {
+#ifdef __SIZEOF_INT128__
+	unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+	low = static_cast<std::uint64_t>(product);
+	return static_cast<std::uint64_t>(product >> 64);
+#else
+	std::uint64_t high;
+	low = _umul128(lhs, rhs, &high);
+	return high;
+#endif
+}
+
+/**
+*	Constructs a residue from its Montgomery form.
+*
+*	@param field the field the residue belongs to
+*	@param montgomery the residue times 2^64, modulo the prime
+*/
+inline modular::Residue::Residue(const Field* field, std::uint64_t montgomery)
+	: field(field), montgomery(montgomery) {
+}
+
+/**
+*	Returns the residue as an ordinary number.
+*
+*	@return the residue, in [0, prime)
+*/
+inline std::uint64_t modular::Residue::value() const {
+	return field->fromMontgomery(montgomery);
+}
+
+inline bool modular::Residue::operator==(const Residue& rhs) const {
+	return montgomery == rhs.montgomery;
+}
+
+inline bool modular::Residue::operator!=(const Residue& rhs) const {
+	return montgomery != rhs.montgomery;
+}
+
+inline modular::Residue modular::Residue::operator-() const {
+	return Residue(field, field->subtract(0, montgomery));
+}
+
+inline modular::Residue modular::Residue::operator+(const Residue& rhs) const {
+	return Residue(field, field->add(montgomery, rhs.montgomery));
+}
+
+inline modular::Residue modular::Residue::operator-(const Residue& rhs) const {
+	return Residue(field, field->subtract(montgomery, rhs.montgomery));
+}
+
+inline modular::Residue modular::Residue::operator*(const Residue& rhs) const {
+	return Residue(field, field->multiply(montgomery, rhs.montgomery));
+}
+
+inline modular::Residue modular::Residue::operator/(const Residue& rhs) const {
+	return Residue(field, field->multiply(montgomery, field->invert(rhs.montgomery)));
+}
+
+inline modular::Residue& modular::Residue::operator+=(const Residue& rhs) {
+	montgomery = field->add(montgomery, rhs.montgomery);
+	return *this;
+}
+
+inline modular::Residue& modular::Residue::operator-=(const Residue& rhs) {
+	montgomery = field->subtract(montgomery, rhs.montgomery);
+	return *this;
+}
+
+inline modular::Residue& modular::Residue::operator*=(const Residue& rhs) {
+	montgomery = field->multiply(montgomery, rhs.montgomery);
+	return *this;
+}
+
+inline modular::Residue& modular::Residue::operator/=(const Residue& rhs) {
+	montgomery = field->multiply(montgomery, field->invert(rhs.montgomery));
+	return *this;
+}
+
+inline std::uint64_t modular::Field::add(std::uint64_t lhs, std::uint64_t rhs) const {
+	std::uint64_t sum = lhs + rhs;
+	return sum >= modulus ? sum - modulus : sum;
+}
+
+inline std::uint64_t modular::Field::subtract(std::uint64_t lhs, std::uint64_t rhs) const {
+	return lhs >= rhs ? lhs - rhs : lhs + (modulus - rhs);
+}
+
+inline std::uint64_t modular::Field::multiply(std::uint64_t lhs, std::uint64_t rhs) const {
+	std::uint64_t low;
+	std::uint64_t high = multiplyWide(lhs, rhs, low);
+	return reduce(high, low);
+}
+
+inline std::uint64_t modular::Field::toMontgomery(std::uint64_t value) const {
+	return multiply(value % modulus, rSquared);
+}
+
+inline std::uint64_t modular::Field::fromMontgomery(std::uint64_t value) const {
+	return reduce(0, value);
+}
+
+/**
+*	Montgomery reduction (REDC): divides a double word below prime * 2^64 by 2^64 modulo the prime. Adding
+*	m * prime, with m chosen to clear the low word, makes the division exact; the low words cancel and carry out
+*	exactly when the low word of the input is not zero. The quotient is below twice the prime.
+*
+*	@param high high word of the input
+*	@param low low word of the input
+*	@return input * 2^-64 mod prime, in [0, prime)
+*/
+inline std::uint64_t modular::Field::reduce(std::uint64_t high, std::uint64_t low) const {
+	std::uint64_t m = low * negatedInverse;
+	std::uint64_t productLow;
+	std::uint64_t productHigh = multiplyWide(m, modulus, productLow);
+	std::uint64_t result = high + productHigh + (low != 0 ? 1 : 0);
+	return result >= modulus ? result - modulus : result;
+}
+
+/**
+*	Maps a fixed width fraction into the field. Whole numbers skip the inversion, which costs as much as some thirty
+*	multiplications.
+*
+*	@param value the fraction; a denominator divisible by the prime marks this field unlucky
+*	@return numerator / denominator modulo the prime
+*/
+template <typename IntT>
+modular::Residue modular::Field::operator()(const BasicFraction<IntT>& value) const {
+	IntT numerator = value.getNumerator();
+	IntT denominator = value.getDenominator();
+	Residue top = fromWord(static_cast<std::uint64_t>(gcd::magnitude(numerator) % modulus), numerator < 0);
+	if (denominator == 1)
+		return top;
+	Residue bottom = fromWord(static_cast<std::uint64_t>(gcd::magnitude(denominator) % modulus), denominator < 0);
+	return quotient(top, bottom);
+}
+
+/**
+*	Evaluates an exact rational computation modulo as many primes as its answer needs and reconstructs the answer.
+*	The computation is called once per prime, concurrently, with the field to work in, and must return the
+*	residue of the same rational number for every prime; fields that met a division by zero are dropped. Primes are
+*	taken in batches of at least one per pool thread, growing with the primes gathered so far so that the
+*	reconstruction runs a logarithmic number of times. Once a candidate exists, the next batch is one prime per
+*	thread and the candidate is accepted if all of them agree with it, so beyond the primes the answer needs only
+*	the rest of the batch that crossed that bound and the confirming primes are paid for.
+*
+*	@param computation callable taking a const Field& and returning the Residue of the answer in that field
+*	@param pool thread pool running one prime per task
+*	@param maxPrimes number of primes after which evaluation gives up with std::runtime_error
+*	@return the answer in simplest form
+*/
+template <typename Computation>
+BigFraction modular::evaluate(Computation&& computation, ThreadPool& pool, std::size_t maxPrimes) {
+	Reconstructor reconstructor;
+	BigFraction candidate;
+	bool haveCandidate = false;
+	std::vector<std::uint64_t> primes;
+	std::vector<std::uint64_t> residues;
+	std::vector<char> lucky;
+
+	std::size_t first = 0;
+	while (first < maxPrimes) {
+		// A candidate only needs one prime per thread to confirm it; otherwise grow by an eighth of the primes so far
+		std::size_t batch = haveCandidate ? pool.size() : std::max<std::size_t>(pool.size(), (reconstructor.primes() + 7) / 8);
+		batch = std::min(std::max<std::size_t>(batch, 1), maxPrimes - first);
+		primes.resize(batch);
+		for (std::size_t i = 0; i < batch; ++i)
+			primes[i] = prime(first + i);
+		residues.assign(batch, 0);
+		lucky.assign(batch, 0);
+		pool.run(batch, [&](std::size_t task) {
+			Field field(primes[task]);
+			Residue result = computation(static_cast<const Field&>(field));
+			residues[task] = result.value();
+			lucky[task] = !field.unlucky();
+		});
+		first += batch;
+
+		bool confirmed = haveCandidate;
+		bool anyLucky = false;
+		for (std::size_t i = 0; i < batch; ++i) {
+			if (!lucky[i])
+				continue;
+			anyLucky = true;
+			if (confirmed && !Reconstructor::agrees(candidate, primes[i], residues[i]))
+				confirmed = false;
+			reconstructor.add(primes[i], residues[i]);
+		}
+		if (confirmed && anyLucky)
+			return candidate;
+		if (anyLucky)
+			haveCandidate = reconstructor.reconstruct(candidate);
+	}
+	throw std::runtime_error("modular evaluation needs more primes than allowed");
+}
+
+/**
+*	Evaluates an exact rational computation like evaluate() and converts the answer to a fixed width fraction.
+*
+*	@param computation callable taking a const Field& and returning the Residue of the answer in that field
+*	@param pool thread pool running one prime per task
+*	@param maxPrimes number of primes after which evaluation gives up with std::runtime_error
+*	@return the answer in simplest form
+*	@throws std::overflow_error if the answer does not fit IntT
+*/
+template <typename IntT, typename Computation>
+BasicFraction<IntT> modular::evaluateAs(Computation&& computation, ThreadPool& pool, std::size_t maxPrimes) {
+	BigFraction value = evaluate(std::forward<Computation>(computation), pool, maxPrimes);
+	if (!checked::fits<IntT>(value.getNumerator()) || !checked::fits<IntT>(value.getDenominator()))
+		throw std::overflow_error("modular result does not fit the integer type");
+	return BasicFraction<IntT>(static_cast<IntT>(value.getNumerator().toSmall()), static_cast<IntT>(value.getDenominator().toSmall()));
+}
@@ -0,0 +1,181 @@
+#pragma once
+/**
+* @file		Parallel.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Parallel exact sum, product and dot product over ranges of fractions. The range is cut into fixed size
+*  chunks accumulated on a ThreadPool, and the chunk results are combined pairwise as a tree. Chunk results of
+*  fixed width fractions are kept exact in BigFraction, so the answer is the same as the serial += loop whenever
+*  that loop does not overflow, whatever the thread count.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include "BigFraction.h"
+#include "CheckedFraction.h"
+#include "Fraction.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace parallel {
+
+	// Elements accumulated serially by one task
+	constexpr std::size_t kChunk = 2048;
+
+	/**
+	*	Type the partial results of a fraction type are kept in. Fixed width fractions accumulate exactly
+	*	in BigFraction and are narrowed once at the end, throwing std::overflow_error if the exact result does not
+	*	fit; other types accumulate in themselves.
+	*/
+	template <typename T> struct Accumulator {
+		using type = T;
+		static const T& widen(const T& value) { return value; }
+		static const T& narrow(const T& value) { return value; }
+	};
+
+	template <typename IntT> struct Accumulator<BasicFraction<IntT>> {
+		using type = BigFraction;
+		static BigFraction widen(const BasicFraction<IntT>& value) { return BigFraction(value); }
+		static BasicFraction<IntT> narrow(const BigFraction& value) {
+			if (!checked::fits<IntT>(value.getNumerator()) || !checked::fits<IntT>(value.getDenominator()))
+				throw std::overflow_error("parallel result does not fit the fraction type");
+			return BasicFraction<IntT>(static_cast<IntT>(value.getNumerator().toSmall()), static_cast<IntT>(value.getDenominator().toSmall()));
+		}
+	};
+
+	/**
+	*	Combines chunk results pairwise, level by level, so that neighbouring chunks meet first and the
+	*	intermediate denominators stay as small as the data allows. The shape only depends on the number of
+	*	chunks, never on the number of threads.
+	*
+	*	@param partials the chunk results, consumed in place
+	*	@param combine callable folding its second argument into its first
+	*	@param pool pool running the combinations of each level
+	*	@return the combined result (partials[0])
+	*/
+	template <typename Acc, typename Combine>
+	Acc combineTree(std::vector<Acc>& partials, Combine combine, ThreadPool& pool) {
+		for (std::size_t stride = 1; stride < partials.size(); stride *= 2) {
+			std::size_t pairs = (partials.size() - stride + 2 * stride - 1) / (2 * stride);
+			pool.run(pairs, [&](std::size_t pair) {
+				std::size_t left = pair * 2 * stride;
+				combine(partials[left], partials[left + stride]);
+			});
+		}
+		return partials[0];
+	}
+
+	/**
+	*	Accumulates a range in fixed size chunks on the pool and combines the chunk results as a tree.
+	*
+	*	@param count number of elements
+	*	@param identity result for an empty range
+	*	@param element callable returning the accumulator value of element i
+	*	@param combine callable folding its second argument into its first
+	*	@param pool pool to run on
+	*	@return the accumulated value
+	*/
+	template <typename Acc, typename Element, typename Combine>
+	Acc reduceChunks(std::size_t count, const Acc& identity, Element element, Combine combine, ThreadPool& pool) {
+		std::size_t chunks = (count + kChunk - 1) / kChunk;
+		if (chunks == 0)
+			return identity;
+
+		std::vector<Acc> partials(chunks, identity);
+		pool.run(chunks, [&](std::size_t chunk) {
+			std::size_t end = chunk * kChunk + kChunk < count ? chunk * kChunk + kChunk : count;
+			Acc& partial = partials[chunk];
+			for (std::size_t i = chunk * kChunk; i < end; ++i)
+				combine(partial, element(i));
+		});
+		return combineTree(partials, combine, pool);
+	}
+
+	/**
+	*	Sums a range of fractions on all threads of the pool.
+	*
+	*	@param first random access iterator to the first fraction
+	*	@param last random access iterator past the last fraction
+	*	@param pool pool to run on, the shared one by default
+	*	@return the sum, equal to the serial += loop when that does not overflow
+	*	@throws std::overflow_error if the exact sum does not fit the fraction type
+	*/
+	template <typename Iterator>
+	typename std::iterator_traits<Iterator>::value_type sum(Iterator first, Iterator last, ThreadPool& pool = ThreadPool::shared()) {
+		using Value = typename std::iterator_traits<Iterator>::value_type;
+		using Traits = Accumulator<Value>;
+		using Acc = typename Traits::type;
+		Acc result = reduceChunks(static_cast<std::size_t>(last - first), Acc(0),
+			[first](std::size_t i) { return Traits::widen(first[i]); },
+			[](Acc& lhs, const Acc& rhs) { lhs += rhs; }, pool);
+		return Traits::narrow(result);
+	}
+
+	/**
+	*	Multiplies a range of fractions on all threads of the pool.
+	*
+	*	@param first random access iterator to the first fraction
+	*	@param last random access iterator past the last fraction
+	*	@param pool pool to run on, the shared one by default
+	*	@return the product, equal to the serial *= loop when that does not overflow
+	*	@throws std::overflow_error if the exact product does not fit the fraction type
+	*/
+	template <typename Iterator>
+	typename std::iterator_traits<Iterator>::value_type product(Iterator first, Iterator last, ThreadPool& pool = ThreadPool::shared()) {
+		using Value = typename std::iterator_traits<Iterator>::value_type;
+		using Traits = Accumulator<Value>;
+		using Acc = typename Traits::type;
+		Acc result = reduceChunks(static_cast<std::size_t>(last - first), Acc(1),
+			[first](std::size_t i) { return Traits::widen(first[i]); },
+			[](Acc& lhs, const Acc& rhs) { lhs *= rhs; }, pool);
+		return Traits::narrow(result);
+	}
+
+	/**
+	*	Computes the dot product of two ranges of fractions on all threads of the pool. Each product is taken
+	*	in the fraction type itself, exactly as the serial loop sum += lhs[i] * rhs[i] does.
+	*
+	*	@param first random access iterator to the first fraction of the left range
+	*	@param last random access iterator past the last fraction of the left range
+	*	@param other random access iterator to the first fraction of the right range, at least as long
+	*	@param pool pool to run on, the shared one by default
+	*	@return the dot product, equal to the serial loop when its sum does not overflow
+	*	@throws std::overflow_error if the exact sum of the products does not fit the fraction type
+	*/
+	template <typename Iterator, typename OtherIterator>
+	typename std::iterator_traits<Iterator>::value_type dot(Iterator first, Iterator last, OtherIterator other, ThreadPool& pool = ThreadPool::shared()) {
+		using Value = typename std::iterator_traits<Iterator>::value_type;
+		using Traits = Accumulator<Value>;
+		using Acc = typename Traits::type;
+		Acc result = reduceChunks(static_cast<std::size_t>(last - first), Acc(0),
+			[first, other](std::size_t i) { return Traits::widen(Value(first[i] * other[i])); },
+			[](Acc& lhs, const Acc& rhs) { lhs += rhs; }, pool);
+		return Traits::narrow(result);
+	}
+}
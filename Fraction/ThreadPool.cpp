@@ -0,0 +1,146 @@
+/**
+* @file		ThreadPool.cpp
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Implements the worker thread pool used by the parallel fraction algorithms.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+#include "ThreadPool.h"
+
+/**
+*	Starts a pool in which the provided number of threads work on each run, counting the thread that calls run().
+*
+*	@param threads number of threads, including the caller (0 is treated as 1)
+*/
+ThreadPool::ThreadPool(unsigned threads) : job(nullptr), jobTasks(0), next(0), active(0), generation(0), stopping(false) {
+	for (unsigned i = 1; i < threads; ++i)
+		workers.emplace_back([this] { work(); });
+}
+
+/**
+*	Stops and joins every worker thread.
+*/
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+/**
+*	Returns the number of threads working on each run, including the caller.
+*
+*	@return the thread count
+*/
+unsigned ThreadPool::size() const {
+	return static_cast<unsigned>(workers.size()) + 1;
+}
+
+/**
+*	Runs task(0) to task(tasks - 1) on the pool and returns once all of them have finished.
+*	The calling thread takes part. Tasks must not call run() on the same pool.
+*	If a task throws, tasks not yet started are skipped, and the first exception is rethrown here
+*	once every thread has stopped using the task.
+*
+*	@param tasks number of tasks
+*	@param task callable receiving the index of the task to run
+*/
+void ThreadPool::run(std::size_t tasks, const std::function<void(std::size_t)>& task) {
+	std::lock_guard<std::mutex> runLock(runMutex);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job = &task;
+		jobTasks = tasks;
+		next.store(0, std::memory_order_relaxed);
+		active = workers.size();
+		++generation;
+	}
+	wake.notify_all();
+	drain();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return active == 0; });
+	job = nullptr;
+	std::exception_ptr error = failure;
+	failure = nullptr;
+	lock.unlock();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+/**
+*	Returns a pool with one thread per hardware thread, created on first use.
+*
+*	@return the shared pool
+*/
+ThreadPool& ThreadPool::shared() {
+	static ThreadPool pool;
+	return pool;
+}
+
+/**
+*	Body of every worker thread: waits for a new run, helps drain it, and reports back.
+*/
+void ThreadPool::work() {
+	std::uint64_t seen = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+			if (stopping)
+				return;
+			seen = generation;
+		}
+		drain();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--active == 0)
+				finished.notify_one();
+		}
+	}
+}
+
+/**
+*	Takes task indices from the shared counter and runs them until none are left. A throwing task is recorded
+*	rather than let out of a worker thread, and the counter is moved past the end so the other threads stop.
+*/
+void ThreadPool::drain() {
+	for (std::size_t index = next.fetch_add(1); index < jobTasks; index = next.fetch_add(1)) {
+		try {
+			(*job)(index);
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!failure)
+				failure = std::current_exception();
+			next.store(jobTasks);
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+/**
+* @file		ThreadPool.h
+* @author	Joseph Roy-Plommer
+* @date		2026-10-17
+* @version	<1.0>
+*
+* @section Academic Integrity
+*  I certify that this work is solely my own and complies with
+*  NBCC Academic Integrity Policy (policy 1111)
+*
+* @section DESCRIPTION
+*  Fixed-size pool of worker threads for the parallel fraction algorithms. A run hands out task indices
+*  from a shared atomic counter, so threads that finish early keep taking work from the ones that are behind.
+*
+* @section LICENSE
+*  <any necessary attributions>
+*
+*  Copyright 2019
+*  Permission to use, copy, modify, and/or distribute this software for
+*  any purpose with or without fee is hereby granted, provided that the
+*  above copyright notice and this permission notice appear in all copies.
+*
+*  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+*  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+*  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+*  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+*  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+*  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+*/
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+
+public:
+	explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency());
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	unsigned size() const;
+	void run(std::size_t tasks, const std::function<void(std::size_t)>& task);
+
+	static ThreadPool& shared();
+
+private:
+	std::vector<std::thread> workers;
+
+	// Serializes callers of run(), so one job is in flight at a time
+	std::mutex runMutex;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable finished;
+	const std::function<void(std::size_t)>* job;
+	std::size_t jobTasks;
+	std::atomic<std::size_t> next;
+	std::size_t active;
+	std::uint64_t generation;
+	bool stopping;
+	// First exception thrown by a task of the current run, rethrown by run()
+	std::exception_ptr failure;
+
+	void work();
+	void drain();
+
+};
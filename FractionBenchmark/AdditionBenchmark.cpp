@@ -0,0 +1,89 @@
+//
+// AdditionBenchmark.cpp
+// operator+ and operator- on denominators that share many factors (media time bases, currency scales), on equal
+// denominators, and with integer operands.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kPairs = 4096;
+
+	template <typename FractionT>
+	std::vector<FractionT> operandsOver(const std::vector<int>& denominators, unsigned seed) {
+		using IntT = typename FractionT::Integer;
+		std::mt19937 rng(seed + 1261);
+		std::uniform_int_distribution<int> numerators(-100000, 100000);
+		std::uniform_int_distribution<std::size_t> pick(0, denominators.size() - 1);
+
+		std::vector<FractionT> fractions;
+		fractions.reserve(kPairs);
+		for (std::size_t i = 0; i < kPairs; ++i)
+			fractions.emplace_back(static_cast<IntT>(numerators(rng)), static_cast<IntT>(denominators[pick(rng)]));
+		return fractions;
+	}
+
+	// Frame durations and sample periods: 1/24, 1001/30000, 1/44100, 1/90000 ...
+	const std::vector<int> kTimeBases = { 24, 25, 30, 50, 60, 1000, 30000, 60000, 44100, 48000, 90000 };
+	// Cents, mills and basis points
+	const std::vector<int> kCurrencyScales = { 100, 1000, 10000, 400, 250 };
+
+	template <typename FractionT, typename Operation>
+	void runPairwise(benchmark::State& state, const std::vector<FractionT>& lhs, const std::vector<FractionT>& rhs, Operation operation) {
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kPairs; ++i)
+				benchmark::DoNotOptimize(operation(lhs[i], rhs[i]));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kPairs));
+	}
+
+	template <typename FractionT>
+	void BM_AddTimeBases(benchmark::State& state) {
+		runPairwise(state, operandsOver<FractionT>(kTimeBases, 0), operandsOver<FractionT>(kTimeBases, 1),
+			[](const FractionT& a, const FractionT& b) { return a + b; });
+	}
+	BENCHMARK_TEMPLATE(BM_AddTimeBases, Fraction);
+	BENCHMARK_TEMPLATE(BM_AddTimeBases, Fraction64);
+
+	template <typename FractionT>
+	void BM_SubtractCurrency(benchmark::State& state) {
+		runPairwise(state, operandsOver<FractionT>(kCurrencyScales, 0), operandsOver<FractionT>(kCurrencyScales, 1),
+			[](const FractionT& a, const FractionT& b) { return a - b; });
+	}
+	BENCHMARK_TEMPLATE(BM_SubtractCurrency, Fraction);
+	BENCHMARK_TEMPLATE(BM_SubtractCurrency, Fraction64);
+
+	template <typename FractionT>
+	void BM_AddSameDenominator(benchmark::State& state) {
+		runPairwise(state, operandsOver<FractionT>({ 90000 }, 0), operandsOver<FractionT>({ 90000 }, 1),
+			[](const FractionT& a, const FractionT& b) { return a + b; });
+	}
+	BENCHMARK_TEMPLATE(BM_AddSameDenominator, Fraction);
+	BENCHMARK_TEMPLATE(BM_AddSameDenominator, Fraction64);
+
+	template <typename FractionT>
+	void BM_AddInteger(benchmark::State& state) {
+		runPairwise(state, operandsOver<FractionT>(kTimeBases, 0), operandsOver<FractionT>({ 1 }, 1),
+			[](const FractionT& a, const FractionT& b) { return a + b.getNumerator(); });
+	}
+	BENCHMARK_TEMPLATE(BM_AddInteger, Fraction);
+	BENCHMARK_TEMPLATE(BM_AddInteger, Fraction64);
+
+	// Running total of timestamps, the shape of a media timeline
+	template <typename FractionT>
+	void BM_AccumulateTimeBases(benchmark::State& state) {
+		auto durations = operandsOver<FractionT>(kTimeBases, 2);
+		for (auto _ : state) {
+			FractionT total(0);
+			for (const FractionT& duration : durations)
+				total += duration;
+			benchmark::DoNotOptimize(total);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kPairs));
+	}
+	BENCHMARK_TEMPLATE(BM_AccumulateTimeBases, Fraction64);
+}
@@ -0,0 +1,116 @@
+//
+// AllocationBenchmark.cpp
+// Heap allocations per expression for BigFraction values too large to be held inline. Replaces the global
+// operator new of the benchmark executable with a counting one; the count is reported as allocs_per_item.
+//
+
+#include "benchmark/benchmark.h"
+#include "BigFraction.h"
+#include <atomic>
+#include <climits>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+namespace {
+
+	std::atomic<std::size_t> allocationCount(0);
+
+}
+
+// GCC pairs the malloc below with the replaced operator new and flags the free as mismatched
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size != 0 ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+namespace {
+
+	constexpr std::size_t kCount = 512;
+
+	// Fractions with numerators and denominators of about 120 bits
+	std::vector<BigFraction> largeOperands(unsigned seed) {
+		std::mt19937_64 rng(seed + 1261);
+		std::vector<BigFraction> fractions;
+		fractions.reserve(kCount);
+		for (std::size_t i = 0; i < kCount; ++i) {
+			BigInteger num = BigInteger(static_cast<long long>(rng() >> 4)) * static_cast<long long>(rng() >> 4);
+			BigInteger den = BigInteger(static_cast<long long>(rng() >> 4)) * static_cast<long long>(rng() >> 4);
+			fractions.emplace_back(rng() & 1 ? -num : num, den + 1);
+		}
+		return fractions;
+	}
+
+	void reportAllocations(benchmark::State& state, std::size_t before, std::size_t items) {
+		double count = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - before);
+		state.counters["allocs_per_item"] = count / static_cast<double>(state.iterations() * items);
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(items));
+	}
+
+	void BM_BigSumOfProducts(benchmark::State& state) {
+		auto a = largeOperands(0), b = largeOperands(1), c = largeOperands(2);
+		std::size_t before = allocationCount.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(a[i] * b[i] + c[i] * a[i] - b[i]);
+		}
+		reportAllocations(state, before, kCount);
+	}
+	BENCHMARK(BM_BigSumOfProducts);
+
+	void BM_BigScale(benchmark::State& state) {
+		auto a = largeOperands(0);
+		std::size_t before = allocationCount.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(a[i] * 3 + 1);
+		}
+		reportAllocations(state, before, kCount);
+	}
+	BENCHMARK(BM_BigScale);
+
+	// Running sums of the harmonic series, whose denominators outgrow a long long after a few dozen terms
+	void BM_BigAccumulate(benchmark::State& state) {
+		constexpr int kTerms = 120;
+		std::size_t before = allocationCount.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			BigFraction sum(0);
+			for (int i = 1; i <= kTerms; ++i)
+				sum += BigFraction(1, i);
+			benchmark::DoNotOptimize(sum);
+		}
+		reportAllocations(state, before, kTerms);
+	}
+	BENCHMARK(BM_BigAccumulate);
+
+	void BM_BigCompoundChain(benchmark::State& state) {
+		auto a = largeOperands(0), b = largeOperands(1);
+		std::size_t before = allocationCount.load(std::memory_order_relaxed);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i) {
+				BigFraction value = a[i];
+				value *= b[i];
+				value -= a[i];
+				value += 1;
+				benchmark::DoNotOptimize(value);
+			}
+		}
+		reportAllocations(state, before, kCount);
+	}
+	BENCHMARK(BM_BigCompoundChain);
+}
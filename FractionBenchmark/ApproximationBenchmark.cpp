@@ -0,0 +1,86 @@
+//
+// ApproximationBenchmark.cpp
+// Converting sensor-style doubles to fractions with a bounded denominator: the hand written search over every
+// denominator against Fraction::fromDouble(), its array version, and limitDenominator() on exact fractions.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionArray.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kValues = 1024;
+
+	std::vector<double> readings() {
+		std::mt19937_64 rng(1261);
+		std::normal_distribution<double> values(20.0, 5.0);
+		std::vector<double> result(kValues);
+		for (double& value : result)
+			value = values(rng);
+		return result;
+	}
+
+	// The search the ingestion code used: try every denominator and keep the closest, in double precision
+	Fraction64 searchClosest(double value, std::int64_t maxDenominator) {
+		Fraction64 best(static_cast<std::int64_t>(std::llround(value)));
+		double bestError = std::fabs(value - std::round(value));
+		for (std::int64_t q = 2; q <= maxDenominator && bestError > 0; ++q) {
+			double p = std::round(value * static_cast<double>(q));
+			double error = std::fabs(value - p / static_cast<double>(q));
+			if (error < bestError) {
+				bestError = error;
+				best = Fraction64(static_cast<std::int64_t>(p), q);
+			}
+		}
+		return best;
+	}
+
+	void BM_SearchClosest(benchmark::State& state) {
+		auto values = readings();
+		std::int64_t maxDenominator = state.range(0);
+		for (auto _ : state) {
+			for (double value : values)
+				benchmark::DoNotOptimize(searchClosest(value, maxDenominator));
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_SearchClosest)->RangeMultiplier(100)->Range(100, 10000);
+
+	void BM_FromDouble(benchmark::State& state) {
+		auto values = readings();
+		std::int64_t maxDenominator = state.range(0);
+		for (auto _ : state) {
+			for (double value : values)
+				benchmark::DoNotOptimize(Fraction64::fromDouble(value, maxDenominator));
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_FromDouble)->RangeMultiplier(100)->Range(100, 1000000);
+
+#ifdef __SIZEOF_INT128__
+	void BM_FromDoublesBatch(benchmark::State& state) {
+		auto values = readings();
+		std::int64_t maxDenominator = state.range(0);
+		for (auto _ : state)
+			benchmark::DoNotOptimize(FractionArray64::fromDoubles(values.data(), values.size(), maxDenominator));
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_FromDoublesBatch)->RangeMultiplier(100)->Range(100, 1000000);
+
+	void BM_LimitDenominator(benchmark::State& state) {
+		auto values = readings();
+		FractionArray64 exact = FractionArray64::fromDoubles(values.data(), values.size());
+		FractionArray64 out;
+		std::int64_t maxDenominator = state.range(0);
+		for (auto _ : state) {
+			FractionArray64::limitDenominator(exact, maxDenominator, out);
+			benchmark::DoNotOptimize(out.numerators());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_LimitDenominator)->RangeMultiplier(100)->Range(100, 1000000);
+#endif
+}
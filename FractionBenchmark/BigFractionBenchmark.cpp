@@ -0,0 +1,51 @@
+//
+// BigFractionBenchmark.cpp
+// BigFraction against Fraction on mostly-small data, where the inline small-value path should keep them close.
+//
+
+#include "benchmark/benchmark.h"
+#include "BigFraction.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	template <typename FractionT>
+	std::vector<FractionT> makeSmall(std::size_t count) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-1000, 1000);
+		std::uniform_int_distribution<int> denominators(1, 1000);
+
+		std::vector<FractionT> fractions;
+		fractions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			fractions.emplace_back(numerators(rng), denominators(rng));
+		return fractions;
+	}
+
+	template <typename FractionT>
+	void BM_MultiplyAdd(benchmark::State& state) {
+		auto lhs = makeSmall<FractionT>(1024);
+		auto rhs = makeSmall<FractionT>(1024);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < lhs.size(); ++i)
+				benchmark::DoNotOptimize(lhs[i] * rhs[i] + rhs[i]);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lhs.size()));
+	}
+	BENCHMARK_TEMPLATE(BM_MultiplyAdd, Fraction);
+	BENCHMARK_TEMPLATE(BM_MultiplyAdd, Fraction64);
+	BENCHMARK_TEMPLATE(BM_MultiplyAdd, BigFraction);
+
+	// Harmonic sums outgrow every fixed width type, which is what BigFraction is for
+	void BM_HarmonicSum(benchmark::State& state) {
+		for (auto _ : state) {
+			BigFraction sum(0);
+			for (long long i = 1; i <= state.range(0); ++i)
+				sum += BigFraction(1, i);
+			benchmark::DoNotOptimize(sum);
+		}
+	}
+	BENCHMARK(BM_HarmonicSum)->Arg(32)->Arg(256);
+}
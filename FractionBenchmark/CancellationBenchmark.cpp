@@ -0,0 +1,109 @@
+//
+// CancellationBenchmark.cpp
+// Latency of operator* and operator/ on the operands matrix code produces: entries sharing small factors, scaling
+// rows by integers, and dense products of Hilbert matrices, whose entries 1/(i+j+1) cancel heavily.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kPairs = 4096;
+
+	// Numerators and denominators built from small primes, so that operands share factors like pivots and entries do
+	template <typename FractionT>
+	std::vector<FractionT> smoothOperands(unsigned seed) {
+		using IntT = typename FractionT::Integer;
+		const IntT primes[] = { 2, 3, 5, 7, 11, 13 };
+		std::mt19937 rng(seed + 1261);
+		std::uniform_int_distribution<int> pick(0, 5);
+		std::uniform_int_distribution<int> factors(1, sizeof(IntT) == 4 ? 5 : 10);
+
+		std::vector<FractionT> fractions;
+		fractions.reserve(kPairs);
+		for (std::size_t i = 0; i < kPairs; ++i) {
+			IntT num = rng() & 1 ? 1 : -1;
+			IntT den = 1;
+			for (int f = factors(rng); f > 0; --f)
+				num *= primes[pick(rng)];
+			for (int f = factors(rng); f > 0; --f)
+				den *= primes[pick(rng)];
+			fractions.emplace_back(num, den);
+		}
+		return fractions;
+	}
+
+	template <typename FractionT>
+	void BM_CancelMultiply(benchmark::State& state) {
+		auto lhs = smoothOperands<FractionT>(0);
+		auto rhs = smoothOperands<FractionT>(1);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kPairs; ++i)
+				benchmark::DoNotOptimize(lhs[i] * rhs[i]);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kPairs));
+	}
+	BENCHMARK_TEMPLATE(BM_CancelMultiply, Fraction);
+	BENCHMARK_TEMPLATE(BM_CancelMultiply, Fraction64);
+
+	template <typename FractionT>
+	void BM_CancelDivide(benchmark::State& state) {
+		auto lhs = smoothOperands<FractionT>(0);
+		auto rhs = smoothOperands<FractionT>(1);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kPairs; ++i)
+				benchmark::DoNotOptimize(lhs[i] / rhs[i]);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kPairs));
+	}
+	BENCHMARK_TEMPLATE(BM_CancelDivide, Fraction);
+	BENCHMARK_TEMPLATE(BM_CancelDivide, Fraction64);
+
+	// Row scaling: multiply every entry by the pivot's denominator, then divide by another row's pivot numerator
+	template <typename FractionT>
+	void BM_CancelScaleRow(benchmark::State& state) {
+		using IntT = typename FractionT::Integer;
+		auto row = smoothOperands<FractionT>(0);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kPairs; ++i) {
+				FractionT entry = row[i];
+				entry *= static_cast<IntT>(30);
+				entry /= static_cast<IntT>(42);
+				benchmark::DoNotOptimize(entry);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kPairs));
+	}
+	BENCHMARK_TEMPLATE(BM_CancelScaleRow, Fraction);
+	BENCHMARK_TEMPLATE(BM_CancelScaleRow, Fraction64);
+
+	// C = H * H for the n x n Hilbert matrix; the largest size whose entries still fit IntT
+	template <typename FractionT>
+	void BM_CancelHilbertProduct(benchmark::State& state) {
+		using IntT = typename FractionT::Integer;
+		const int n = static_cast<int>(state.range(0));
+		std::vector<FractionT> hilbert;
+		for (int i = 0; i < n; ++i) {
+			for (int j = 0; j < n; ++j)
+				hilbert.emplace_back(IntT(1), static_cast<IntT>(i + j + 1));
+		}
+		std::vector<FractionT> product(hilbert.size());
+		for (auto _ : state) {
+			for (int i = 0; i < n; ++i) {
+				for (int j = 0; j < n; ++j) {
+					FractionT sum(0);
+					for (int k = 0; k < n; ++k)
+						sum += hilbert[i * n + k] * hilbert[k * n + j];
+					product[i * n + j] = sum;
+				}
+			}
+			benchmark::DoNotOptimize(product.data());
+		}
+		state.SetItemsProcessed(state.iterations() * n * n * n);
+	}
+	BENCHMARK_TEMPLATE(BM_CancelHilbertProduct, Fraction)->Arg(6);
+	BENCHMARK_TEMPLATE(BM_CancelHilbertProduct, Fraction64)->Arg(6)->Arg(8);
+}
@@ -0,0 +1,92 @@
+//
+// CheckedFractionBenchmark.cpp
+// Cost of overflow checking on results that fit: Fraction's widened arithmetic against CheckedFraction's
+// cross-reduced, overflow checked arithmetic in int, and the slow path taken when a result really overflows.
+//
+
+#include "benchmark/benchmark.h"
+#include "CheckedFraction.h"
+#include "Fraction.h"
+#include <climits>
+#include <random>
+#include <vector>
+
+namespace {
+
+	template <typename FractionT>
+	std::vector<FractionT> makeOperands(std::size_t count, int maxValue) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-maxValue, maxValue);
+		std::uniform_int_distribution<int> denominators(1, maxValue);
+
+		std::vector<FractionT> fractions;
+		fractions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			int numerator = numerators(rng);
+			fractions.emplace_back(numerator == 0 ? 1 : numerator, denominators(rng));
+		}
+		return fractions;
+	}
+
+	// Pairwise a[i] op b[i] over operands small enough that no result overflows
+	template <typename FractionT, typename Operation>
+	void runPairwise(benchmark::State& state, Operation operation) {
+		auto lhs = makeOperands<FractionT>(4096, 9999);
+		auto rhs = makeOperands<FractionT>(4097, 9999);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < lhs.size(); ++i)
+				benchmark::DoNotOptimize(operation(lhs[i], rhs[i + 1]));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lhs.size()));
+	}
+
+	template <typename FractionT>
+	void BM_CheckedAdd(benchmark::State& state) {
+		runPairwise<FractionT>(state, [](const FractionT& a, const FractionT& b) { return a + b; });
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedAdd, Fraction);
+	BENCHMARK_TEMPLATE(BM_CheckedAdd, CheckedFraction);
+	BENCHMARK_TEMPLATE(BM_CheckedAdd, Fraction64);
+	BENCHMARK_TEMPLATE(BM_CheckedAdd, CheckedFraction64);
+
+	template <typename FractionT>
+	void BM_CheckedSubtract(benchmark::State& state) {
+		runPairwise<FractionT>(state, [](const FractionT& a, const FractionT& b) { return a - b; });
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedSubtract, Fraction);
+	BENCHMARK_TEMPLATE(BM_CheckedSubtract, CheckedFraction);
+
+	template <typename FractionT>
+	void BM_CheckedMultiply(benchmark::State& state) {
+		runPairwise<FractionT>(state, [](const FractionT& a, const FractionT& b) { return a * b; });
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedMultiply, Fraction);
+	BENCHMARK_TEMPLATE(BM_CheckedMultiply, CheckedFraction);
+	BENCHMARK_TEMPLATE(BM_CheckedMultiply, Fraction64);
+	BENCHMARK_TEMPLATE(BM_CheckedMultiply, CheckedFraction64);
+
+	template <typename FractionT>
+	void BM_CheckedDivide(benchmark::State& state) {
+		runPairwise<FractionT>(state, [](const FractionT& a, const FractionT& b) { return a / b; });
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedDivide, Fraction);
+	BENCHMARK_TEMPLATE(BM_CheckedDivide, CheckedFraction);
+
+	template <typename FractionT>
+	void BM_CheckedMultiplyInt(benchmark::State& state) {
+		runPairwise<FractionT>(state, [](const FractionT& a, const FractionT& b) { return a * b.getDenominator(); });
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedMultiplyInt, Fraction);
+	BENCHMARK_TEMPLATE(BM_CheckedMultiplyInt, CheckedFraction);
+
+	// Every product overflows int, so each one takes the BigFraction slow path and goes to the policy
+	template <typename FractionT>
+	void BM_CheckedOverflow(benchmark::State& state) {
+		FractionT lhs(INT_MAX, 2);
+		FractionT rhs(INT_MAX - 2, 3);
+		for (auto _ : state)
+			benchmark::DoNotOptimize(lhs * rhs);
+	}
+	BENCHMARK_TEMPLATE(BM_CheckedOverflow, SaturatingFraction);
+	BENCHMARK_TEMPLATE(BM_CheckedOverflow, PromotingFraction);
+}
@@ -0,0 +1,50 @@
+//
+// CompareBenchmark.cpp
+// Sorting and binary searching fractions, which is dominated by the three-way comparison core.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+	std::vector<Fraction> makeFractions(std::size_t count, int maxDenominator) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-1000000, 1000000);
+		std::uniform_int_distribution<int> denominators(1, maxDenominator);
+
+		std::vector<Fraction> fractions;
+		fractions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			fractions.emplace_back(numerators(rng), denominators(rng));
+		return fractions;
+	}
+
+	void BM_Sort(benchmark::State& state) {
+		auto fractions = makeFractions(static_cast<std::size_t>(state.range(0)), static_cast<int>(state.range(1)));
+		for (auto _ : state) {
+			state.PauseTiming();
+			auto copy = fractions;
+			state.ResumeTiming();
+			std::sort(copy.begin(), copy.end());
+			benchmark::DoNotOptimize(copy.data());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_Sort)->Args({ 1 << 16, 100 })->Args({ 1 << 16, 1000000 });
+
+	void BM_LowerBound(benchmark::State& state) {
+		auto fractions = makeFractions(1 << 16, 1000000);
+		auto probes = makeFractions(1024, 1000000);
+		std::sort(fractions.begin(), fractions.end());
+		for (auto _ : state) {
+			for (const Fraction& probe : probes)
+				benchmark::DoNotOptimize(std::lower_bound(fractions.begin(), fractions.end(), probe));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(probes.size()));
+	}
+	BENCHMARK(BM_LowerBound);
+}
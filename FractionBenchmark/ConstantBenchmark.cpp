@@ -0,0 +1,65 @@
+//
+// ConstantBenchmark.cpp
+// Cost of fraction constants written inline in hot loops: Fraction(3, 4) and 3_r / 4 should fold at compile time,
+// leaving only the arithmetic on the variable operand.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+using namespace fraction_literals;
+
+namespace {
+
+	constexpr std::size_t kCount = 4096;
+
+	template <typename FractionT>
+	std::vector<FractionT> operands() {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-1000, 1000);
+		std::uniform_int_distribution<int> denominators(1, 1000);
+		std::vector<FractionT> fractions;
+		fractions.reserve(kCount);
+		for (std::size_t i = 0; i < kCount; ++i)
+			fractions.emplace_back(numerators(rng), denominators(rng));
+		return fractions;
+	}
+
+	// Folding a constant expression that involves no variable at all
+	template <typename FractionT>
+	void BM_ConstantExpression(benchmark::State& state) {
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(FractionT(1, 3) + FractionT(1, 6) * FractionT(3, 4));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK_TEMPLATE(BM_ConstantExpression, Fraction);
+	BENCHMARK_TEMPLATE(BM_ConstantExpression, Fraction64);
+
+	// Scaling by a constant built in the loop body
+	template <typename FractionT>
+	void BM_ScaleByConstant(benchmark::State& state) {
+		auto values = operands<FractionT>();
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(values[i] * FractionT(3, 4) + FractionT(1, 8));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK_TEMPLATE(BM_ScaleByConstant, Fraction);
+	BENCHMARK_TEMPLATE(BM_ScaleByConstant, Fraction64);
+
+	// The same loop written with fraction literals
+	void BM_ScaleByLiteral(benchmark::State& state) {
+		auto values = operands<Fraction>();
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(values[i] * (3_r / 4) + 1_r / 8);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_ScaleByLiteral);
+}
@@ -0,0 +1,114 @@
+//
+// ConversionBenchmark.cpp
+// Numeric conversion for reporting: correctly rounded toDouble() against the lossy numerator / (1.0 * denominator),
+// on fractions whose parts fit a double and on full 64-bit ones, and integer floor / roundHalfEven against the
+// floating point versions, one at a time and through the array kernels.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionArray.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// FractionArray64 needs a 128-bit type for its blocked kernels
+#ifdef __SIZEOF_INT128__
+namespace {
+
+	constexpr std::size_t kValues = 4096;
+
+	// Fractions with parts of up to the provided number of bits
+	FractionArray64 randomFractions(int bits) {
+		std::mt19937_64 rng(1261);
+		std::uniform_int_distribution<std::int64_t> numerators(-(std::int64_t(1) << (bits - 1)), std::int64_t(1) << (bits - 1));
+		std::uniform_int_distribution<std::int64_t> denominators(1, std::int64_t(1) << (bits - 1));
+		FractionArray64 result;
+		for (std::size_t i = 0; i < kValues; ++i)
+			result.push_back(Fraction64(numerators(rng), denominators(rng)));
+		return result;
+	}
+
+	void BM_ToDoubleLossy(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<double> out(kValues);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kValues; ++i)
+				out[i] = values.numerators()[i] / (1.0 * values.denominators()[i]);
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_ToDoubleLossy)->Arg(40)->Arg(63);
+
+	void BM_ToDouble(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<double> out(kValues);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kValues; ++i)
+				out[i] = values[i].toDouble();
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_ToDouble)->Arg(40)->Arg(63);
+
+	void BM_ToDoublesBatch(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<double> out(kValues);
+		for (auto _ : state) {
+			FractionArray64::toDoubles(values, out.data());
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_ToDoublesBatch)->Arg(40)->Arg(63);
+
+	void BM_ToDoublesBatch32(benchmark::State& state) {
+		auto wide = randomFractions(31);
+		FractionArray values;
+		for (std::size_t i = 0; i < kValues; ++i)
+			values.push_back(Fraction(static_cast<int>(wide[i].getNumerator()), static_cast<int>(wide[i].getDenominator())));
+		std::vector<double> out(kValues);
+		for (auto _ : state) {
+			FractionArray::toDoubles(values, out.data());
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_ToDoublesBatch32);
+
+	void BM_FloorFloatingPoint(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<std::int64_t> out(kValues);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kValues; ++i)
+				out[i] = static_cast<std::int64_t>(std::floor(values.numerators()[i] / (1.0 * values.denominators()[i])));
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_FloorFloatingPoint)->Arg(40)->Arg(63);
+
+	void BM_FloorBatch(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<std::int64_t> out(kValues);
+		for (auto _ : state) {
+			FractionArray64::floor(values, out.data());
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_FloorBatch)->Arg(40)->Arg(63);
+
+	void BM_RoundHalfEvenBatch(benchmark::State& state) {
+		auto values = randomFractions(static_cast<int>(state.range(0)));
+		std::vector<std::int64_t> out(kValues);
+		for (auto _ : state) {
+			FractionArray64::roundHalfEven(values, out.data());
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kValues);
+	}
+	BENCHMARK(BM_RoundHalfEvenBatch)->Arg(40)->Arg(63);
+}
+#endif
@@ -0,0 +1,76 @@
+//
+// CountersBenchmark.cpp
+// Typical fraction workloads, reporting what they cost in reductions, gcd iterations and temporaries per item
+// when the library is built with FRACTION_COUNTERS=1. Built without it, the timings show the uninstrumented code.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionCounters.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kCount = 1024;
+
+	std::vector<Fraction64> operands(unsigned seed) {
+		std::mt19937 rng(seed + 1261);
+		std::uniform_int_distribution<int> values(1, 1 << 20);
+		std::vector<Fraction64> fractions;
+		fractions.reserve(kCount);
+		for (std::size_t i = 0; i < kCount; ++i)
+			fractions.emplace_back(values(rng) - (1 << 19), values(rng));
+		return fractions;
+	}
+
+	void reportCounts(benchmark::State& state, const counters::Snapshot& before, std::size_t items) {
+		if (counters::kEnabled) {
+			counters::Snapshot counts = counters::snapshot() - before;
+			double total = static_cast<double>(state.iterations() * items);
+			state.counters["constructions"] = static_cast<double>(counts[counters::Counter::Construction]) / total;
+			state.counters["reduces"] = static_cast<double>(counts[counters::Counter::Reduce]) / total;
+			state.counters["gcds"] = static_cast<double>(counts[counters::Counter::Gcd]) / total;
+			state.counters["gcd_iterations"] = static_cast<double>(counts[counters::Counter::GcdIteration]) / total;
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(items));
+	}
+
+	void BM_CountedSumOfProducts(benchmark::State& state) {
+		auto a = operands(0), b = operands(1), c = operands(2);
+		counters::Snapshot before = counters::snapshot();
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(a[i] * b[i] + c[i] * a[i] - b[i]);
+		}
+		reportCounts(state, before, kCount);
+	}
+	BENCHMARK(BM_CountedSumOfProducts);
+
+	void BM_CountedCompare(benchmark::State& state) {
+		auto a = operands(0), b = operands(1);
+		counters::Snapshot before = counters::snapshot();
+		for (auto _ : state) {
+			std::size_t less = 0;
+			for (std::size_t i = 0; i < kCount; ++i)
+				less += a[i] < b[i];
+			benchmark::DoNotOptimize(less);
+		}
+		reportCounts(state, before, kCount);
+	}
+	BENCHMARK(BM_CountedCompare);
+
+	// Running sums of the harmonic series, whose denominators grow with every term
+	void BM_CountedAccumulate(benchmark::State& state) {
+		constexpr int kTerms = 40;
+		counters::Snapshot before = counters::snapshot();
+		for (auto _ : state) {
+			Fraction64 sum(0);
+			for (int i = 1; i <= kTerms; ++i)
+				sum += Fraction64(1, i);
+			benchmark::DoNotOptimize(sum);
+		}
+		reportCounts(state, before, kTerms);
+	}
+	BENCHMARK(BM_CountedAccumulate);
+}
@@ -0,0 +1,92 @@
+//
+// ExpressionBenchmark.cpp
+// Whole expressions evaluated by the ordinary operators, which reduce every temporary, against the fused
+// expression templates, which reduce once. Pricing data is in cents and basis points; the rest is random.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionExpression.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kCount = 1024;
+
+	struct Quote {
+		Fraction64 price, quantity, rate, fee, discount, units;
+	};
+
+	std::vector<Quote> quotes() {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> cents(1, 99999), basisPoints(0, 2500), counts(1, 500);
+		std::vector<Quote> result(kCount);
+		for (Quote& quote : result) {
+			quote.price = Fraction64(cents(rng), 100);
+			quote.quantity = Fraction64(counts(rng));
+			quote.rate = Fraction64(basisPoints(rng), 10000);
+			quote.fee = Fraction64(cents(rng) % 1000, 100);
+			quote.discount = Fraction64(cents(rng) % 5000, 100);
+			quote.units = Fraction64(counts(rng));
+		}
+		return result;
+	}
+
+	template <typename IntT>
+	std::vector<BasicFraction<IntT>> operands(unsigned seed, int bits) {
+		std::mt19937_64 rng(seed + 1261);
+		std::uniform_int_distribution<long long> values(1, (1LL << bits) - 1);
+		std::vector<BasicFraction<IntT>> fractions;
+		fractions.reserve(kCount);
+		for (std::size_t i = 0; i < kCount; ++i)
+			fractions.emplace_back(static_cast<IntT>(rng() & 1 ? -values(rng) : values(rng)), static_cast<IntT>(values(rng)));
+		return fractions;
+	}
+
+	void BM_PricingStepwise(benchmark::State& state) {
+		auto data = quotes();
+		for (auto _ : state) {
+			for (const Quote& q : data)
+				benchmark::DoNotOptimize(q.price * q.quantity * (1 - q.rate) + q.fee - q.discount / q.units);
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_PricingStepwise);
+
+	void BM_PricingFused(benchmark::State& state) {
+		auto data = quotes();
+		for (auto _ : state) {
+			for (const Quote& q : data)
+				benchmark::DoNotOptimize(fused::evaluate(fused::fuse(q.price) * q.quantity * (1 - fused::fuse(q.rate)) + q.fee - q.discount / q.units));
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_PricingFused);
+
+	// a*b + c*a - b/c over random operands of the given number of bits, small enough that the exact result fits
+	template <typename IntT>
+	void BM_SumOfProductsStepwise(benchmark::State& state) {
+		int bits = static_cast<int>(state.range(0));
+		auto a = operands<IntT>(0, bits), b = operands<IntT>(1, bits), c = operands<IntT>(2, bits);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(a[i] * b[i] + c[i] * a[i] - b[i] / c[i]);
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK_TEMPLATE(BM_SumOfProductsStepwise, int)->Arg(4)->Arg(7);
+	BENCHMARK_TEMPLATE(BM_SumOfProductsStepwise, long long)->Arg(7)->Arg(10);
+
+	template <typename IntT>
+	void BM_SumOfProductsFused(benchmark::State& state) {
+		int bits = static_cast<int>(state.range(0));
+		auto a = operands<IntT>(0, bits), b = operands<IntT>(1, bits), c = operands<IntT>(2, bits);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kCount; ++i)
+				benchmark::DoNotOptimize(fused::evaluate(fused::fuse(a[i]) * b[i] + c[i] * a[i] - b[i] / c[i]));
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK_TEMPLATE(BM_SumOfProductsFused, int)->Arg(4)->Arg(7);
+	BENCHMARK_TEMPLATE(BM_SumOfProductsFused, long long)->Arg(7)->Arg(10);
+}
@@ -0,0 +1,120 @@
+//
+// FixedFractionBenchmark.cpp
+// Ledger-style workloads over amounts in cents and in ticks of 1/2^20: running sums, balance checks and
+// netting, with the general fraction against the fixed denominator fraction holding the same values.
+//
+
+#include "benchmark/benchmark.h"
+#include "FixedFraction.h"
+#include "Fraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kPostings = 1 << 16;
+	constexpr std::int64_t kTick = std::int64_t(1) << 20;
+
+	using Cents = FixedFraction<100>;
+	using Cents64 = FixedFraction64<100>;
+	using Ticks = FixedFraction64<kTick>;
+
+	// Mixed sign postings of up to 100.00, small enough that 2^16 of them sum within int
+	const std::vector<int>& postings() {
+		static std::vector<int> units;
+		if (units.empty()) {
+			std::mt19937 rng(1261);
+			std::uniform_int_distribution<int> amounts(-10000, 10000);
+			for (std::size_t i = 0; i < kPostings; ++i)
+				units.push_back(amounts(rng));
+		}
+		return units;
+	}
+
+	template <typename Value, typename Make>
+	std::vector<Value> ledger(Make make) {
+		std::vector<Value> values;
+		for (int units : postings())
+			values.push_back(make(units));
+		return values;
+	}
+
+	template <typename Value>
+	void runningSum(benchmark::State& state, const std::vector<Value>& values, const Value& zero) {
+		for (auto _ : state) {
+			Value total = zero;
+			for (const Value& value : values)
+				total += value;
+			benchmark::DoNotOptimize(total);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+	}
+
+	void BM_LedgerSumFraction(benchmark::State& state) {
+		runningSum(state, ledger<Fraction>([](int units) { return Fraction(units, 100); }), Fraction(0));
+	}
+	BENCHMARK(BM_LedgerSumFraction);
+
+	void BM_LedgerSumFixed(benchmark::State& state) {
+		runningSum(state, ledger<Cents>([](int units) { return Cents::fromUnits(units); }), Cents());
+	}
+	BENCHMARK(BM_LedgerSumFixed);
+
+	void BM_LedgerSumFraction64(benchmark::State& state) {
+		runningSum(state, ledger<Fraction64>([](int units) { return Fraction64(units, 100); }), Fraction64(0));
+	}
+	BENCHMARK(BM_LedgerSumFraction64);
+
+	void BM_LedgerSumFixed64(benchmark::State& state) {
+		runningSum(state, ledger<Cents64>([](int units) { return Cents64::fromUnits(units); }), Cents64());
+	}
+	BENCHMARK(BM_LedgerSumFixed64);
+
+	void BM_TickSumFraction64(benchmark::State& state) {
+		runningSum(state, ledger<Fraction64>([](int units) { return Fraction64(units, kTick); }), Fraction64(0));
+	}
+	BENCHMARK(BM_TickSumFraction64);
+
+	void BM_TickSumFixed64(benchmark::State& state) {
+		runningSum(state, ledger<Ticks>([](int units) { return Ticks::fromUnits(units); }), Ticks());
+	}
+	BENCHMARK(BM_TickSumFixed64);
+
+	// Counts the postings that take a running balance below zero: a sum and a comparison per posting
+	template <typename Value>
+	void overdrafts(benchmark::State& state, const std::vector<Value>& values, const Value& zero) {
+		for (auto _ : state) {
+			Value balance = zero;
+			std::size_t count = 0;
+			for (const Value& value : values) {
+				balance -= value;
+				count += balance < zero ? 1 : 0;
+			}
+			benchmark::DoNotOptimize(count);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+	}
+
+	void BM_OverdraftsFraction(benchmark::State& state) {
+		overdrafts(state, ledger<Fraction>([](int units) { return Fraction(units, 100); }), Fraction(0));
+	}
+	BENCHMARK(BM_OverdraftsFraction);
+
+	void BM_OverdraftsFixed(benchmark::State& state) {
+		overdrafts(state, ledger<Cents>([](int units) { return Cents::fromUnits(units); }), Cents());
+	}
+	BENCHMARK(BM_OverdraftsFixed);
+
+	// Splits each posting three ways: the share leaves the fixed denominator and is rounded back to cents
+	void BM_SplitRoundedFixed(benchmark::State& state) {
+		auto values = ledger<Cents>([](int units) { return Cents::fromUnits(units); });
+		for (auto _ : state) {
+			Cents total;
+			for (const Cents& value : values)
+				total += Cents::rounded(value / 3);
+			benchmark::DoNotOptimize(total);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+	}
+	BENCHMARK(BM_SplitRoundedFixed);
+}
@@ -0,0 +1,97 @@
+//
+// FractionArrayBenchmark.cpp
+// Element-wise arithmetic on a structure-of-arrays FractionArray against the same loop over std::vector<Fraction>.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionArray.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	std::vector<Fraction> makeFractions(std::size_t count, unsigned seed) {
+		std::mt19937 rng(seed);
+		std::uniform_int_distribution<int> numerators(-100000, 100000);
+		std::uniform_int_distribution<int> denominators(1, 1000);
+
+		std::vector<Fraction> fractions;
+		fractions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			fractions.emplace_back(numerators(rng), denominators(rng));
+		return fractions;
+	}
+
+	void BM_VectorMultiply(benchmark::State& state) {
+		auto lhs = makeFractions(static_cast<std::size_t>(state.range(0)), 1);
+		auto rhs = makeFractions(lhs.size(), 2);
+		std::vector<Fraction> out(lhs.size());
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < lhs.size(); ++i)
+				out[i] = lhs[i] * rhs[i];
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_VectorMultiply)->Arg(1 << 16);
+
+	void BM_ArrayMultiply(benchmark::State& state) {
+		FractionArray lhs(makeFractions(static_cast<std::size_t>(state.range(0)), 1));
+		FractionArray rhs(makeFractions(lhs.size(), 2));
+		FractionArray out(lhs.size());
+		for (auto _ : state) {
+			FractionArray::multiply(lhs, rhs, out);
+			benchmark::DoNotOptimize(out.numerators());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_ArrayMultiply)->Arg(1 << 16);
+
+	void BM_VectorAddInteger(benchmark::State& state) {
+		auto values = makeFractions(static_cast<std::size_t>(state.range(0)), 1);
+		std::vector<Fraction> out(values.size());
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < values.size(); ++i)
+				out[i] = values[i] + 3;
+			benchmark::DoNotOptimize(out.data());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_VectorAddInteger)->Arg(1 << 16);
+
+	void BM_ArrayAddInteger(benchmark::State& state) {
+		FractionArray values(makeFractions(static_cast<std::size_t>(state.range(0)), 1));
+		FractionArray out(values.size());
+		for (auto _ : state) {
+			FractionArray::add(values, 3, out);
+			benchmark::DoNotOptimize(out.numerators());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_ArrayAddInteger)->Arg(1 << 16);
+
+	void BM_VectorLess(benchmark::State& state) {
+		auto lhs = makeFractions(static_cast<std::size_t>(state.range(0)), 1);
+		auto rhs = makeFractions(lhs.size(), 2);
+		std::vector<std::uint8_t> mask(lhs.size());
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < lhs.size(); ++i)
+				mask[i] = lhs[i] < rhs[i];
+			benchmark::DoNotOptimize(mask.data());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_VectorLess)->Arg(1 << 16);
+
+	void BM_ArrayLess(benchmark::State& state) {
+		FractionArray lhs(makeFractions(static_cast<std::size_t>(state.range(0)), 1));
+		FractionArray rhs(makeFractions(lhs.size(), 2));
+		FractionArray::Mask mask;
+		for (auto _ : state) {
+			FractionArray::less(lhs, rhs, mask);
+			benchmark::DoNotOptimize(mask.data());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_ArrayLess)->Arg(1 << 16);
+}
@@ -0,0 +1,115 @@
+//
+// FractionFileBenchmark.cpp
+// Binary fraction files: writing, opening a zero-copy view, checksumming and decoding, against parsing the same
+// fractions from text.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionArray.h"
+#include "FractionFile.h"
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+	constexpr std::size_t kFractions = 1 << 20;
+
+	const FractionArray& fractions() {
+		static FractionArray array;
+		if (array.size() == 0) {
+			std::mt19937 rng(1261);
+			std::uniform_int_distribution<int> numerators(-1000000, 1000000);
+			std::uniform_int_distribution<int> denominators(1, 100000);
+			for (std::size_t i = 0; i < kFractions; ++i)
+				array.push_back(Fraction(numerators(rng), denominators(rng)));
+		}
+		return array;
+	}
+
+	// One file per encoding, written once and removed at exit
+	struct BenchmarkFile {
+		std::string path;
+
+		explicit BenchmarkFile(FractionEncoding encoding)
+			: path(encoding == FractionEncoding::Fixed ? "fraction_benchmark_fixed.bin" : "fraction_benchmark_varint.bin") {
+			writeFractionFile(path, fractions().view(), encoding);
+		}
+		~BenchmarkFile() { std::remove(path.c_str()); }
+	};
+
+	const std::string& filePath(FractionEncoding encoding) {
+		static BenchmarkFile fixed(FractionEncoding::Fixed);
+		static BenchmarkFile varint(FractionEncoding::Varint);
+		return encoding == FractionEncoding::Fixed ? fixed.path : varint.path;
+	}
+
+	std::int64_t columnBytes() {
+		return static_cast<std::int64_t>(kFractions * 2 * sizeof(int));
+	}
+
+	void BM_FileWrite(benchmark::State& state) {
+		auto encoding = static_cast<FractionEncoding>(state.range(0));
+		std::string path = "fraction_benchmark_write.bin";
+		for (auto _ : state)
+			writeFractionFile(path, fractions().view(), encoding);
+		std::remove(path.c_str());
+		state.SetBytesProcessed(state.iterations() * columnBytes());
+	}
+	BENCHMARK(BM_FileWrite)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+	void BM_FileOpenView(benchmark::State& state) {
+		const std::string& path = filePath(FractionEncoding::Fixed);
+		for (auto _ : state) {
+			FractionFileReader reader(path);
+			benchmark::DoNotOptimize(reader.view<int>()[kFractions - 1]);
+		}
+	}
+	BENCHMARK(BM_FileOpenView);
+
+	void BM_FileVerify(benchmark::State& state) {
+		FractionFileReader reader(filePath(FractionEncoding::Fixed));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(reader.verify());
+		state.SetBytesProcessed(state.iterations() * columnBytes());
+	}
+	BENCHMARK(BM_FileVerify);
+
+	void BM_FileRead(benchmark::State& state) {
+		FractionFileReader reader(filePath(static_cast<FractionEncoding>(state.range(0))));
+		FractionArray array;
+		for (auto _ : state) {
+			reader.read(array);
+			benchmark::DoNotOptimize(array.numerators());
+		}
+		state.SetBytesProcessed(state.iterations() * columnBytes());
+	}
+	BENCHMARK(BM_FileRead)->Arg(0)->Arg(1);
+
+	void BM_FileMultiplyView(benchmark::State& state) {
+		FractionFileReader reader(filePath(FractionEncoding::Fixed));
+		FractionArray out;
+		for (auto _ : state) {
+			FractionArray::multiply(reader.view<int>(), reader.view<int>(), out);
+			benchmark::DoNotOptimize(out.numerators());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kFractions));
+	}
+	BENCHMARK(BM_FileMultiplyView)->Unit(benchmark::kMillisecond);
+
+	void BM_TextParse(benchmark::State& state) {
+		std::ostringstream stream;
+		for (std::size_t i = 0; i < kFractions; ++i)
+			stream << fractions()[i] << '\n';
+		std::string text = stream.str();
+		FractionArray array;
+		for (auto _ : state) {
+			array.clear();
+			array.appendParsed(text);
+			benchmark::DoNotOptimize(array.numerators());
+		}
+		state.SetBytesProcessed(state.iterations() * columnBytes());
+	}
+	BENCHMARK(BM_TextParse)->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,110 @@
+//
+// GcdBenchmark.cpp
+// Cost of each gcd kernel in Gcd.h over the numerator/denominator pairs fractions typically hold.
+//
+
+#include "benchmark/benchmark.h"
+#include "Gcd.h"
+#include "GcdBatch.h"
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kPairs = 4096;
+
+	/**
+	*	The gcd Fraction used before the kernels existed, kept as the baseline.
+	*/
+	template <typename T>
+	T recursiveEuclid(T num, T den) {
+		if (den == 0)
+			return num;
+		return recursiveEuclid(den, num % den);
+	}
+
+	/**
+	*	Builds pairs that look like the numerator and denominator of an unreduced fraction:
+	*	two random factors of the requested width sharing a random common factor.
+	*/
+	template <typename U>
+	std::vector<std::pair<U, U>> makePairs(int factorBits, int sharedBits) {
+		std::mt19937_64 rng(1261);
+		auto draw = [&rng](int bits) { return U(1) + U(rng() & ((std::uint64_t(1) << bits) - 1)); };
+
+		std::vector<std::pair<U, U>> pairs(kPairs);
+		for (auto& pair : pairs) {
+			U shared = sharedBits > 0 ? draw(sharedBits) : U(1);
+			pair = { draw(factorBits) * shared, draw(factorBits) * shared };
+		}
+		return pairs;
+	}
+
+	template <typename U, typename Kernel>
+	void runPairs(benchmark::State& state, Kernel kernel, int factorBits, int sharedBits) {
+		auto pairs = makePairs<U>(factorBits, sharedBits);
+		for (auto _ : state) {
+			for (const auto& pair : pairs)
+				benchmark::DoNotOptimize(kernel(pair.first, pair.second));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(pairs.size()));
+	}
+
+	// Small denominators (cents, sixteenths, ...), products of two small fractions, and full-width coprime values.
+	template <typename U, typename Kernel>
+	void registerDistributions(const char* name, Kernel kernel) {
+		constexpr int bits = static_cast<int>(sizeof(U)) * 8;
+		benchmark::RegisterBenchmark((std::string(name) + "/small").c_str(),
+			[kernel](benchmark::State& state) { runPairs<U>(state, kernel, 7, 3); });
+		benchmark::RegisterBenchmark((std::string(name) + "/product").c_str(),
+			[kernel](benchmark::State& state) { runPairs<U>(state, kernel, bits / 2 - 6, 6); });
+		benchmark::RegisterBenchmark((std::string(name) + "/coprime").c_str(),
+			[kernel](benchmark::State& state) { runPairs<U>(state, kernel, bits - 1, 0); });
+	}
+
+	void runBatch(benchmark::State& state, gcd::Isa isa, int factorBits, int sharedBits) {
+		auto pairs = makePairs<std::uint32_t>(factorBits, sharedBits);
+		std::vector<std::uint32_t> a, b, out(pairs.size());
+		for (const auto& pair : pairs) {
+			a.push_back(pair.first);
+			b.push_back(pair.second);
+		}
+		gcd::setBatchIsa(isa);
+		if (gcd::batchIsa() != isa)
+			state.SkipWithError("instruction set not supported by this processor");
+		for (auto _ : state) {
+			gcd::gcdBatch(a.data(), b.data(), out.data(), out.size());
+			benchmark::DoNotOptimize(out.data());
+		}
+		gcd::setBatchIsa(gcd::detectedIsa());
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(pairs.size()));
+	}
+
+	void registerBatch(const char* name, gcd::Isa isa) {
+		benchmark::RegisterBenchmark((std::string(name) + "/small").c_str(),
+			[isa](benchmark::State& state) { runBatch(state, isa, 7, 3); });
+		benchmark::RegisterBenchmark((std::string(name) + "/product").c_str(),
+			[isa](benchmark::State& state) { runBatch(state, isa, 10, 6); });
+		benchmark::RegisterBenchmark((std::string(name) + "/coprime").c_str(),
+			[isa](benchmark::State& state) { runBatch(state, isa, 31, 0); });
+	}
+
+	const bool registered = [] {
+		registerDistributions<std::uint32_t>("gcd32/recursive", [](std::uint32_t a, std::uint32_t b) { return recursiveEuclid(a, b); });
+		registerDistributions<std::uint32_t>("gcd32/euclid", [](std::uint32_t a, std::uint32_t b) { return gcd::euclid(a, b); });
+		registerDistributions<std::uint32_t>("gcd32/binary", [](std::uint32_t a, std::uint32_t b) { return gcd::binary(a, b); });
+		registerDistributions<std::uint32_t>("gcd32/lehmer", [](std::uint32_t a, std::uint32_t b) { return gcd::lehmer(a, b); });
+
+		registerDistributions<std::uint64_t>("gcd64/recursive", [](std::uint64_t a, std::uint64_t b) { return recursiveEuclid(a, b); });
+		registerDistributions<std::uint64_t>("gcd64/euclid", [](std::uint64_t a, std::uint64_t b) { return gcd::euclid(a, b); });
+		registerDistributions<std::uint64_t>("gcd64/binary", [](std::uint64_t a, std::uint64_t b) { return gcd::binary(a, b); });
+		registerDistributions<std::uint64_t>("gcd64/lehmer", [](std::uint64_t a, std::uint64_t b) { return gcd::lehmer(a, b); });
+
+		registerBatch("gcd32/batch-scalar", gcd::Isa::Scalar);
+		registerBatch("gcd32/batch-avx2", gcd::Isa::Avx2);
+		registerBatch("gcd32/batch-avx512", gcd::Isa::Avx512);
+		return true;
+	}();
+}
@@ -0,0 +1,113 @@
+//
+// HashBenchmark.cpp
+// Counting repeated fractions: string keys formatted with operator<<, std::unordered_map over std::hash<Fraction>,
+// the open-addressing FractionHashMap, and interning the same stream into ids.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionHashMap.h"
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kCount = 16384;
+
+	// A stream of prices in cents over a few currencies' worth of denominators, with each value repeated about 8 times
+	std::vector<Fraction> stream() {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> cents(1, 2048), denominators(0, 2);
+		const int scales[] = { 100, 1000, 240 };
+		std::vector<Fraction> fractions;
+		fractions.reserve(kCount);
+		for (std::size_t i = 0; i < kCount; ++i)
+			fractions.emplace_back(cents(rng), scales[denominators(rng)]);
+		return fractions;
+	}
+
+	void BM_CountStringKeys(benchmark::State& state) {
+		auto values = stream();
+		for (auto _ : state) {
+			std::unordered_map<std::string, int> counts;
+			for (const Fraction& value : values) {
+				std::ostringstream text;
+				text << value;
+				++counts[text.str()];
+			}
+			benchmark::DoNotOptimize(counts.size());
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_CountStringKeys);
+
+	void BM_CountUnorderedMap(benchmark::State& state) {
+		auto values = stream();
+		for (auto _ : state) {
+			std::unordered_map<Fraction, int> counts;
+			for (const Fraction& value : values)
+				++counts[value];
+			benchmark::DoNotOptimize(counts.size());
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_CountUnorderedMap);
+
+	void BM_CountHashMap(benchmark::State& state) {
+		auto values = stream();
+		for (auto _ : state) {
+			BasicFractionHashMap<int, int> counts;
+			for (const Fraction& value : values)
+				++counts[value];
+			benchmark::DoNotOptimize(counts.size());
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_CountHashMap);
+
+	// Lookups only, into tables already holding every value
+	void BM_FindUnorderedMap(benchmark::State& state) {
+		auto values = stream();
+		std::unordered_map<Fraction, int> counts;
+		for (const Fraction& value : values)
+			++counts[value];
+		for (auto _ : state) {
+			int total = 0;
+			for (const Fraction& value : values)
+				total += counts.find(value)->second;
+			benchmark::DoNotOptimize(total);
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_FindUnorderedMap);
+
+	void BM_FindHashMap(benchmark::State& state) {
+		auto values = stream();
+		BasicFractionHashMap<int, int> counts;
+		for (const Fraction& value : values)
+			++counts[value];
+		for (auto _ : state) {
+			int total = 0;
+			for (const Fraction& value : values)
+				total += *counts.find(value);
+			benchmark::DoNotOptimize(total);
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_FindHashMap);
+
+	void BM_Intern(benchmark::State& state) {
+		auto values = stream();
+		std::vector<FractionInterner::Id> ids(kCount);
+		for (auto _ : state) {
+			FractionInterner interner;
+			for (std::size_t i = 0; i < kCount; ++i)
+				ids[i] = interner.intern(values[i]);
+			benchmark::DoNotOptimize(ids.data());
+		}
+		state.SetItemsProcessed(state.iterations() * kCount);
+	}
+	BENCHMARK(BM_Intern);
+}
@@ -0,0 +1,78 @@
+//
+// LazyFractionBenchmark.cpp
+// Long += chains on eagerly reduced fractions against LazyFraction, which only reduces when the value is observed.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include "LazyFraction.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	template <typename FractionT>
+	std::vector<FractionT> makeAddends(std::size_t count, int maxDenominator, bool sameDenominator) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-99, 99);
+		std::uniform_int_distribution<int> denominators(1, maxDenominator);
+
+		std::vector<FractionT> fractions;
+		fractions.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			fractions.emplace_back(numerators(rng), sameDenominator ? maxDenominator : denominators(rng));
+		return fractions;
+	}
+
+	// Amounts in cents: every addend shares the denominator 100
+	template <typename FractionT>
+	void BM_SumCents(benchmark::State& state) {
+		auto addends = makeAddends<FractionT>(4096, 100, true);
+		for (auto _ : state) {
+			FractionT sum(0);
+			for (const FractionT& addend : addends)
+				sum += addend;
+			benchmark::DoNotOptimize(sum.getNumerator());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(addends.size()));
+	}
+	BENCHMARK_TEMPLATE(BM_SumCents, Fraction);
+	BENCHMARK_TEMPLATE(BM_SumCents, LazyFraction);
+	BENCHMARK_TEMPLATE(BM_SumCents, Fraction64);
+#ifdef __SIZEOF_INT128__
+	BENCHMARK_TEMPLATE(BM_SumCents, LazyFraction64);
+#endif
+
+	// Mixed small denominators, where the lazy denominator grows until it has to be reduced
+	template <typename FractionT>
+	void BM_SumMixed(benchmark::State& state) {
+		auto addends = makeAddends<FractionT>(4096, 12, false);
+		for (auto _ : state) {
+			FractionT sum(0);
+			for (const FractionT& addend : addends)
+				sum += addend;
+			benchmark::DoNotOptimize(sum.getNumerator());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(addends.size()));
+	}
+	BENCHMARK_TEMPLATE(BM_SumMixed, Fraction);
+	BENCHMARK_TEMPLATE(BM_SumMixed, LazyFraction);
+	BENCHMARK_TEMPLATE(BM_SumMixed, Fraction64);
+#ifdef __SIZEOF_INT128__
+	BENCHMARK_TEMPLATE(BM_SumMixed, LazyFraction64);
+#endif
+
+	// Adding whole numbers never needs a gcd in lazy mode
+	template <typename FractionT>
+	void BM_AddIntegers(benchmark::State& state) {
+		for (auto _ : state) {
+			FractionT sum(1, 3);
+			for (int i = 0; i < 4096; ++i)
+				sum += i & 7;
+			benchmark::DoNotOptimize(sum.getNumerator());
+		}
+		state.SetItemsProcessed(state.iterations() * 4096);
+	}
+	BENCHMARK_TEMPLATE(BM_AddIntegers, Fraction);
+	BENCHMARK_TEMPLATE(BM_AddIntegers, LazyFraction);
+}
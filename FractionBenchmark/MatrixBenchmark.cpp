@@ -0,0 +1,99 @@
+//
+// MatrixBenchmark.cpp
+// Determinants of n x n matrices with small rational entries: Gaussian elimination written by hand over Fraction
+// (which overflows beyond the smallest sizes) and over BigFraction, against the fraction-free FractionMatrix.
+// Sizes run from 8 to 128 by default; set FRACTION_LARGE_MATRICES in the environment to add 256 and 512,
+// which take minutes each. The naive BigFraction loop stays capped at 128 either way.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionMatrix.h"
+#include <cstdlib>
+#include <random>
+#include <utility>
+
+namespace {
+
+	// Registration runs before main, so the opt-in is read from the environment rather than the command line
+	void matrixSizes(benchmark::internal::Benchmark* family) {
+		family->RangeMultiplier(2)->Range(8, 128);
+		if (std::getenv("FRACTION_LARGE_MATRICES") != nullptr)
+			family->Arg(256)->Arg(512);
+	}
+
+	template <typename Matrix>
+	Matrix randomMatrix(std::size_t size) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-9, 9), denominators(1, 4);
+		Matrix matrix(size, size);
+		for (std::size_t i = 0; i < size; ++i)
+			for (std::size_t j = 0; j < size; ++j)
+				matrix(i, j) = Fraction(numerators(rng), denominators(rng));
+		return matrix;
+	}
+
+	// The loop the fraction-free elimination replaces: one reduced temporary per multiply and subtract
+	template <typename Element>
+	Element naiveDeterminant(BasicFractionMatrix<Element> matrix) {
+		Element result(1);
+		std::size_t size = matrix.rows();
+		for (std::size_t k = 0; k < size; ++k) {
+			std::size_t pivot = k;
+			while (pivot < size && matrix(pivot, k) == Element(0))
+				++pivot;
+			if (pivot == size)
+				return Element(0);
+			if (pivot != k) {
+				for (std::size_t j = 0; j < size; ++j)
+					std::swap(matrix(k, j), matrix(pivot, j));
+				result = result * Element(-1);
+			}
+			result = result * matrix(k, k);
+			for (std::size_t i = k + 1; i < size; ++i) {
+				Element factor = matrix(i, k) / matrix(k, k);
+				for (std::size_t j = k; j < size; ++j)
+					matrix(i, j) = matrix(i, j) - factor * matrix(k, j);
+			}
+		}
+		return result;
+	}
+
+	void BM_NaiveFraction(benchmark::State& state) {
+		auto matrix = randomMatrix<FractionMatrix>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(naiveDeterminant(matrix));
+	}
+	BENCHMARK(BM_NaiveFraction)->Apply(matrixSizes)->Unit(benchmark::kMillisecond);
+
+	void BM_NaiveBigFraction(benchmark::State& state) {
+		auto matrix = randomMatrix<BigFractionMatrix>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(naiveDeterminant(matrix));
+	}
+	BENCHMARK(BM_NaiveBigFraction)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond);
+
+	void BM_Bareiss(benchmark::State& state) {
+		auto matrix = randomMatrix<BigFractionMatrix>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(matrix.determinant());
+	}
+	BENCHMARK(BM_Bareiss)->Apply(matrixSizes)->Unit(benchmark::kMillisecond);
+
+	void BM_BareissThreaded(benchmark::State& state) {
+		auto matrix = randomMatrix<BigFractionMatrix>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(matrix.determinant(&ThreadPool::shared()));
+		state.counters["threads"] = static_cast<double>(ThreadPool::shared().size());
+	}
+	BENCHMARK(BM_BareissThreaded)->Apply(matrixSizes)->Unit(benchmark::kMillisecond);
+
+	void BM_BareissSolve(benchmark::State& state) {
+		std::size_t size = static_cast<std::size_t>(state.range(0));
+		auto matrix = randomMatrix<BigFractionMatrix>(size);
+		auto rhs = randomMatrix<BigFractionMatrix>(size + 1);
+		std::vector<BigFraction> column(rhs.row(size), rhs.row(size) + size);
+		for (auto _ : state)
+			benchmark::DoNotOptimize(matrix.solve(column));
+	}
+	BENCHMARK(BM_BareissSolve)->Apply(matrixSizes)->Unit(benchmark::kMillisecond);
+}
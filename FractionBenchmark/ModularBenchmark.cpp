@@ -0,0 +1,98 @@
+//
+// ModularBenchmark.cpp
+// Exact computations whose coefficients grow: harmonic sums and determinants of matrices with small rational
+// entries, accumulated in BigFraction or FractionMatrix against the same computation evaluated modulo 62-bit primes.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionMatrix.h"
+#include "ModularFraction.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	template <typename Matrix>
+	Matrix randomMatrix(std::size_t size) {
+		std::mt19937 rng(1261);
+		std::uniform_int_distribution<int> numerators(-9, 9), denominators(1, 4);
+		Matrix matrix(size, size);
+		for (std::size_t i = 0; i < size; ++i)
+			for (std::size_t j = 0; j < size; ++j)
+				matrix(i, j) = Fraction64(numerators(rng), denominators(rng));
+		return matrix;
+	}
+
+	// Gaussian elimination in the field; a zero pivot column means the determinant is zero in this field
+	modular::Residue determinant(const modular::Field& field, const FractionMatrix64& input) {
+		std::size_t size = input.rows();
+		std::vector<modular::Residue> matrix;
+		matrix.reserve(size * size);
+		for (std::size_t i = 0; i < size; ++i)
+			for (std::size_t j = 0; j < size; ++j)
+				matrix.push_back(field(input(i, j)));
+
+		modular::Residue result = field.one();
+		for (std::size_t k = 0; k < size; ++k) {
+			std::size_t pivot = k;
+			while (pivot < size && matrix[pivot * size + k] == field.zero())
+				++pivot;
+			if (pivot == size)
+				return field.zero();
+			if (pivot != k) {
+				for (std::size_t j = 0; j < size; ++j)
+					std::swap(matrix[k * size + j], matrix[pivot * size + j]);
+				result = -result;
+			}
+			result *= matrix[k * size + k];
+			modular::Residue inverse = field.one() / matrix[k * size + k];
+			for (std::size_t i = k + 1; i < size; ++i) {
+				modular::Residue factor = matrix[i * size + k] * inverse;
+				for (std::size_t j = k + 1; j < size; ++j)
+					matrix[i * size + j] -= factor * matrix[k * size + j];
+			}
+		}
+		return result;
+	}
+
+	void BM_HarmonicBigFraction(benchmark::State& state) {
+		int n = static_cast<int>(state.range(0));
+		for (auto _ : state) {
+			BigFraction sum(0);
+			for (int i = 1; i <= n; ++i)
+				sum += BigFraction(1, i);
+			benchmark::DoNotOptimize(sum);
+		}
+	}
+	BENCHMARK(BM_HarmonicBigFraction)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+	void BM_HarmonicModular(benchmark::State& state) {
+		int n = static_cast<int>(state.range(0));
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(modular::evaluate([n](const modular::Field& field) {
+				modular::Residue sum = field.zero();
+				for (int i = 1; i <= n; ++i)
+					sum += field.one() / field(i);
+				return sum;
+			}));
+		}
+		state.counters["threads"] = static_cast<double>(ThreadPool::shared().size());
+	}
+	BENCHMARK(BM_HarmonicModular)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+	void BM_DeterminantBareiss(benchmark::State& state) {
+		auto matrix = randomMatrix<BigFractionMatrix>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(matrix.determinant());
+	}
+	BENCHMARK(BM_DeterminantBareiss)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond);
+
+	void BM_DeterminantModular(benchmark::State& state) {
+		auto matrix = randomMatrix<FractionMatrix64>(static_cast<std::size_t>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(modular::evaluate([&](const modular::Field& field) { return determinant(field, matrix); }));
+		state.counters["threads"] = static_cast<double>(ThreadPool::shared().size());
+	}
+	BENCHMARK(BM_DeterminantModular)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond);
+}
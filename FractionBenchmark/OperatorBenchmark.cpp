@@ -0,0 +1,214 @@
+//
+// OperatorBenchmark.cpp
+// Throughput of every constructor and operator overload in Fraction.h, over three input distributions:
+// small denominators, large coprime values, and values close to the int limits.
+//
+
+#include "benchmark/benchmark.h"
+#include "Fraction.h"
+#include <climits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kOperands = 1024;
+
+	enum class Distribution { Small, Coprime, NearOverflow };
+
+	struct Operands {
+		std::vector<int> numerators;
+		std::vector<int> denominators;
+		std::vector<int> integers;
+		std::vector<Fraction> fractions;
+	};
+
+	/**
+	*	Draws numerator/denominator pairs and plain integers from the requested distribution.
+	*	Small: prices and probabilities, non-zero, with denominators up to 16. Coprime: full-width values already in simplest form.
+	*	NearOverflow: values within 2^16 of the int limits, where every product needs the wide type.
+	*/
+	const Operands& operands(Distribution distribution, unsigned seed) {
+		static Operands cache[3][2];
+		Operands& result = cache[static_cast<int>(distribution)][seed & 1];
+		if (!result.fractions.empty())
+			return result;
+
+		std::mt19937 rng(seed + 1261);
+		for (std::size_t i = 0; i < kOperands; ++i) {
+			int num;
+			int den;
+			int integer;
+			switch (distribution) {
+			case Distribution::Small:
+				// Never zero, since any operand can end up as a divisor
+				num = std::uniform_int_distribution<int>(1, 100)(rng);
+				num = rng() & 1 ? num : -num;
+				den = std::uniform_int_distribution<int>(1, 16)(rng);
+				integer = std::uniform_int_distribution<int>(1, 10)(rng);
+				integer = rng() & 1 ? integer : -integer;
+				break;
+			case Distribution::Coprime:
+				do {
+					num = std::uniform_int_distribution<int>(-(1 << 30), 1 << 30)(rng);
+					den = std::uniform_int_distribution<int>(1, 1 << 30)(rng);
+				} while (std::gcd(num, den) != 1);
+				integer = std::uniform_int_distribution<int>(-(1 << 30), 1 << 30)(rng);
+				break;
+			default:
+				num = INT_MAX - std::uniform_int_distribution<int>(0, 1 << 16)(rng);
+				num = rng() & 1 ? num : -num;
+				den = INT_MAX - std::uniform_int_distribution<int>(0, 1 << 16)(rng);
+				integer = INT_MAX - std::uniform_int_distribution<int>(0, 1 << 16)(rng);
+				break;
+			}
+			result.numerators.push_back(num);
+			result.denominators.push_back(den);
+			result.integers.push_back(integer);
+			result.fractions.emplace_back(num, den);
+		}
+		return result;
+	}
+
+	template <typename Operation>
+	void runFractions(benchmark::State& state, Distribution distribution, Operation operation) {
+		const Operands& lhs = operands(distribution, 0);
+		const Operands& rhs = operands(distribution, 1);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kOperands; ++i)
+				benchmark::DoNotOptimize(operation(lhs.fractions[i], rhs.fractions[i]));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+	}
+
+	template <typename Operation>
+	void runMixed(benchmark::State& state, Distribution distribution, Operation operation) {
+		const Operands& lhs = operands(distribution, 0);
+		const Operands& rhs = operands(distribution, 1);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kOperands; ++i)
+				benchmark::DoNotOptimize(operation(lhs.fractions[i], rhs.integers[i]));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+	}
+
+	template <typename Operation>
+	void runIntegers(benchmark::State& state, Distribution distribution, Operation operation) {
+		const Operands& values = operands(distribution, 0);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < kOperands; ++i)
+				benchmark::DoNotOptimize(operation(values.numerators[i], values.denominators[i]));
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+	}
+
+	void runWrite(benchmark::State& state, Distribution distribution) {
+		const Operands& values = operands(distribution, 0);
+		std::ostringstream stream;
+		for (auto _ : state) {
+			stream.str(std::string());
+			for (const Fraction& fraction : values.fractions)
+				stream << fraction << ' ';
+			benchmark::DoNotOptimize(stream.tellp());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+	}
+
+	void runRead(benchmark::State& state, Distribution distribution) {
+		std::ostringstream text;
+		for (std::size_t i = 0; i < kOperands; ++i)
+			text << operands(distribution, 0).numerators[i] << '/' << operands(distribution, 0).denominators[i] << ' ';
+		std::istringstream stream(text.str());
+		Fraction fraction;
+		for (auto _ : state) {
+			stream.clear();
+			stream.seekg(0);
+			for (std::size_t i = 0; i < kOperands; ++i)
+				stream >> fraction;
+			benchmark::DoNotOptimize(fraction);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+	}
+
+	template <typename Runner, typename Operation>
+	void registerOperator(const std::string& name, Runner runner, Operation operation) {
+		const char* suffixes[] = { "/small", "/coprime", "/near-overflow" };
+		for (int i = 0; i < 3; ++i) {
+			Distribution distribution = static_cast<Distribution>(i);
+			benchmark::RegisterBenchmark(("Fraction/" + name + suffixes[i]).c_str(),
+				[runner, operation, distribution](benchmark::State& state) { runner(state, distribution, operation); });
+		}
+	}
+
+	const bool registered = [] {
+		auto fractions = [](benchmark::State& state, Distribution distribution, auto operation) { runFractions(state, distribution, operation); };
+		auto mixed = [](benchmark::State& state, Distribution distribution, auto operation) { runMixed(state, distribution, operation); };
+		auto integers = [](benchmark::State& state, Distribution distribution, auto operation) { runIntegers(state, distribution, operation); };
+
+		// Constructors
+		benchmark::RegisterBenchmark("Fraction/ctor()", [](benchmark::State& state) {
+			for (auto _ : state) {
+				for (std::size_t i = 0; i < kOperands; ++i)
+					benchmark::DoNotOptimize(Fraction());
+			}
+			state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kOperands));
+		});
+		registerOperator("ctor(int)", integers, [](int num, int) { return Fraction(num); });
+		registerOperator("ctor(int,int)", integers, [](int num, int den) { return Fraction(num, den); });
+
+		// Equality and comparison
+		registerOperator("op==", fractions, [](const Fraction& a, const Fraction& b) { return a == b; });
+		registerOperator("op!=", fractions, [](const Fraction& a, const Fraction& b) { return a != b; });
+		registerOperator("compare", fractions, [](const Fraction& a, const Fraction& b) { return a.compare(b); });
+		registerOperator("op<", fractions, [](const Fraction& a, const Fraction& b) { return a < b; });
+		registerOperator("op<(int)", mixed, [](const Fraction& a, int b) { return a < b; });
+		registerOperator("op<(int,Fraction)", mixed, [](const Fraction& a, int b) { return b < a; });
+		registerOperator("op<=", fractions, [](const Fraction& a, const Fraction& b) { return a <= b; });
+		registerOperator("op<=(int)", mixed, [](const Fraction& a, int b) { return a <= b; });
+		registerOperator("op<=(int,Fraction)", mixed, [](const Fraction& a, int b) { return b <= a; });
+		registerOperator("op>", fractions, [](const Fraction& a, const Fraction& b) { return a > b; });
+		registerOperator("op>(int)", mixed, [](const Fraction& a, int b) { return a > b; });
+		registerOperator("op>(int,Fraction)", mixed, [](const Fraction& a, int b) { return b > a; });
+		registerOperator("op>=", fractions, [](const Fraction& a, const Fraction& b) { return a >= b; });
+		registerOperator("op>=(int)", mixed, [](const Fraction& a, int b) { return a >= b; });
+		registerOperator("op>=(int,Fraction)", mixed, [](const Fraction& a, int b) { return b >= a; });
+
+		// Arithmetic
+		registerOperator("op+", fractions, [](const Fraction& a, const Fraction& b) { return a + b; });
+		registerOperator("op+(int)", mixed, [](const Fraction& a, int b) { return a + b; });
+		registerOperator("op+(int,Fraction)", mixed, [](const Fraction& a, int b) { return b + a; });
+		registerOperator("op-", fractions, [](const Fraction& a, const Fraction& b) { return a - b; });
+		registerOperator("op-(int)", mixed, [](const Fraction& a, int b) { return a - b; });
+		registerOperator("op-(int,Fraction)", mixed, [](const Fraction& a, int b) { return b - a; });
+		registerOperator("op*", fractions, [](const Fraction& a, const Fraction& b) { return a * b; });
+		registerOperator("op*(int)", mixed, [](const Fraction& a, int b) { return a * b; });
+		registerOperator("op*(int,Fraction)", mixed, [](const Fraction& a, int b) { return b * a; });
+		registerOperator("op/", fractions, [](const Fraction& a, const Fraction& b) { return a / b; });
+		registerOperator("op/(int)", mixed, [](const Fraction& a, int b) { return a / b; });
+		registerOperator("op/(int,Fraction)", mixed, [](const Fraction& a, int b) { return b / a; });
+
+		// Compound assignment
+		registerOperator("op+=", fractions, [](Fraction a, const Fraction& b) { a += b; return a; });
+		registerOperator("op+=(int)", mixed, [](Fraction a, int b) { a += b; return a; });
+		registerOperator("op-=", fractions, [](Fraction a, const Fraction& b) { a -= b; return a; });
+		registerOperator("op-=(int)", mixed, [](Fraction a, int b) { a -= b; return a; });
+		registerOperator("op*=", fractions, [](Fraction a, const Fraction& b) { a *= b; return a; });
+		registerOperator("op*=(int)", mixed, [](Fraction a, int b) { a *= b; return a; });
+		registerOperator("op/=", fractions, [](Fraction a, const Fraction& b) { a /= b; return a; });
+		registerOperator("op/=(int)", mixed, [](Fraction a, int b) { a /= b; return a; });
+
+		// Streams
+		const char* suffixes[] = { "/small", "/coprime", "/near-overflow" };
+		for (int i = 0; i < 3; ++i) {
+			Distribution distribution = static_cast<Distribution>(i);
+			benchmark::RegisterBenchmark((std::string("Fraction/op<<") + suffixes[i]).c_str(),
+				[distribution](benchmark::State& state) { runWrite(state, distribution); });
+			benchmark::RegisterBenchmark((std::string("Fraction/op>>") + suffixes[i]).c_str(),
+				[distribution](benchmark::State& state) { runRead(state, distribution); });
+		}
+		return true;
+	}();
+}
@@ -0,0 +1,82 @@
+//
+// ParallelBenchmark.cpp
+// Wall-clock scaling of parallel::sum, product and dot from 1 to 64 threads against the serial loops.
+//
+
+#include "benchmark/benchmark.h"
+#include "Parallel.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kCount = 1 << 21;
+
+	const std::vector<Fraction>& values(unsigned seed) {
+		static std::vector<Fraction> fractions[2];
+		std::vector<Fraction>& result = fractions[seed & 1];
+		if (result.empty()) {
+			std::mt19937 rng(seed);
+			std::uniform_int_distribution<int> numerators(-9, 9);
+			std::uniform_int_distribution<int> denominators(1, 12);
+			for (std::size_t i = 0; i < kCount; ++i)
+				result.emplace_back(numerators(rng), denominators(rng));
+		}
+		return result;
+	}
+
+	void BM_SerialSum(benchmark::State& state) {
+		const auto& fractions = values(0);
+		for (auto _ : state) {
+			Fraction sum(0);
+			for (const Fraction& fraction : fractions)
+				sum += fraction;
+			benchmark::DoNotOptimize(sum);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_SerialSum)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_ParallelSum(benchmark::State& state) {
+		const auto& fractions = values(0);
+		ThreadPool pool(static_cast<unsigned>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(parallel::sum(fractions.begin(), fractions.end(), pool));
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_ParallelSum)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_SerialDot(benchmark::State& state) {
+		const auto& lhs = values(0);
+		const auto& rhs = values(1);
+		for (auto _ : state) {
+			Fraction sum(0);
+			for (std::size_t i = 0; i < kCount; ++i)
+				sum += lhs[i] * rhs[i];
+			benchmark::DoNotOptimize(sum);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_SerialDot)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_ParallelDot(benchmark::State& state) {
+		const auto& lhs = values(0);
+		const auto& rhs = values(1);
+		ThreadPool pool(static_cast<unsigned>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(parallel::dot(lhs.begin(), lhs.end(), rhs.begin(), pool));
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_ParallelDot)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_ParallelProduct(benchmark::State& state) {
+		std::vector<Fraction> factors;
+		for (std::size_t i = 0; i < kCount; ++i)
+			factors.emplace_back(static_cast<int>(i % 5 + 1), static_cast<int>((i + 2) % 5 + 1));
+		ThreadPool pool(static_cast<unsigned>(state.range(0)));
+		for (auto _ : state)
+			benchmark::DoNotOptimize(parallel::product(factors.begin(), factors.end(), pool));
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+	}
+	BENCHMARK(BM_ParallelProduct)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,90 @@
+//
+// StreamBenchmark.cpp
+// Ingestion of a large newline-delimited fraction file held in a string stream: stream extraction, a single
+// bulk parse of the whole buffer, and the streaming parser by thread count. Throughput is reported in bytes/s.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionStream.h"
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+	constexpr std::size_t kLines = 1 << 22;
+
+	const std::string& text() {
+		static std::string buffer;
+		if (buffer.empty()) {
+			std::mt19937 rng(1261);
+			std::uniform_int_distribution<int> numerators(-1000000, 1000000);
+			std::uniform_int_distribution<int> denominators(1, 100000);
+			std::ostringstream stream;
+			for (std::size_t i = 0; i < kLines; ++i)
+				stream << numerators(rng) << '/' << denominators(rng) << '\n';
+			buffer = stream.str();
+		}
+		return buffer;
+	}
+
+	void BM_StreamExtract(benchmark::State& state) {
+		std::istringstream input(text());
+		for (auto _ : state) {
+			input.clear();
+			input.seekg(0);
+			Fraction fraction;
+			std::size_t count = 0;
+			while (input >> fraction)
+				++count;
+			benchmark::DoNotOptimize(count);
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_StreamExtract)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_BulkParseWhole(benchmark::State& state) {
+		FractionArray array;
+		array.reserve(kLines);
+		for (auto _ : state) {
+			array.clear();
+			benchmark::DoNotOptimize(array.appendParsed(text()));
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_BulkParseWhole)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_StreamParserToArray(benchmark::State& state) {
+		ThreadPool pool(static_cast<unsigned>(state.range(0)));
+		FractionStreamParser parser(pool);
+		std::istringstream input(text());
+		FractionArray array;
+		array.reserve(kLines);
+		for (auto _ : state) {
+			input.clear();
+			input.seekg(0);
+			array.clear();
+			benchmark::DoNotOptimize(parser.parse(input, array));
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_StreamParserToArray)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+	void BM_StreamParserCallback(benchmark::State& state) {
+		ThreadPool pool(static_cast<unsigned>(state.range(0)));
+		FractionStreamParser parser(pool);
+		std::istringstream input(text());
+		for (auto _ : state) {
+			input.clear();
+			input.seekg(0);
+			long long numerators = 0;
+			parser.parse(input, [&numerators](const FractionView& fractions) {
+				for (std::size_t i = 0; i < fractions.size(); ++i)
+					numerators += fractions.numerators()[i];
+			});
+			benchmark::DoNotOptimize(numerators);
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_StreamParserCallback)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+}
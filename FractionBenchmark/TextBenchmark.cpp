@@ -0,0 +1,105 @@
+//
+// TextBenchmark.cpp
+// Fraction::parse/format against the stream operators, and bulk parsing of a whole buffer into a FractionArray.
+//
+
+#include "benchmark/benchmark.h"
+#include "FractionArray.h"
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+	constexpr std::size_t kFractions = 1 << 16;
+
+	const std::string& text() {
+		static std::string buffer;
+		if (buffer.empty()) {
+			std::mt19937 rng(1261);
+			std::uniform_int_distribution<int> numerators(-1000000, 1000000);
+			std::uniform_int_distribution<int> denominators(1, 100000);
+			std::ostringstream stream;
+			for (std::size_t i = 0; i < kFractions; ++i)
+				stream << numerators(rng) << '/' << denominators(rng) << '\n';
+			buffer = stream.str();
+		}
+		return buffer;
+	}
+
+	std::vector<std::string> lines() {
+		std::vector<std::string> result;
+		std::istringstream stream(text());
+		for (std::string line; std::getline(stream, line);)
+			result.push_back(line);
+		return result;
+	}
+
+	void BM_StreamRead(benchmark::State& state) {
+		std::istringstream stream(text());
+		Fraction fraction;
+		for (auto _ : state) {
+			stream.clear();
+			stream.seekg(0);
+			for (std::size_t i = 0; i < kFractions; ++i)
+				stream >> fraction;
+			benchmark::DoNotOptimize(fraction);
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_StreamRead);
+
+	void BM_Parse(benchmark::State& state) {
+		auto input = lines();
+		for (auto _ : state) {
+			for (const std::string& line : input)
+				benchmark::DoNotOptimize(Fraction::parse(line));
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_Parse);
+
+	void BM_BulkParse(benchmark::State& state) {
+		FractionArray array;
+		array.reserve(kFractions);
+		for (auto _ : state) {
+			array.clear();
+			benchmark::DoNotOptimize(array.appendParsed(text()));
+		}
+		state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text().size()));
+	}
+	BENCHMARK(BM_BulkParse);
+
+	void BM_StreamWrite(benchmark::State& state) {
+		FractionArray array;
+		array.appendParsed(text());
+		auto fractions = array.toVector();
+		std::ostringstream stream;
+		for (auto _ : state) {
+			stream.str(std::string());
+			for (const Fraction& fraction : fractions)
+				stream << fraction << '\n';
+			benchmark::DoNotOptimize(stream.tellp());
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kFractions));
+	}
+	BENCHMARK(BM_StreamWrite);
+
+	void BM_Format(benchmark::State& state) {
+		FractionArray array;
+		array.appendParsed(text());
+		auto fractions = array.toVector();
+		std::vector<char> output(kFractions * Fraction::kFormatBufferSize);
+		for (auto _ : state) {
+			char* position = output.data();
+			for (const Fraction& fraction : fractions) {
+				position += fraction.format(position);
+				*position++ = '\n';
+			}
+			benchmark::DoNotOptimize(position);
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kFractions));
+	}
+	BENCHMARK(BM_Format);
+}
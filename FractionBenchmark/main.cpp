@@ -0,0 +1,10 @@
+//
+// main.cpp
+// Entry point for the Fraction benchmarks. Every other file in this project registers its own benchmarks.
+// Pass --benchmark_out=<file> --benchmark_out_format=json to save results that can be diffed between
+// versions with compare.py from the Google Benchmark tools to catch regressions.
+//
+
+#include "benchmark/benchmark.h"
+
+BENCHMARK_MAIN();
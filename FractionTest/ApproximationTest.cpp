@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include "BigFraction.h"
+#include "FractionArray.h"
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // Closest fraction with a denominator of at most maxDenominator by trying every denominator, ties to the smaller
+    Fraction64 bruteForce(const Fraction64& exact, long long maxDenominator) {
+        BigFraction target(exact);
+        Fraction64 best(0);
+        BigFraction bestDistance(-1);
+        for (long long q = 1; q <= maxDenominator; ++q) {
+            long long floor = static_cast<long long>(std::floor(static_cast<double>(exact.getNumerator()) / exact.getDenominator() * q));
+            for (long long p = floor - 1; p <= floor + 2; ++p) {
+                BigFraction distance = BigFraction(p, q) - target;
+                if (distance < 0)
+                    distance = -1 * distance;
+                if (bestDistance < 0 || distance < bestDistance) {
+                    best = Fraction64(p, q);
+                    bestDistance = distance;
+                }
+            }
+        }
+        return best;
+    }
+
+}
+
+TEST(ApproximationTest, fromDoubleTest01) {
+    ASSERT_EQ(Fraction::fromDouble(0.75), Fraction(3, 4));
+    ASSERT_EQ(Fraction::fromDouble(-2.5), Fraction(-5, 2));
+    ASSERT_EQ(Fraction::fromDouble(0.0), Fraction(0));
+    ASSERT_EQ(Fraction::fromDouble(-0.0), Fraction(0));
+    ASSERT_EQ(Fraction::fromDouble(1e9), Fraction(1000000000));
+    ASSERT_EQ(Fraction::fromDouble(-2147483648.0), Fraction(INT_MIN));
+    ASSERT_EQ(Fraction64::fromDouble(0.1), Fraction64(3602879701896397LL, 36028797018963968LL));
+    ASSERT_THROW(Fraction::fromDouble(2147483648.0), std::overflow_error);
+    ASSERT_THROW(Fraction::fromDouble(0.1), std::overflow_error);
+    ASSERT_THROW(Fraction64::fromDouble(1e-300), std::overflow_error);
+    ASSERT_THROW(Fraction::fromDouble(std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+    ASSERT_THROW(Fraction::fromDouble(-std::numeric_limits<double>::infinity()), std::domain_error);
+}
+
+TEST(ApproximationTest, fromDoubleTest02) {
+    const double pi = 3.14159265358979323846;
+    ASSERT_EQ(Fraction::fromDouble(pi, 7), Fraction(22, 7));
+    ASSERT_EQ(Fraction::fromDouble(pi, 113), Fraction(355, 113));
+    ASSERT_EQ(Fraction::fromDouble(pi, 1000), Fraction(355, 113));
+    ASSERT_EQ(Fraction64::fromDouble(pi, LLONG_MAX), Fraction64(884279719003555LL, 281474976710656LL));
+    ASSERT_EQ(Fraction::fromDouble(0.1, 10), Fraction(1, 10));
+    ASSERT_EQ(Fraction::fromDouble(-1.0 / 3, 100), Fraction(-1, 3));
+    ASSERT_EQ(Fraction::fromDouble(2.718281828459045, INT_MAX), Fraction(1032595833, 379870778));
+    ASSERT_EQ(Fraction::fromDouble(-7.0, 1), Fraction(-7));
+    ASSERT_EQ(Fraction::fromDouble(0.4, 1), Fraction(0));
+    ASSERT_EQ(Fraction::fromDouble(0.6, 1), Fraction(1));
+    ASSERT_THROW(Fraction::fromDouble(0.5, 0), std::invalid_argument);
+    ASSERT_THROW(Fraction::fromDouble(2147483647.75, 2), std::overflow_error);
+}
+
+TEST(ApproximationTest, fromDoubleTest03) {
+    // Values below 2^-11 whose exact denominator does not fit a word take the long division path
+    ASSERT_EQ(Fraction64::fromDouble(1e-18, LLONG_MAX), Fraction64(9, 8999999999999999356LL));
+    ASSERT_EQ(Fraction64::fromDouble(3e-19, LLONG_MAX), Fraction64(1, 3333333333333333416LL));
+    ASSERT_EQ(Fraction64::fromDouble(7e-19, LLONG_MAX), Fraction64(2, 2857142857142857017LL));
+    ASSERT_EQ(Fraction64::fromDouble(1e-25, LLONG_MAX), Fraction64(0));
+    ASSERT_EQ(Fraction::fromDouble(1e-300, 1000), Fraction(0));
+    ASSERT_EQ(Fraction::fromDouble(-0.0015, 1000), Fraction(-1, 667));
+    ASSERT_EQ(Fraction::fromDouble(0.0006, 1000), Fraction(1, 1000));
+    ASSERT_EQ(Fraction::fromDouble(std::ldexp(1.0, -20), 1 << 20), Fraction(1, 1 << 20));
+}
+
+TEST(ApproximationTest, limitDenominatorTest01) {
+    static_assert(Fraction(3, 7).limitDenominator(2) == Fraction(1, 2), "limitDenominator() is a constant expression");
+    ASSERT_EQ(Fraction(355, 113).limitDenominator(100), Fraction(311, 99));
+    ASSERT_EQ(Fraction(-355, 113).limitDenominator(100), Fraction(-311, 99));
+    ASSERT_EQ(Fraction(355, 113).limitDenominator(113), Fraction(355, 113));
+    ASSERT_EQ(Fraction(INT_MIN, 3).limitDenominator(1), Fraction(-715827883));
+    ASSERT_EQ(Fraction(INT_MAX, INT_MAX - 1).limitDenominator(1000), Fraction(1));
+    ASSERT_THROW(Fraction(1, 3).limitDenominator(-1), std::invalid_argument);
+
+    std::mt19937_64 rng(22);
+    std::uniform_int_distribution<long long> numerators(-1000000, 1000000), denominators(1, 1000000);
+    for (int i = 0; i < 200; ++i) {
+        Fraction64 value(numerators(rng), denominators(rng));
+        ASSERT_EQ(value.limitDenominator(60), bruteForce(value, 60)) << value;
+    }
+}
+
+TEST(ApproximationTest, fromDoubleTest04) {
+    std::mt19937_64 rng(1261);
+    std::uniform_real_distribution<double> values(-8.0, 8.0);
+    for (int i = 0; i < 200; ++i) {
+        double value = values(rng);
+        ASSERT_EQ(Fraction64::fromDouble(value, 150), bruteForce(Fraction64::fromDouble(value), 150)) << value;
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(ApproximationTest, batchTest01) {
+    std::vector<double> values = { 0.5, -0.2, 3.14159265358979, 0.001, 42.0 };
+    FractionArray64 exact = FractionArray64::fromDoubles(values.data(), values.size());
+    FractionArray64 bounded = FractionArray64::fromDoubles(values.data(), values.size(), 100);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(exact[i], Fraction64::fromDouble(values[i]));
+        ASSERT_EQ(bounded[i], Fraction64::fromDouble(values[i], 100));
+    }
+
+    FractionArray64::limitDenominator(exact, 100, exact);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(exact[i], bounded[i]);
+    ASSERT_THROW(FractionArray::fromDoubles(values.data(), values.size()), std::overflow_error);
+}
+#endif
@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+#include "BigFraction.h"
+#include <climits>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    std::string toString(const BigFraction& value) {
+        std::stringstream ss;
+        ss << value;
+        return ss.str();
+    }
+}
+
+TEST(BigIntegerTest, inlineTest01) {
+    BigInteger i1(LLONG_MAX);
+    BigInteger i2 = i1 + 1;
+
+    ASSERT_TRUE(i1.isSmall());
+    ASSERT_FALSE(i2.isSmall());
+    ASSERT_EQ(i2.toString(), "9223372036854775808");
+    ASSERT_TRUE((i2 - 1).isSmall());
+    ASSERT_EQ(i2 - 1, i1);
+    ASSERT_TRUE((-i2).isSmall());
+    ASSERT_EQ(-i2, BigInteger(LLONG_MIN));
+}
+
+TEST(BigIntegerTest, factorialTest01) {
+    BigInteger factorial(1);
+    for (int i = 2; i <= 30; ++i)
+        factorial = factorial * i;
+
+    ASSERT_EQ(factorial.toString(), "265252859812191058636308480000000");
+    for (int i = 30; i >= 2; --i)
+        factorial = factorial / i;
+    ASSERT_EQ(factorial, BigInteger(1));
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(BigIntegerTest, divisionTest01) {
+    std::mt19937_64 rng(1261);
+    for (int i = 0; i < 2000; ++i) {
+        __int128 a = static_cast<__int128>((static_cast<unsigned __int128>(rng() >> 2) << 64) | rng());
+        __int128 b = static_cast<__int128>((static_cast<unsigned __int128>(rng() >> (2 + rng() % 62)) << 64) | rng());
+        if (i % 2)
+            a = -a;
+
+        auto toBig = [](__int128 value) {
+            return BigInteger(static_cast<long long>(value >> 64)) * BigInteger(1LL << 32) * BigInteger(1LL << 32) + BigInteger(static_cast<long long>(static_cast<unsigned long long>(value) >> 1)) * 2 + static_cast<long long>(value & 1);
+        };
+        BigInteger quotient, remainder;
+        BigInteger::divMod(toBig(a), toBig(b), quotient, remainder);
+
+        ASSERT_EQ(quotient, toBig(a / b));
+        ASSERT_EQ(remainder, toBig(a % b));
+    }
+}
+
+TEST(BigIntegerTest, compoundTest01) {
+    std::mt19937_64 rng(1261);
+    auto toBig = [](__int128 value) {
+        return BigInteger(static_cast<long long>(value >> 64)) * BigInteger(1LL << 32) * BigInteger(1LL << 32) + BigInteger(static_cast<long long>(static_cast<unsigned long long>(value) >> 1)) * 2 + static_cast<long long>(value & 1);
+    };
+    for (int i = 0; i < 2000; ++i) {
+        // Mix inline and large values of either sign, so that sums cross between the two representations
+        __int128 a = static_cast<__int128>(static_cast<long long>(rng())) * (static_cast<__int128>(1) << (rng() % 60));
+        __int128 b = static_cast<__int128>(static_cast<long long>(rng())) * (static_cast<__int128>(1) << (rng() % 60));
+        BigInteger x = toBig(a);
+        BigInteger y = toBig(b);
+
+        BigInteger sum = x;
+        sum += y;
+        ASSERT_EQ(sum, toBig(a + b));
+        ASSERT_EQ(sum, x + y);
+        ASSERT_EQ(BigInteger(x) + y, x + y);
+        BigInteger difference = x;
+        difference -= y;
+        ASSERT_EQ(difference, toBig(a - b));
+        ASSERT_EQ(BigInteger(x) - y, x - y);
+        ASSERT_EQ(sum -= y, x);
+    }
+
+    BigInteger x = toBig(static_cast<__int128>(1) << 100);
+    x += x;
+    ASSERT_EQ(x, toBig(static_cast<__int128>(1) << 101));
+    x -= x;
+    ASSERT_EQ(x, BigInteger(0));
+    ASSERT_TRUE(x.isSmall());
+}
+#endif
+
+TEST(BigFractionTest, constructTest01) {
+    BigFraction f1(8, -22);
+    BigFraction f2(-4, 11);
+
+    ASSERT_EQ(f1, f2);
+    ASSERT_TRUE(f1.isSmall());
+    ASSERT_EQ(BigFraction(Fraction(6, 8)), BigFraction(3, 4));
+}
+
+TEST(BigFractionTest, overflowTest01) {
+    // The harmonic number H(40) has a 17 digit denominator, well past where Fraction overflows
+    BigFraction sum(0);
+    for (int i = 1; i <= 40; ++i)
+        sum += BigFraction(1, i);
+
+    ASSERT_EQ(toString(sum), "2078178381193813/485721041551200");
+    ASSERT_LT(sum, 5);
+    ASSERT_GT(sum, 4);
+}
+
+TEST(BigFractionTest, overflowTest02) {
+    BigFraction f1(LLONG_MAX, 3);
+    BigFraction f2 = f1 * f1;
+
+    ASSERT_FALSE(f2.isSmall());
+    ASSERT_EQ(toString(f2), "85070591730234615847396907784232501249/9");
+    ASSERT_EQ(f2 / f1, f1);
+    ASSERT_TRUE((f2 / f1).isSmall());
+    ASSERT_EQ(f2 - f2, BigFraction(0));
+}
+
+TEST(BigFractionTest, operatorTest01) {
+    BigFraction f1(1, -2);
+    BigFraction f2(-3, 4);
+
+    ASSERT_EQ(f1 + f2, BigFraction(-5, 4));
+    ASSERT_EQ(f1 - f2, BigFraction(1, 4));
+    ASSERT_EQ(f1 * f2, BigFraction(3, 8));
+    ASSERT_EQ(f1 / f2, BigFraction(2, 3));
+    ASSERT_EQ(f1 + 3, BigFraction(5, 2));
+    ASSERT_EQ(-3 / f1, BigFraction(6));
+    ASSERT_LT(f2, f1);
+    ASSERT_GE(0, f1);
+}
+
+TEST(BigFractionTest, compoundTest01) {
+    BigFraction f1(LLONG_MAX, 3);
+    BigFraction f2(5, LLONG_MAX - 1);
+    BigFraction f3(-7, 6);
+
+    BigFraction f4 = f1;
+    (f4 += f2) *= f3;
+    ASSERT_EQ(f4, (f1 + f2) * f3);
+    ASSERT_EQ((BigFraction(f1) -= f2) /= f3, (f1 - f2) / f3);
+    ASSERT_EQ(BigFraction(f1) + f2, f1 + f2);
+    ASSERT_EQ(f1 + BigFraction(f2), f1 + f2);
+    ASSERT_EQ(f3 * (f1 * f2), f1 * f2 * f3);
+    ASSERT_EQ(BigFraction(f1) - 4 + f2 * 2, f1 - 4 + 2 * f2);
+    ASSERT_EQ(3 + BigFraction(f2) / 5, BigFraction(3) + f2 / BigFraction(5));
+
+    BigFraction f5 = f1 * f1;
+    f5 += f5;
+    ASSERT_EQ(f5, f1 * f1 * 2);
+    f5 /= f5;
+    ASSERT_EQ(f5, BigFraction(1));
+    f5 -= f5;
+    ASSERT_EQ(f5, BigFraction(0));
+}
+
+TEST(BigFractionTest, isTest01) {
+    BigFraction f1;
+    std::istringstream si(std::string("170141183460469231731687303715884105727 /     -22"));
+    si >> f1;
+
+    ASSERT_EQ(toString(f1), "-170141183460469231731687303715884105727/22");
+}
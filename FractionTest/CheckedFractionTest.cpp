@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include "CheckedFraction.h"
+#include <climits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+TEST(CheckedFractionTest, overflowsTest01) {
+    int result;
+
+    ASSERT_FALSE(checked::addOverflows(INT_MAX - 1, 1, result));
+    ASSERT_EQ(result, INT_MAX);
+    ASSERT_TRUE(checked::addOverflows(INT_MAX, 1, result));
+    ASSERT_TRUE(checked::subtractOverflows(0, INT_MIN, result));
+    ASSERT_FALSE(checked::multiplyOverflows(-46340, 46340, result));
+    ASSERT_TRUE(checked::multiplyOverflows(46341, 46341, result));
+    ASSERT_TRUE(checked::fits<int>(BigInteger(INT_MIN)));
+    ASSERT_FALSE(checked::fits<int>(BigInteger(INT_MAX) + 1));
+}
+
+TEST(CheckedFractionTest, arithmeticTest01) {
+    std::mt19937 rng(1261);
+    std::uniform_int_distribution<int> numerators(-1000, 1000);
+    std::uniform_int_distribution<int> denominators(1, 1000);
+    for (int i = 0; i < 2000; ++i) {
+        Fraction a(numerators(rng), denominators(rng));
+        Fraction b(numerators(rng), denominators(rng));
+        int n = numerators(rng);
+        CheckedFraction ca(a), cb(b);
+
+        ASSERT_EQ((ca + cb).toFraction(), a + b);
+        ASSERT_EQ((ca - cb).toFraction(), a - b);
+        ASSERT_EQ((ca * cb).toFraction(), a * b);
+        ASSERT_EQ((ca + n).toFraction(), a + n);
+        ASSERT_EQ((n - ca).toFraction(), n - a);
+        ASSERT_EQ((n * cb).toFraction(), n * b);
+        if (b.getNumerator() != 0) {
+            ASSERT_EQ((ca / cb).toFraction(), a / b);
+        }
+        if (n != 0) {
+            ASSERT_EQ((ca / n).toFraction(), a / n);
+        }
+    }
+}
+
+TEST(CheckedFractionTest, crossReduceTest01) {
+    // The unreduced products overflow, the results do not
+    CheckedFraction f1(INT_MAX, 2);
+    CheckedFraction f2(4, INT_MAX);
+    CheckedFraction f3(1, INT_MAX - 1);
+
+    ASSERT_EQ(f1 * f2, CheckedFraction(2));
+    ASSERT_EQ(f2 / f2, CheckedFraction(1));
+    ASSERT_EQ(f3 + f3, CheckedFraction(2, INT_MAX - 1));
+    ASSERT_EQ(f1 - f1, CheckedFraction(0));
+    ASSERT_EQ(CheckedFraction(INT_MIN, 3) * 3, CheckedFraction(INT_MIN));
+}
+
+TEST(CheckedFractionTest, throwTest01) {
+    CheckedFraction f1(INT_MAX, 2);
+    CheckedFraction f2(1, INT_MAX);
+
+    ASSERT_THROW(f1 * f1, std::overflow_error);
+    ASSERT_THROW(f1 + 1, std::overflow_error);
+    ASSERT_THROW(f2 + CheckedFraction(1, INT_MAX - 1), std::overflow_error);
+    ASSERT_THROW(CheckedFraction(INT_MIN) / -1, std::overflow_error);
+    ASSERT_THROW(f1 / 0, std::domain_error);
+    ASSERT_THROW(f1 /= CheckedFraction(0), std::domain_error);
+    ASSERT_THROW(f1 *= 3, std::overflow_error);
+    ASSERT_EQ(f1, CheckedFraction(INT_MAX, 2));
+}
+
+TEST(CheckedFractionTest, saturateTest01) {
+    SaturatingFraction f1(INT_MAX, 2);
+    SaturatingFraction f2(1, INT_MAX);
+
+    ASSERT_EQ(f1 * f1, SaturatingFraction(INT_MAX));
+    ASSERT_EQ(f1 * -f1.getNumerator(), SaturatingFraction(-INT_MAX));
+    ASSERT_EQ(f2 + SaturatingFraction(1, INT_MAX - 1), SaturatingFraction(2, INT_MAX));
+    f1 += f1;
+    ASSERT_EQ(f1, SaturatingFraction(INT_MAX));
+}
+
+TEST(CheckedFractionTest, promoteTest01) {
+    PromotingFraction f1(INT_MAX, 2);
+    BigFraction square = f1 * f1;
+    BigFraction small = f1 * 2;
+
+    ASSERT_EQ(square, BigFraction(INT_MAX) * BigFraction(INT_MAX) / 4);
+    ASSERT_FALSE(checked::fits<int>(square.getNumerator()));
+    ASSERT_EQ(small, BigFraction(INT_MAX));
+    f1 *= 2;
+    ASSERT_EQ(f1, PromotingFraction(INT_MAX));
+    ASSERT_THROW(f1 *= f1, std::overflow_error);
+}
+
+TEST(CheckedFractionTest, wideTest01) {
+    CheckedFraction64 f1(INT64_MAX, 3);
+    std::ostringstream out;
+    out << f1 * CheckedFraction64(3, INT64_MAX);
+
+    ASSERT_EQ(out.str(), "1/1");
+    ASSERT_THROW(f1 * 4, std::overflow_error);
+    ASSERT_EQ(f1 - f1 + 1, CheckedFraction64(1));
+}
@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+TEST(CompareTest, compareTest01) {
+    Fraction f1(8, 22);
+    Fraction f2(5, 11);
+
+    ASSERT_LT(f1.compare(f2), 0);
+    ASSERT_GT(f2.compare(f1), 0);
+    ASSERT_EQ(f1.compare(Fraction(4, 11)), 0);
+}
+
+TEST(CompareTest, compareTest02) {
+    Fraction f1(-1, 3);
+    Fraction f2(0, 5);
+
+    ASSERT_LT(f1, f2);
+    ASSERT_LT(f2, 1);
+    ASSERT_GT(0, f1);
+    ASSERT_LE(f2, 0);
+    ASSERT_GE(0, f2);
+}
+
+TEST(CompareTest, overflowTest01) {
+    // Cross products of these do not fit into an int
+    Fraction f1(INT_MAX - 1, INT_MAX);
+    Fraction f2(INT_MAX - 2, INT_MAX - 1);
+
+    ASSERT_GT(f1, f2);
+    ASSERT_LT(f2, f1);
+    ASSERT_LT(f1, 1);
+    ASSERT_GT(1, f2);
+    ASSERT_LT(INT_MIN, Fraction(INT_MIN + 1));
+}
+
+TEST(CompareTest, sortTest01) {
+    std::vector<Fraction> fractions = { Fraction(3, 4), Fraction(-1, 2), Fraction(2, 3), Fraction(0), Fraction(5, 7), Fraction(-2, 3) };
+    std::sort(fractions.begin(), fractions.end());
+    std::vector<Fraction> expectedResult = { Fraction(-2, 3), Fraction(-1, 2), Fraction(0), Fraction(2, 3), Fraction(5, 7), Fraction(3, 4) };
+
+    ASSERT_EQ(fractions, expectedResult);
+}
@@ -0,0 +1,14 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+
+TEST(CompoundTest, chainTest01) {
+    Fraction f1(1, 2);
+    Fraction f2(2, 3);
+
+    ((f1 += f2) -= 1) *= 6;
+    Fraction expectedResult(1);
+
+    ASSERT_EQ(f1, expectedResult);
+    ASSERT_EQ((f2 /= 2) += 1, Fraction(4, 3));
+    ASSERT_EQ(&(f2 *= 3), &f2);
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include <climits>
+#include <ratio>
+
+using namespace fraction_literals;
+
+// Everything below is checked by the compiler; the tests repeat it at runtime
+constexpr Fraction kThird(1, 3);
+constexpr Fraction kSixth = kThird / 2;
+static_assert(kThird + kSixth == Fraction(1, 2), "constant sum");
+static_assert(kThird - Fraction(2, 3) == Fraction(-1, 3), "constant difference");
+static_assert(kThird * Fraction(3, -4) == Fraction(-1, 4), "constant product");
+static_assert(kSixth / kThird == Fraction(1, 2), "constant quotient");
+static_assert(Fraction(6, -8).getNumerator() == -3 && Fraction(6, -8).getDenominator() == 4, "constant reduce");
+static_assert(kSixth < kThird && kThird >= kSixth && 1 > kThird && kThird.compare(kThird) == 0, "constant compare");
+static_assert(3_r / 4 == Fraction(3, 4), "fraction literal");
+static_assert(1'000_r / 3 == Fraction(1000, 3), "digit separators");
+static_assert(4'000'000'000_r64 / 6 == Fraction64(2000000000, 3), "64 bit literal");
+static_assert(017_r == Fraction(15) && 0_r == Fraction(0), "a leading zero is octal, as for int literals");
+static_assert(0x7FFF'FFFF_r == Fraction(INT_MAX) && 0b1010_r64 / 0XC == Fraction64(5, 6), "hexadecimal and binary literals");
+static_assert(fractionLiteralValue<int, '0', '8'>() == -1 && fractionLiteralValue<int, '0', 'x', '8', '0', '0', '0', '0', '0', '0', '0'>() == -1,
+    "digits outside the base and values past IntT are rejected");
+static_assert(Fraction(std::milli()) == Fraction(1, 1000), "std::ratio");
+static_assert(Fraction64(std::ratio<-6, 4>()) == Fraction64(-3, 2), "negative std::ratio");
+
+/**
+*	Sums the first n unit fractions in a constant expression, exercising the compound operators.
+*/
+constexpr Fraction harmonic(int n) {
+    Fraction sum(0);
+    for (int i = 1; i <= n; ++i)
+        sum += Fraction(1, i);
+    return sum;
+}
+
+TEST(ConstexprTest, constantTest01) {
+    constexpr Fraction h = harmonic(10);
+    static_assert(h == Fraction(7381, 2520), "H(10)");
+
+    ASSERT_EQ(harmonic(10), h);
+    ASSERT_EQ(kThird + kSixth, Fraction(1, 2));
+    ASSERT_EQ(kThird * Fraction(3, -4), Fraction(-1, 4));
+}
+
+TEST(ConstexprTest, literalTest01) {
+    constexpr Fraction f = 3_r / 4 + 1_r / 4;
+    static_assert(f == 1, "3/4 + 1/4");
+
+    ASSERT_EQ(f, Fraction(1));
+    ASSERT_EQ(2147483647_r / 2, Fraction(INT_MAX, 2));
+    ASSERT_EQ(0_r, Fraction(0));
+    ASSERT_EQ(9'223'372'036'854'775'807_r64 / 7, Fraction64(INT64_MAX, 7));
+    ASSERT_EQ(017_r, Fraction(15));
+    ASSERT_EQ(0x1F_r64, Fraction64(31));
+    ASSERT_EQ(0b1010_r / 4, Fraction(5, 2));
+}
+
+TEST(ConstexprTest, ratioTest01) {
+    constexpr Fraction64 nano = std::nano();
+    using Mixed = std::ratio_add<std::ratio<1, 3>, std::ratio<1, 6>>;
+    static_assert(Fraction(Mixed()) == Fraction(1, 2), "ratio_add");
+
+    ASSERT_EQ(nano, Fraction64(1, 1000000000));
+    ASSERT_EQ(Fraction(std::kilo()) * Fraction(std::milli()), Fraction(1));
+    ASSERT_EQ(Fraction(std::ratio<3, 9>()), kThird);
+}
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+#include "BigFraction.h"
+#include "FractionArray.h"
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // The exact value of a finite double, as mantissa * 2^exponent
+    BigFraction exactly(double value) {
+        int exponent;
+        double fraction = std::frexp(value, &exponent);
+        long long mantissa = static_cast<long long>(std::ldexp(fraction, 53));
+        exponent -= 53;
+        BigInteger scale(1);
+        for (int i = 0; i < std::abs(exponent); ++i)
+            scale *= BigInteger(2);
+        if (exponent >= 0)
+            return BigFraction(BigInteger(mantissa) * scale, BigInteger(1));
+        return BigFraction(BigInteger(mantissa), scale);
+    }
+
+    BigFraction distance(const BigFraction& lhs, const BigFraction& rhs) {
+        BigFraction difference = lhs - rhs;
+        return difference < 0 ? -1 * difference : difference;
+    }
+
+    // True if value is the double or float closest to exact, ties to an even significand
+    template <typename Float>
+    bool correctlyRounded(const BigFraction& exact, Float value) {
+        BigFraction error = distance(exact, exactly(value));
+        for (Float neighbour : { std::nextafter(value, -std::numeric_limits<Float>::infinity()), std::nextafter(value, std::numeric_limits<Float>::infinity()) }) {
+            BigFraction other = distance(exact, exactly(neighbour));
+            if (other < error)
+                return false;
+            if (other == error) {
+                int exponent;
+                Float fraction = std::frexp(value, &exponent);
+                if (static_cast<long long>(std::ldexp(fraction, std::numeric_limits<Float>::digits)) % 2 != 0)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+TEST(ConversionTest, toDoubleTest01) {
+    ASSERT_EQ(Fraction(3, 4).toDouble(), 0.75);
+    ASSERT_EQ(Fraction(-1, 3).toDouble(), -1.0 / 3);
+    ASSERT_EQ(Fraction(0).toDouble(), 0.0);
+    ASSERT_EQ(Fraction(1, 3).toFloat(), 1.0f / 3);
+    // Halfway between two floats: ties go to the even significand
+    ASSERT_EQ(Fraction(16777217).toFloat(), 16777216.0f);
+    ASSERT_EQ(Fraction(16777219).toFloat(), 16777220.0f);
+    ASSERT_EQ(Fraction64((1LL << 53) + 1).toDouble(), 9007199254740992.0);
+    ASSERT_EQ(Fraction64((1LL << 53) + 3).toDouble(), 9007199254740996.0);
+    ASSERT_EQ(Fraction64((1LL << 60) + 1, 1LL << 60).toDouble(), 1.0);
+    ASSERT_EQ(Fraction64(LLONG_MIN, 1).toDouble(), -9223372036854775808.0);
+    ASSERT_EQ(Fraction64(LLONG_MAX, LLONG_MAX - 1).toDouble(), 1.0);
+    ASSERT_TRUE(std::isinf(Fraction(1, 0).toDouble()));
+}
+
+TEST(ConversionTest, toDoubleTest02) {
+    std::mt19937_64 rng(23);
+    std::uniform_int_distribution<long long> numerators(LLONG_MIN, LLONG_MAX), denominators(1, LLONG_MAX);
+    std::uniform_int_distribution<int> shifts(0, 62);
+    for (int i = 0; i < 300; ++i) {
+        Fraction64 value(numerators(rng) >> shifts(rng), denominators(rng) >> shifts(rng));
+        BigFraction exact(value);
+        ASSERT_TRUE(correctlyRounded(exact, value.toDouble())) << value;
+        ASSERT_TRUE(correctlyRounded(exact, value.toFloat())) << value;
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(ConversionTest, toDoubleTest03) {
+    const __int128 one = 1;
+    ASSERT_EQ(Fraction128(1, 3).toDouble(), 1.0 / 3);
+    ASSERT_EQ(Fraction128((one << 100) + 1, one << 100).toDouble(), 1.0);
+    ASSERT_EQ(Fraction128((one << 120) + (one << 67), 1).toDouble(), std::ldexp(1.0, 120));
+    ASSERT_EQ(Fraction128((one << 120) + (one << 67) + 1, 1).toDouble(), std::ldexp(1.0, 120) + std::ldexp(1.0, 68));
+    // Below the normal floats, fewer significand bits are kept: 2^-125 / 3 is 5592405.33 times the smallest float
+    ASSERT_EQ(Fraction128(1, (one << 126) + 1).toFloat(), std::numeric_limits<float>::min());
+    ASSERT_EQ(Fraction128(1, 3 * (one << 125)).toFloat(), std::ldexp(5592405.0f, -149));
+}
+#endif
+
+TEST(ConversionTest, roundingTest01) {
+    static_assert(Fraction(-7, 2).floor() == -4 && Fraction(-7, 2).ceil() == -3 && Fraction(-7, 2).trunc() == -3, "integer rounding is a constant expression");
+    ASSERT_EQ(Fraction(7, 2).floor(), 3);
+    ASSERT_EQ(Fraction(7, 2).ceil(), 4);
+    ASSERT_EQ(Fraction(6).ceil(), 6);
+    ASSERT_EQ(Fraction(5, 2).roundHalfEven(), 2);
+    ASSERT_EQ(Fraction(7, 2).roundHalfEven(), 4);
+    ASSERT_EQ(Fraction(-5, 2).roundHalfEven(), -2);
+    ASSERT_EQ(Fraction(-7, 2).roundHalfEven(), -4);
+    ASSERT_EQ(Fraction(-8, 3).roundHalfEven(), -3);
+    ASSERT_EQ(Fraction(INT_MIN, 3).floor(), -715827883);
+    ASSERT_EQ(Fraction(INT_MAX, 2).roundHalfEven(), 1073741824);
+    ASSERT_EQ(Fraction64(LLONG_MAX, 2).ceil(), 4611686018427387904LL);
+    ASSERT_THROW(Fraction(1, 0).floor(), std::domain_error);
+
+    // Exact in double for 32-bit operands, so the floating point functions can serve as the reference
+    std::mt19937 rng(2323);
+    std::uniform_int_distribution<int> numerators(INT_MIN, INT_MAX), denominators(1, 1000);
+    for (int i = 0; i < 2000; ++i) {
+        Fraction value(numerators(rng) >> (i % 31), denominators(rng));
+        double real = static_cast<double>(value.getNumerator()) / value.getDenominator();
+        ASSERT_EQ(value.floor(), static_cast<int>(std::floor(real))) << value;
+        ASSERT_EQ(value.ceil(), static_cast<int>(std::ceil(real))) << value;
+        ASSERT_EQ(value.trunc(), static_cast<int>(std::trunc(real))) << value;
+        ASSERT_EQ(value.roundHalfEven(), static_cast<int>(std::nearbyint(real))) << value;
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(ConversionTest, batchTest01) {
+    std::vector<Fraction64> values = { Fraction64(7, 2), Fraction64(-7, 2), Fraction64(LLONG_MAX, 3), Fraction64(1, LLONG_MAX), Fraction64(0) };
+    FractionArray64 array(values);
+    std::vector<double> doubles(values.size());
+    std::vector<float> floats(values.size());
+    std::vector<std::int64_t> floors(values.size()), ceilings(values.size()), truncated(values.size()), rounded(values.size());
+    FractionArray64::toDoubles(array, doubles.data());
+    FractionArray64::toFloats(array, floats.data());
+    FractionArray64::floor(array, floors.data());
+    FractionArray64::ceil(array, ceilings.data());
+    FractionArray64::trunc(array, truncated.data());
+    FractionArray64::roundHalfEven(array, rounded.data());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(doubles[i], values[i].toDouble());
+        ASSERT_EQ(floats[i], values[i].toFloat());
+        ASSERT_EQ(floors[i], values[i].floor());
+        ASSERT_EQ(ceilings[i], values[i].ceil());
+        ASSERT_EQ(truncated[i], values[i].trunc());
+        ASSERT_EQ(rounded[i], values[i].roundHalfEven());
+    }
+
+    FractionArray small(std::vector<Fraction>{ Fraction(1, 3), Fraction(-2, 7) });
+    std::vector<double> smallDoubles(2);
+    FractionArray::toDoubles(small, smallDoubles.data());
+    ASSERT_EQ(smallDoubles[0], 1.0 / 3);
+    ASSERT_EQ(smallDoubles[1], -2.0 / 7);
+}
+#endif
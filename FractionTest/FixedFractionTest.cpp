@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include "FixedFraction.h"
+#include <climits>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+using Cents = FixedFraction<100>;
+using Ticks = FixedFraction64<std::int64_t(1) << 20>;
+
+// Same denominator arithmetic and comparison stay fixed, and run at compile time
+static_assert((Cents::fromUnits(1999) + Cents::fromUnits(1)).units() == 2000, "fixed sums add units");
+static_assert((Cents(3) - Cents::fromUnits(50)).units() == 250, "integers scale into units");
+static_assert(Cents::fromUnits(101) > 1 && 1 < Cents::fromUnits(101), "integers compare in units");
+static_assert(Cents::fromUnits(2000000000) < 30000000, "integers compare without overflowing units");
+static_assert(BasicFraction<int>(Cents::fromUnits(250)) == Fraction(5, 2), "widening reduces");
+static_assert(std::is_same<decltype(Cents() + 1), Cents>::value, "integer operands keep the fixed type");
+static_assert(std::is_same<decltype(2 * Cents()), Cents>::value, "integer products keep the fixed type");
+static_assert(std::is_same<decltype(Cents() + Fraction(1, 3)), Fraction>::value, "general fractions widen");
+static_assert(std::is_same<decltype(Fraction(1, 3) - Cents()), Fraction>::value, "general fractions widen");
+static_assert(std::is_same<decltype(Cents() + FixedFraction<8>()), Fraction>::value, "foreign denominators widen");
+static_assert(std::is_same<decltype(Cents() * Cents()), Fraction>::value, "fixed products are over Den squared");
+static_assert(std::is_same<decltype(Cents() / 3), Fraction>::value, "quotients widen");
+
+// Integers wider than the units are rejected rather than truncated
+template <typename L, typename R, typename = void> struct Comparable : std::false_type {};
+template <typename L, typename R>
+struct Comparable<L, R, std::void_t<decltype(std::declval<L>() < std::declval<R>())>> : std::true_type {};
+template <typename L, typename R, typename = void> struct Addable : std::false_type {};
+template <typename L, typename R>
+struct Addable<L, R, std::void_t<decltype(std::declval<L>() + std::declval<R>())>> : std::true_type {};
+
+static_assert(Comparable<Cents, short>::value && Comparable<Cents, int>::value, "narrower integers compare");
+static_assert(!Comparable<Cents, long long>::value && !Comparable<long long, Cents>::value, "wider integers do not compare");
+static_assert(!Comparable<Cents, unsigned>::value, "unsigned integers of the same size do not compare");
+static_assert(!Addable<Cents, long long>::value && !Addable<unsigned long long, Cents>::value, "wider integers do not add");
+static_assert(!std::is_convertible<long long, Cents>::value, "wider integers do not convert");
+static_assert(Comparable<Ticks, long long>::value && Addable<Ticks, int>::value, "64-bit units take 64-bit integers");
+
+TEST(FixedFractionTest, sameDenominatorTest01) {
+    Cents total;
+    for (int i = 1; i <= 100; ++i)
+        total += Cents::fromUnits(i);
+    EXPECT_EQ(5050, total.units());
+    EXPECT_EQ(Cents::fromUnits(5050), total);
+    EXPECT_EQ(Cents(50) + Cents::fromUnits(50), total);
+
+    total -= Cents(50);
+    EXPECT_EQ(50, total.units());
+    EXPECT_EQ(-50, (-total).units());
+    total *= 3;
+    EXPECT_EQ(150, total.units());
+    EXPECT_EQ(450, (total * 3).units());
+    EXPECT_EQ(450, (3 * total).units());
+    EXPECT_EQ(1, Cents::fromUnits(2).compare(Cents::fromUnits(1)));
+    EXPECT_EQ(0, Cents::fromUnits(2).compare(Cents::fromUnits(2)));
+    EXPECT_EQ(-1, Cents::fromUnits(1).compare(Cents::fromUnits(2)));
+    EXPECT_TRUE(Cents::fromUnits(100) == 1);
+    EXPECT_TRUE(2 != Cents::fromUnits(100));
+    EXPECT_TRUE(Cents::fromUnits(99) < 1 && Cents::fromUnits(100) <= 1 && Cents::fromUnits(101) >= 1);
+}
+
+TEST(FixedFractionTest, conversionTest02) {
+    EXPECT_EQ(75, Cents(Fraction(3, 4)).units());
+    EXPECT_EQ(-40, Cents(Fraction(-2, 5)).units());
+    EXPECT_EQ(700, Cents(Fraction(7)).units());
+    EXPECT_THROW(Cents(Fraction(1, 3)), std::domain_error);
+    EXPECT_THROW(Cents(Fraction(1, 0)), std::domain_error);
+    EXPECT_THROW(Cents(Fraction(30000000)), std::overflow_error);
+
+    EXPECT_EQ(Fraction(3, 4), Fraction(Cents::fromUnits(75)));
+    EXPECT_EQ(Fraction64(3, 1 << 18), Fraction64(Ticks::fromUnits(12)));
+    EXPECT_EQ(12, Ticks(Fraction64(3, 1 << 18)).units());
+
+    std::ostringstream text;
+    text << Cents::fromUnits(-250);
+    EXPECT_EQ("-5/2", text.str());
+}
+
+TEST(FixedFractionTest, roundedTest03) {
+    EXPECT_EQ(33, Cents::rounded(Fraction(1, 3)).units());
+    EXPECT_EQ(67, Cents::rounded(Fraction(2, 3)).units());
+    EXPECT_EQ(-33, Cents::rounded(Fraction(-1, 3)).units());
+    EXPECT_EQ(-67, Cents::rounded(Fraction(-2, 3)).units());
+    // Ties go to the even number of cents
+    EXPECT_EQ(12, Cents::rounded(Fraction(1, 8)).units());
+    EXPECT_EQ(38, Cents::rounded(Fraction(3, 8)).units());
+    EXPECT_EQ(-12, Cents::rounded(Fraction(-1, 8)).units());
+    EXPECT_EQ(-38, Cents::rounded(Fraction(-3, 8)).units());
+    EXPECT_EQ(75, Cents::rounded(Fraction(3, 4)).units());
+    EXPECT_THROW(Cents::rounded(Fraction(1, 0)), std::domain_error);
+    EXPECT_THROW(Cents::rounded(Fraction(2147483647, 7)), std::overflow_error);
+}
+
+TEST(FixedFractionTest, widenTest04) {
+    Cents price = Cents::fromUnits(1999);
+    EXPECT_EQ(Fraction(1999, 100) + Fraction(1, 3), price + Fraction(1, 3));
+    EXPECT_EQ(Fraction(1, 3) - Fraction(1999, 100), Fraction(1, 3) - price);
+    EXPECT_EQ(Fraction(1999, 300), price / 3);
+    EXPECT_EQ(Fraction(300, 1999), 3 / price);
+    EXPECT_EQ(Fraction(1999, 200), price * Fraction(1, 2));
+    EXPECT_EQ(Fraction(1999 * 1999, 10000), price * price);
+    EXPECT_EQ(Fraction(1), price / price);
+    EXPECT_EQ(Fraction(1999, 100) + Fraction(3, 8), price + FixedFraction<8>::fromUnits(3));
+
+    EXPECT_TRUE(price > Fraction(19, 1));
+    EXPECT_TRUE(Fraction(20) > price);
+    EXPECT_TRUE(price == Fraction(1999, 100));
+    EXPECT_TRUE(FixedFraction<2>::fromUnits(1) == FixedFraction<4>::fromUnits(2));
+    EXPECT_TRUE(FixedFraction<3>::fromUnits(1) < FixedFraction<4>::fromUnits(2));
+    EXPECT_FALSE(FixedFraction<3>::fromUnits(1) >= FixedFraction<4>::fromUnits(2));
+}
+
+TEST(FixedFractionTest, matchesFractionTest05) {
+    // A ledger of mixed sign postings sums to the same value either way
+    Fraction64 general(0);
+    FixedFraction64<1000> fixed;
+    for (std::int64_t i = 0; i < 5000; ++i) {
+        std::int64_t units = (i * 7919) % 200001 - 100000;
+        general += Fraction64(units, 1000);
+        fixed += FixedFraction64<1000>::fromUnits(units);
+        ASSERT_EQ(general, Fraction64(fixed));
+        ASSERT_EQ(general < 0, fixed < 0);
+    }
+}
+
+TEST(FixedFractionTest, wholeComparisonTest06) {
+    // 30000000 is more cents than an int holds, so the integer must not be scaled into units
+    EXPECT_TRUE(Cents::fromUnits(2000000000) < 30000000);
+    EXPECT_TRUE(30000000 > Cents::fromUnits(2000000000));
+    EXPECT_TRUE(Cents::fromUnits(-2000000000) > -30000000);
+    EXPECT_FALSE(Cents::fromUnits(2000000000) == 20000000 + 1);
+    EXPECT_TRUE(Cents::fromUnits(2000000000) == 20000000);
+    EXPECT_TRUE(Cents::fromUnits(-150) < -1 && Cents::fromUnits(-150) > -2 && Cents::fromUnits(-100) <= -1);
+    EXPECT_TRUE(Cents::fromUnits(INT_MIN) < INT_MIN / 100 && Cents::fromUnits(INT_MAX) > INT_MAX / 100);
+    EXPECT_TRUE(Ticks::fromUnits(INT64_MAX) != INT64_MAX && Ticks::fromUnits(INT64_MAX) < INT64_MAX);
+    // Wider than the int units of Cents, but not of Ticks
+    EXPECT_TRUE(Ticks(5) < 3000000000LL && Ticks(5) != 4294967301LL);
+    EXPECT_EQ(Ticks(5) + 4294967296LL, Ticks(4294967301LL));
+}
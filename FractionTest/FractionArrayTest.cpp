@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include "FractionArray.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<Fraction> randomFractions(std::size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> numerators(-5000, 5000);
+        std::uniform_int_distribution<int> denominators(-300, 300);
+        std::vector<Fraction> fractions;
+        for (std::size_t i = 0; i < count; ++i) {
+            int denominator = denominators(rng);
+            fractions.emplace_back(numerators(rng), denominator == 0 ? 1 : denominator);
+        }
+        return fractions;
+    }
+}
+
+TEST(FractionArrayTest, containerTest01) {
+    FractionArray array;
+    array.push_back(Fraction(8, 22));
+    array.push_back(Fraction(3, -6));
+
+    ASSERT_EQ(array.size(), 2u);
+    ASSERT_EQ(array[0], Fraction(4, 11));
+    ASSERT_EQ(array.numerators()[1], -1);
+    ASSERT_EQ(array.denominators()[1], 2);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.numerators()) % 64, 0u);
+
+    array.set(0, Fraction(7));
+    ASSERT_EQ(array.toVector(), std::vector<Fraction>({ Fraction(7), Fraction(-1, 2) }));
+}
+
+TEST(FractionArrayTest, arithmeticTest01) {
+    auto lhs = randomFractions(1000, 1);
+    auto rhs = randomFractions(1000, 2);
+    FractionArray a(lhs);
+    FractionArray b(rhs);
+
+    FractionArray sum = a + b;
+    FractionArray difference = a - b;
+    FractionArray product = a * b;
+    FractionArray quotient = a / b;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_EQ(sum[i], lhs[i] + rhs[i]);
+        ASSERT_EQ(difference[i], lhs[i] - rhs[i]);
+        ASSERT_EQ(product[i], lhs[i] * rhs[i]);
+        if (rhs[i] != Fraction(0)) {
+            ASSERT_EQ(quotient[i], lhs[i] / rhs[i]);
+        }
+    }
+}
+
+TEST(FractionArrayTest, arithmeticTest02) {
+    auto lhs = randomFractions(1000, 3);
+    FractionArray a(lhs);
+    FractionArray remainder;
+    FractionArray::subtract(-7, a, remainder);
+    FractionArray inverse;
+    FractionArray::divide(3, a, inverse);
+
+    FractionArray sum = a + 5;
+    FractionArray difference = a - 5;
+    FractionArray product = a * -6;
+    FractionArray quotient = a / -6;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_EQ(sum[i], lhs[i] + 5);
+        ASSERT_EQ(difference[i], lhs[i] - 5);
+        ASSERT_EQ(product[i], lhs[i] * -6);
+        ASSERT_EQ(quotient[i], lhs[i] / -6);
+        ASSERT_EQ(remainder[i], -7 - lhs[i]);
+        if (lhs[i] != Fraction(0)) {
+            ASSERT_EQ(inverse[i], 3 / lhs[i]);
+        }
+    }
+}
+
+TEST(FractionArrayTest, aliasTest01) {
+    auto values = randomFractions(700, 4);
+    FractionArray a(values);
+    FractionArray::multiply(a, a, a);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(a[i], values[i] * values[i]);
+}
+
+TEST(FractionArrayTest, compareTest01) {
+    auto lhs = randomFractions(1000, 5);
+    auto rhs = randomFractions(1000, 6);
+    lhs[0] = rhs[0];
+    FractionArray a(lhs);
+    FractionArray b(rhs);
+
+    std::vector<std::int8_t> order(lhs.size());
+    FractionArray::Mask equal, less, greater, lessInt;
+    FractionArray::compare(a, b, order.data());
+    FractionArray::equal(a, b, equal);
+    FractionArray::less(a, b, less);
+    FractionArray::greater(a, b, greater);
+    FractionArray::less(a, 2, lessInt);
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        ASSERT_EQ(order[i], lhs[i].compare(rhs[i]));
+        ASSERT_EQ(equal[i] != 0, lhs[i] == rhs[i]);
+        ASSERT_EQ(less[i] != 0, lhs[i] < rhs[i]);
+        ASSERT_EQ(greater[i] != 0, lhs[i] > rhs[i]);
+        ASSERT_EQ(lessInt[i] != 0, lhs[i] < 2);
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(FractionArrayTest, wideTest01) {
+    FractionArray64 a(std::vector<Fraction64>({ Fraction64(INT64_MAX, 3), Fraction64(-5, 7) }));
+    FractionArray64 b(std::vector<Fraction64>({ Fraction64(3, INT64_MAX), Fraction64(7, 5) }));
+    FractionArray64 product = a * b;
+
+    ASSERT_EQ(product[0], Fraction64(1));
+    ASSERT_EQ(product[1], Fraction64(-1));
+}
+#endif
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+#include "CheckedFraction.h"
+#include "FractionCounters.h"
+#include <climits>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using counters::Counter;
+
+// Counts are only made when the library is built with FRACTION_COUNTERS=1; otherwise every one stays at zero
+TEST(FractionCountersTest, countTest01) {
+    counters::Snapshot before = counters::snapshot();
+    Fraction a(2, -4);
+    Fraction b(1, 5);
+    Fraction sum = a + b;
+    Fraction product = a * b;
+    bool equal = sum == product;
+    counters::Snapshot counts = counters::snapshot() - before;
+
+    ASSERT_FALSE(equal);
+    if (counters::kEnabled) {
+        ASSERT_EQ(counts[Counter::Add], 1u);
+        ASSERT_EQ(counts[Counter::Multiply], 1u);
+        ASSERT_EQ(counts[Counter::Subtract], 0u);
+        ASSERT_EQ(counts[Counter::Equal], 1u);
+        ASSERT_EQ(counts[Counter::ThreeWay], 0u);
+        ASSERT_GE(counts[Counter::Construction], 4u);
+        ASSERT_GE(counts[Counter::Reduce], 2u);
+        ASSERT_GE(counts[Counter::SignFlip], 1u);
+        ASSERT_GE(counts[Counter::Gcd], 2u);
+        ASSERT_GE(counts[Counter::GcdIteration], counts[Counter::Gcd] / 2);
+    }
+    else {
+        for (std::uint64_t value : counts.values)
+            ASSERT_EQ(value, 0u);
+    }
+}
+
+TEST(FractionCountersTest, countTest02) {
+    // Counts made by threads that have exited are kept
+    counters::Snapshot before = counters::snapshot();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            Fraction value(1);
+            for (int i = 2; i <= 101; ++i)
+                value /= i;
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    CheckedFraction big(INT_MAX);
+    ASSERT_THROW(big * 2, std::overflow_error);
+    counters::Snapshot counts = counters::snapshot() - before;
+
+    ASSERT_EQ(counts[Counter::DivideAssignInteger], counters::kEnabled ? 400u : 0u);
+    ASSERT_EQ(counts[Counter::Divide], 0u);
+    ASSERT_EQ(counts[Counter::Overflow], counters::kEnabled ? 1u : 0u);
+}
+
+TEST(FractionCountersTest, overloadTest01) {
+    // Each overload counts under its own counter, and compound assignments do not also count the binary operator
+    counters::Snapshot before = counters::snapshot();
+    Fraction value(1, 2);
+    value += Fraction(1, 3);
+    value += 2;
+    value = 3 + value;
+    value -= Fraction(1, 7);
+    value *= 2;
+    bool less = value < 4 || 4 > value;
+    int order = value.compare(Fraction(1));
+    counters::Snapshot counts = counters::snapshot() - before;
+
+    ASSERT_FALSE(less);
+    ASSERT_EQ(order, 1);
+    std::uint64_t expected = counters::kEnabled ? 1u : 0u;
+    ASSERT_EQ(counts[Counter::AddAssign], expected);
+    ASSERT_EQ(counts[Counter::AddAssignInteger], expected);
+    ASSERT_EQ(counts[Counter::AddInteger], expected);
+    ASSERT_EQ(counts[Counter::SubtractAssign], expected);
+    ASSERT_EQ(counts[Counter::MultiplyAssignInteger], expected);
+    ASSERT_EQ(counts[Counter::Less], expected);
+    ASSERT_EQ(counts[Counter::Greater], expected);
+    ASSERT_EQ(counts[Counter::ThreeWay], expected);
+    ASSERT_EQ(counts[Counter::Add], 0u);
+    ASSERT_EQ(counts[Counter::Subtract], 0u);
+    ASSERT_EQ(counts[Counter::Multiply], 0u);
+}
+
+TEST(FractionCountersTest, dumpTest01) {
+    counters::Snapshot counts{};
+    counts.values[static_cast<std::size_t>(Counter::Gcd)] = 4;
+    counts.values[static_cast<std::size_t>(Counter::GcdIteration)] = 10;
+    std::ostringstream out;
+    counters::dump(out, counts);
+
+    ASSERT_NE(out.str().find("gcd iteration             10\n"), std::string::npos);
+    ASSERT_NE(out.str().find("gcd mean depth            2.5\n"), std::string::npos);
+    ASSERT_STREQ(counters::name(Counter::SignFlip), "sign flip");
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include "FractionExpression.h"
+#include <climits>
+#include <random>
+
+using fused::fuse;
+
+TEST(FractionExpressionTest, fuseTest01) {
+    std::mt19937 rng(1261);
+    // Small enough that none of the temporaries of the ordinary operators overflow
+    std::uniform_int_distribution<int> numerators(-100, 100);
+    std::uniform_int_distribution<int> denominators(1, 100);
+    for (int i = 0; i < 2000; ++i) {
+        Fraction a(numerators(rng), denominators(rng)), b(numerators(rng), denominators(rng));
+        Fraction c(numerators(rng), denominators(rng)), d(numerators(rng), denominators(rng));
+        Fraction e(numerators(rng), denominators(rng)), f(numerators(rng) | 1, denominators(rng));
+        int n = numerators(rng);
+
+        Fraction fused = fuse(a) * b + c * d - e / f;
+        ASSERT_EQ(fused, a * b + c * d - e / f);
+        Fraction mixed = n * fuse(a) - b / 3 + 2;
+        ASSERT_EQ(mixed, n * a - b / 3 + 2);
+        ASSERT_EQ(fused::evaluate(fuse(a) + b), a + b);
+        ASSERT_EQ(fused::evaluate(fuse(a) - a), Fraction(0));
+    }
+}
+
+TEST(FractionExpressionTest, fuseTest02) {
+    // Prices in cents over a common denominator add numerators only
+    Fraction price(1999, 100), fee(25, 100), discount(-150, 100);
+    Fraction total = fuse(price) * 3 + fee + discount;
+
+    ASSERT_EQ(total, Fraction(5872, 100));
+    ASSERT_EQ(fused::apply([](auto p, auto f) { return p / f; }, price, fee), Fraction(1999, 25));
+    ASSERT_EQ(fused::apply([](auto p, auto f, auto d) { return (p + f) * (p - d); }, price, fee, discount),
+        (price + fee) * (price - discount));
+}
+
+TEST(FractionExpressionTest, wideTest01) {
+    // Temporaries that overflow every accumulator fall back to the ordinary operators; the others must be exact
+    std::mt19937_64 rng(1261);
+    for (int i = 0; i < 2000; ++i) {
+        int shift = static_cast<int>(rng() % 62);
+        auto draw = [&]() { return static_cast<long long>(rng() >> (shift + 1)) - static_cast<long long>(rng() >> (shift + 1)); };
+        Fraction64 a(draw(), draw() | 1), b(draw(), draw() | 1), c(draw(), draw() | 1), d(draw() | 1, draw() | 1);
+        BigFraction exact = BigFraction(a) * BigFraction(b) + BigFraction(c) / BigFraction(d);
+        Fraction64 fused = fuse(a) * b + c / d;
+
+        if (checked::fits<long long>(exact.getNumerator()) && checked::fits<long long>(exact.getDenominator()))
+            ASSERT_EQ(BigFraction(fused), exact);
+        else
+            ASSERT_EQ(fused, a * b + c / d);
+    }
+}
+
+TEST(FractionExpressionTest, wideTest02) {
+    Fraction a(INT_MAX, 3), b(INT_MIN, 7);
+
+    ASSERT_EQ(Fraction(fuse(a) * 3 - a * 3), Fraction(0));
+    ASSERT_EQ(Fraction(fuse(a) / a + b / b), Fraction(2));
+    ASSERT_EQ(Fraction(fuse(b) * 7 / 2), Fraction(INT_MIN / 2));
+    ASSERT_EQ(Fraction(fuse(Fraction(1, 2)) / 0), Fraction(1, 2) / 0);
+#ifdef __SIZEOF_INT128__
+    Fraction128 big(static_cast<__int128>(1) << 100, 3);
+    Fraction128 result = fuse(big) * 3 - big + 1;
+    ASSERT_EQ(result, big * 3 - big + 1);
+#endif
+}
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include "FractionArray.h"
+#include "FractionFile.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    // Scratch file in the working directory, removed when the test ends
+    struct TempFile {
+        std::string path;
+
+        explicit TempFile(const std::string& name) : path("fraction_file_test_" + name + ".bin") {}
+        ~TempFile() { std::remove(path.c_str()); }
+    };
+
+    FractionArray sample(int count) {
+        FractionArray fractions;
+        for (int i = 0; i < count; ++i)
+            fractions.push_back(Fraction(i * 37 - 5000 * (i % 3), i % 97 + 1));
+        return fractions;
+    }
+
+    void corrupt(const std::string& path, long offset) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(offset);
+        char byte = static_cast<char>(file.get());
+        file.seekp(offset);
+        file.put(static_cast<char>(byte ^ 0x10));
+    }
+}
+
+TEST(FractionFileTest, roundTripTest01) {
+    TempFile fixed("fixed"), varint("varint");
+    FractionArray fractions = sample(1000);
+    FractionArray read;
+
+    writeFractionFile(fixed.path, fractions.view(), FractionEncoding::Fixed, 128);
+    writeFractionFile(varint.path, fractions.view(), FractionEncoding::Varint, 128);
+    FractionFileReader fixedReader(fixed.path), varintReader(varint.path);
+
+    ASSERT_EQ(fixedReader.size(), 1000u);
+    ASSERT_EQ(fixedReader.blockCount(), 8u);
+    ASSERT_EQ(varintReader.encoding(), FractionEncoding::Varint);
+    ASSERT_TRUE(fixedReader.verify());
+    ASSERT_TRUE(varintReader.verify());
+    fixedReader.read(read);
+    ASSERT_EQ(read.toVector(), fractions.toVector());
+    varintReader.read(read);
+    ASSERT_EQ(read.toVector(), fractions.toVector());
+    varintReader.readBlock(7, read);
+    ASSERT_EQ(read.size(), 104u);
+    ASSERT_EQ(read[0], fractions[896]);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(FractionFileTest, roundTripTest02) {
+    TempFile wide("wide"), narrow("narrow");
+    FractionArray64 fractions;
+    fractions.push_back(Fraction64(INT64_MAX, 3));
+    fractions.push_back(Fraction64(INT64_MIN + 1, 7));
+    fractions.push_back(Fraction64(0));
+    FractionArray64 read;
+
+    writeFractionFile(wide.path, fractions.view(), FractionEncoding::Varint);
+    writeFractionFile(narrow.path, sample(10).view());
+    FractionFileReader wideReader(wide.path), narrowReader(narrow.path);
+    FractionArray tooNarrow;
+
+    wideReader.read(read);
+    ASSERT_EQ(read.toVector(), fractions.toVector());
+    ASSERT_THROW(wideReader.read(tooNarrow), std::logic_error);
+    // 32-bit files widen into 64-bit arrays
+    narrowReader.read(read);
+    ASSERT_EQ(read[9], Fraction64(333, 10));
+}
+#endif
+
+TEST(FractionFileTest, roundTripTest03) {
+    TempFile fixed("many_fixed"), varint("many_varint");
+    FractionArray fractions = sample(5000);
+    FractionArray read;
+
+    // 313 blocks: the block table alone is far longer than one write of padding
+    writeFractionFile(fixed.path, fractions.view(), FractionEncoding::Fixed, 16);
+    writeFractionFile(varint.path, fractions.view(), FractionEncoding::Varint, 16);
+    FractionFileReader fixedReader(fixed.path), varintReader(varint.path);
+
+    ASSERT_EQ(fixedReader.blockCount(), 313u);
+    ASSERT_TRUE(fixedReader.verify());
+    ASSERT_TRUE(varintReader.verify());
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(fixedReader.view<int>().numerators()) % 64, 0u);
+    fixedReader.read(read);
+    ASSERT_EQ(read.toVector(), fractions.toVector());
+    varintReader.read(read);
+    ASSERT_EQ(read.toVector(), fractions.toVector());
+    varintReader.readBlock(312, read);
+    ASSERT_EQ(read.size(), 8u);
+    ASSERT_EQ(read[7], fractions[4999]);
+}
+
+TEST(FractionFileTest, viewTest01) {
+    TempFile file("view");
+    FractionArray fractions = sample(300);
+    FractionArray expected, product;
+
+    writeFractionFile(file.path, fractions.view());
+    FractionFileReader reader(file.path);
+    FractionView view = reader.view<int>();
+    FractionArray::multiply(fractions, fractions, expected);
+    FractionArray::multiply(view, view, product);
+
+    ASSERT_EQ(view.size(), 300u);
+    ASSERT_EQ(view[123], fractions[123]);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(view.numerators()) % 64, 0u);
+    ASSERT_EQ(product.toVector(), expected.toVector());
+    ASSERT_THROW(reader.view<std::int64_t>(), std::logic_error);
+}
+
+TEST(FractionFileTest, corruptionTest01) {
+    TempFile file("corrupt");
+    FractionArray fractions = sample(1000);
+
+    writeFractionFile(file.path, fractions.view(), FractionEncoding::Fixed, 256);
+    // The denominator column of the last block ends the file
+    long length = static_cast<long>(std::ifstream(file.path, std::ios::binary | std::ios::ate).tellg());
+    corrupt(file.path, length - 1);
+    FractionFileReader reader(file.path);
+
+    ASSERT_TRUE(reader.verifyBlock(0));
+    ASSERT_FALSE(reader.verifyBlock(3));
+    ASSERT_FALSE(reader.verify());
+}
+
+TEST(FractionFileTest, corruptionTest02) {
+    TempFile file("header"), missing("missing");
+
+    writeFractionFile(file.path, sample(10).view());
+    corrupt(file.path, 20);
+
+    ASSERT_THROW(FractionFileReader reader(file.path), std::runtime_error);
+    ASSERT_THROW(FractionFileReader reader(missing.path), std::runtime_error);
+    std::ofstream(missing.path) << "FRACTION but not really";
+    ASSERT_THROW(FractionFileReader reader(missing.path), std::runtime_error);
+}
+
+TEST(FractionFileTest, emptyTest01) {
+    TempFile file("empty");
+    FractionArray read = sample(5);
+
+    writeFractionFile(file.path, FractionArray().view());
+    FractionFileReader reader(file.path);
+    reader.read(read);
+
+    ASSERT_EQ(reader.size(), 0u);
+    ASSERT_EQ(reader.blockCount(), 0u);
+    ASSERT_TRUE(reader.verify());
+    ASSERT_EQ(read.size(), 0u);
+    ASSERT_EQ(reader.view<int>().size(), 0u);
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "FractionHashMap.h"
+#include <climits>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST(FractionHashMapTest, hashTest01) {
+    std::hash<Fraction> hash;
+
+    ASSERT_EQ(Fraction(2, 4).hash(), Fraction(1, 2).hash());
+    ASSERT_EQ(Fraction(3, -6).hash(), Fraction(-1, 2).hash());
+    ASSERT_NE(Fraction(1, 2).hash(), Fraction(2, 1).hash());
+    ASSERT_NE(Fraction(-1, 2).hash(), Fraction(1, 2).hash());
+    ASSERT_EQ(hash(Fraction(10, 5)), hash(Fraction(2)));
+    ASSERT_EQ(Fraction64(INT64_MAX, 3).hash(), Fraction64(INT64_MAX, 3).hash());
+    ASSERT_NE(Fraction64(1, 3).hash(), Fraction64(3, 1).hash());
+    static_assert(Fraction(1, 2).hash() == Fraction(5, 10).hash(), "constant hash");
+
+    std::unordered_set<Fraction> set{ Fraction(1, 3), Fraction(2, 6), Fraction(1, 4) };
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.count(Fraction(3, 9)), 1u);
+}
+
+TEST(FractionHashMapTest, hashTest02) {
+    // Nearby fractions must spread over the low bits used to index a table
+    std::unordered_set<std::uint64_t> buckets;
+    for (int num = 1; num <= 64; ++num)
+        for (int den = 1; den <= 64; ++den)
+            buckets.insert(Fraction(num, den).hash() & 0xffff);
+    ASSERT_GT(buckets.size(), 2000u);
+}
+
+TEST(FractionHashMapTest, mapTest01) {
+    BasicFractionHashMap<int, int> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(Fraction(1, 2)), nullptr);
+    ASSERT_FALSE(map.erase(Fraction(1, 2)));
+    ASSERT_TRUE(map.insert(Fraction(1, 2), 7));
+    ASSERT_FALSE(map.insert(Fraction(2, 4), 8));
+    ASSERT_EQ(*map.find(Fraction(3, 6)), 7);
+    map[Fraction(-1, 3)] += 5;
+    map[Fraction(2, -6)] += 5;
+    ASSERT_EQ(map[Fraction(-1, 3)], 10);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_TRUE(map.erase(Fraction(1, 2)));
+    ASSERT_FALSE(map.contains(Fraction(1, 2)));
+    ASSERT_TRUE(map.contains(Fraction(-1, 3)));
+    map.clear();
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_FALSE(map.contains(Fraction(-1, 3)));
+}
+
+TEST(FractionHashMapTest, mapTest02) {
+    // Random insertions and erasures over a small key space, checked against std::unordered_map
+    std::mt19937 rng(1261);
+    std::uniform_int_distribution<int> numerators(-40, 40);
+    std::uniform_int_distribution<int> denominators(1, 40);
+    BasicFractionHashMap<std::int64_t, int> map;
+    std::unordered_map<Fraction64, int> expected;
+    for (int i = 0; i < 20000; ++i) {
+        Fraction64 key(numerators(rng), denominators(rng));
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(map.erase(key), expected.erase(key) == 1);
+        }
+        else {
+            map[key] += i;
+            expected[key] += i;
+        }
+        ASSERT_EQ(map.size(), expected.size());
+    }
+
+    std::size_t visited = 0;
+    map.forEach([&](const Fraction64& key, int value) {
+        ASSERT_EQ(expected.at(key), value);
+        ++visited;
+    });
+    ASSERT_EQ(visited, expected.size());
+    ASSERT_LE(map.size(), map.capacity());
+}
+
+TEST(FractionHashMapTest, internTest01) {
+    FractionInterner interner;
+
+    FractionInterner::Id half = interner.intern(Fraction(1, 2));
+    FractionInterner::Id third = interner.intern(Fraction(1, 3));
+    ASSERT_EQ(half, 0u);
+    ASSERT_EQ(third, 1u);
+    ASSERT_EQ(interner.intern(Fraction(2, 4)), half);
+    ASSERT_EQ(interner[third], Fraction(2, 6));
+    ASSERT_EQ(interner.size(), 2u);
+
+    FractionInterner::Id id;
+    ASSERT_TRUE(interner.lookup(Fraction(3, 9), id));
+    ASSERT_EQ(id, third);
+    ASSERT_FALSE(interner.lookup(Fraction(INT_MAX), id));
+    ASSERT_EQ(interner.size(), 2u);
+}
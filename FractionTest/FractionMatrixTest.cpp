@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include "FractionMatrix.h"
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+    // Hilbert matrices, whose entries 1/(i + j + 1) make them the classic badly conditioned test case
+    template <typename Matrix>
+    Matrix hilbert(std::size_t size) {
+        Matrix matrix(size, size);
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                matrix(i, j) = Fraction64(1, static_cast<long long>(i + j + 1));
+        return matrix;
+    }
+
+    // Gaussian elimination over BigFraction, the exact reference the fraction-free results must match
+    BigFraction naiveDeterminant(BigFractionMatrix matrix) {
+        BigFraction result(1);
+        std::size_t size = matrix.rows();
+        for (std::size_t k = 0; k < size; ++k) {
+            std::size_t pivot = k;
+            while (pivot < size && matrix(pivot, k) == 0)
+                ++pivot;
+            if (pivot == size)
+                return BigFraction(0);
+            if (pivot != k) {
+                for (std::size_t j = 0; j < size; ++j)
+                    std::swap(matrix(k, j), matrix(pivot, j));
+                result = -1 * result;
+            }
+            result *= matrix(k, k);
+            for (std::size_t i = k + 1; i < size; ++i) {
+                BigFraction factor = matrix(i, k) / matrix(k, k);
+                for (std::size_t j = k; j < size; ++j)
+                    matrix(i, j) -= factor * matrix(k, j);
+            }
+        }
+        return result;
+    }
+
+    BigFractionMatrix randomMatrix(std::mt19937& rng, std::size_t rows, std::size_t columns) {
+        std::uniform_int_distribution<int> numerators(-9, 9);
+        std::uniform_int_distribution<int> denominators(1, 6);
+        BigFractionMatrix matrix(rows, columns);
+        for (std::size_t i = 0; i < rows; ++i)
+            for (std::size_t j = 0; j < columns; ++j)
+                matrix(i, j) = BigFraction(numerators(rng), denominators(rng));
+        return matrix;
+    }
+
+}
+
+TEST(FractionMatrixTest, determinantTest01) {
+    FractionMatrix matrix(3, 3, { Fraction(2), Fraction(-1), Fraction(0),
+                                  Fraction(-1), Fraction(2), Fraction(-1),
+                                  Fraction(0), Fraction(-1), Fraction(2) });
+
+    ASSERT_EQ(matrix.determinant(), Fraction(4));
+    ASSERT_EQ(FractionMatrix::identity(5).determinant(), Fraction(1));
+    ASSERT_EQ(FractionMatrix().determinant(), Fraction(1));
+    ASSERT_EQ(hilbert<FractionMatrix64>(4).determinant(), Fraction64(1, 6048000));
+    ASSERT_EQ(hilbert<FractionMatrix64>(6).determinant(), Fraction64(1, 186313420339200000LL));
+    // A row exchange flips the sign
+    ASSERT_EQ(FractionMatrix(2, 2, { Fraction(0), Fraction(1), Fraction(1), Fraction(0) }).determinant(), Fraction(-1));
+    ASSERT_THROW(FractionMatrix(2, 3).determinant(), std::invalid_argument);
+}
+
+TEST(FractionMatrixTest, determinantTest02) {
+    std::mt19937 rng(1261);
+    for (std::size_t size = 1; size <= 7; ++size) {
+        for (int trial = 0; trial < 10; ++trial) {
+            BigFractionMatrix matrix = randomMatrix(rng, size, size);
+            if (trial % 3 == 0) {
+                // Make the last row a combination of the others
+                for (std::size_t j = 0; j < size; ++j)
+                    matrix(size - 1, j) = size > 1 ? matrix(0, j) * BigFraction(2, 3) - matrix(size / 2, j) : BigFraction(0);
+            }
+            ASSERT_EQ(matrix.determinant(), naiveDeterminant(matrix));
+        }
+    }
+}
+
+TEST(FractionMatrixTest, determinantTest03) {
+    // Entries growing past int overflow the result, not the elimination
+    FractionMatrix matrix(2, 2, { Fraction(65536), Fraction(0), Fraction(0), Fraction(65536) });
+    ASSERT_THROW(matrix.determinant(), std::overflow_error);
+    ASSERT_EQ(FractionMatrix(2, 2, { Fraction(65536), Fraction(1), Fraction(65536), Fraction(2) }).determinant(), Fraction(65536));
+}
+
+TEST(FractionMatrixTest, rankTest01) {
+    FractionMatrix matrix(3, 4, { Fraction(1), Fraction(2), Fraction(3), Fraction(4),
+                                  Fraction(2), Fraction(4), Fraction(6), Fraction(8),
+                                  Fraction(0), Fraction(0), Fraction(1, 2), Fraction(1) });
+
+    ASSERT_EQ(matrix.rank(), 2u);
+    ASSERT_EQ(FractionMatrix(3, 3).rank(), 0u);
+    ASSERT_EQ(hilbert<FractionMatrix64>(8).rank(), 8u);
+}
+
+TEST(FractionMatrixTest, solveTest01) {
+    FractionMatrix matrix(3, 3, { Fraction(2), Fraction(1), Fraction(-1),
+                                  Fraction(-3), Fraction(-1), Fraction(2),
+                                  Fraction(-2), Fraction(1), Fraction(2) });
+    std::vector<Fraction> rhs{ Fraction(8), Fraction(-11), Fraction(-3) };
+    std::vector<Fraction> expected{ Fraction(2), Fraction(3), Fraction(-1) };
+
+    ASSERT_EQ(matrix.solve(rhs), expected);
+    ASSERT_EQ(matrix * matrix.solve(std::vector<Fraction>{ Fraction(1, 2), Fraction(0), Fraction(1, 3) }),
+        (std::vector<Fraction>{ Fraction(1, 2), Fraction(0), Fraction(1, 3) }));
+    ASSERT_THROW(FractionMatrix(2, 2, { Fraction(1), Fraction(2), Fraction(2), Fraction(4) }).solve(std::vector<Fraction>{ Fraction(1), Fraction(1) }), std::domain_error);
+    ASSERT_THROW(matrix.solve(std::vector<Fraction>{ Fraction(1) }), std::invalid_argument);
+}
+
+TEST(FractionMatrixTest, inverseTest01) {
+    // The inverse of a Hilbert matrix has integer entries
+    FractionMatrix64 inverse = hilbert<FractionMatrix64>(3).inverse();
+    FractionMatrix64 expected(3, 3, { Fraction64(9), Fraction64(-36), Fraction64(30),
+                                      Fraction64(-36), Fraction64(192), Fraction64(-180),
+                                      Fraction64(30), Fraction64(-180), Fraction64(180) });
+    ASSERT_EQ(inverse, expected);
+
+    std::mt19937 rng(1261);
+    for (std::size_t size = 1; size <= 6; ++size) {
+        BigFractionMatrix matrix = randomMatrix(rng, size, size);
+        if (matrix.determinant() != 0) {
+            ASSERT_EQ(matrix * matrix.inverse(), BigFractionMatrix::identity(size));
+        }
+    }
+}
+
+TEST(FractionMatrixTest, decomposeTest01) {
+    std::mt19937 rng(1261);
+    for (std::size_t size = 1; size <= 6; ++size) {
+        BigFractionMatrix matrix = randomMatrix(rng, size, size);
+        for (std::size_t j = 0; j < size; ++j)
+            matrix(0, j) = BigFraction(0);
+        matrix(0, size - 1) = BigFraction(5, 2);
+        if (matrix.determinant() == 0)
+            continue;
+
+        BigFractionMatrix::Decomposition lu = matrix.decompose();
+        BigFractionMatrix permuted(size, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(lu.lower(i, i), BigFraction(1));
+            for (std::size_t j = 0; j < size; ++j) {
+                permuted(i, j) = matrix(lu.permutation[i], j);
+                if (j > i) {
+                    ASSERT_EQ(lu.lower(i, j), BigFraction(0));
+                }
+                if (j < i) {
+                    ASSERT_EQ(lu.upper(i, j), BigFraction(0));
+                }
+            }
+        }
+        ASSERT_EQ(lu.lower * lu.upper, permuted);
+    }
+    ASSERT_THROW(FractionMatrix(2, 2).decompose(), std::domain_error);
+}
+
+TEST(FractionMatrixTest, threadTest01) {
+    ThreadPool pool(4);
+    std::mt19937 rng(1261);
+    BigFractionMatrix matrix = randomMatrix(rng, 40, 40);
+    BigFractionMatrix rhs = randomMatrix(rng, 40, 3);
+
+    ASSERT_EQ(matrix.determinant(&pool), matrix.determinant());
+    ASSERT_EQ(matrix.solve(rhs, &pool), matrix.solve(rhs));
+    ASSERT_EQ(matrix.rank(&pool), 40u);
+}
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include "FractionArray.h"
+#include "FractionStream.h"
+#include "ThreadPool.h"
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+namespace {
+
+    std::string sampleText(int lines) {
+        std::ostringstream text;
+        for (int i = 0; i < lines; ++i) {
+            text << (i * 7919 % 20001 - 10000) << '/' << (i % 613 + 1);
+            if (i % 5 == 0)
+                text << "  " << i << " -" << i << "/ " << (2 * i + 2);
+            text << (i % 3 == 0 ? "\r\n" : "\n");
+        }
+        return text.str();
+    }
+
+    // Stream buffer that fails on every read, like a device error
+    struct FailingBuffer : std::streambuf {
+        int_type underflow() override { throw std::runtime_error("device error"); }
+    };
+}
+
+TEST(FractionStreamTest, matchesBulkParseTest01) {
+    std::string text = sampleText(5000);
+    FractionArray expected;
+    ASSERT_TRUE(expected.appendParsed(text));
+
+    ThreadPool pool(4);
+    // Tiny chunks put most line breaks on chunk boundaries and cycle the two windows many times
+    for (std::size_t chunkBytes : { std::size_t(1), std::size_t(7), std::size_t(64), std::size_t(4096), kFractionStreamChunkBytes }) {
+        FractionStreamParser parser(pool, chunkBytes, 3);
+        std::istringstream input(text);
+        FractionArray parsed;
+        FractionBulkParseResult result = parser.parse(input, parsed);
+        ASSERT_TRUE(result) << chunkBytes;
+        EXPECT_EQ(expected.size(), result.count);
+        EXPECT_EQ(text.size(), result.position);
+        ASSERT_EQ(expected.size(), parsed.size());
+        for (std::size_t i = 0; i < parsed.size(); ++i)
+            ASSERT_EQ(expected[i], parsed[i]) << chunkBytes << " " << i;
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(FractionStreamTest, edgeInputsTest02) {
+    ThreadPool pool(2);
+    FractionStreamParser64 parser(pool, 8);
+    FractionArray64 parsed;
+
+    std::istringstream empty("");
+    FractionBulkParseResult result = parser.parse(empty, parsed);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(0u, result.count);
+
+    // No final newline, and a line far longer than a chunk
+    std::string longLine = "6/8";
+    for (int i = 0; i < 200; ++i)
+        longLine += " " + std::to_string(i) + "/4";
+    std::istringstream input("1/2\n" + longLine + "\n-9/3");
+    result = parser.parse(input, parsed);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(203u, parsed.size());
+    EXPECT_EQ(Fraction64(1, 2), parsed[0]);
+    EXPECT_EQ(Fraction64(3, 4), parsed[1]);
+    EXPECT_EQ(Fraction64(199, 4), parsed[201]);
+    EXPECT_EQ(Fraction64(-3), parsed[202]);
+
+    EXPECT_THROW(FractionStreamParser(pool, 0), std::invalid_argument);
+}
+#endif
+
+TEST(FractionStreamTest, errorPositionTest03) {
+    std::string text = sampleText(2000);
+    std::size_t bad = text.size() / 2;
+    bad = text.find('\n', bad) + 1;
+    std::string broken = text.substr(0, bad) + "3/x\n" + text.substr(bad);
+
+    FractionArray expected;
+    FractionBulkParseResult bulk = expected.appendParsed(broken);
+    ASSERT_FALSE(bulk);
+
+    ThreadPool pool(3);
+    FractionStreamParser parser(pool, 100, 2);
+    std::istringstream input(broken);
+    FractionArray parsed;
+    FractionBulkParseResult result = parser.parse(input, parsed);
+    EXPECT_EQ(FractionParseError::ExpectedDenominator, result.error);
+    EXPECT_EQ(bulk.position, result.position);
+    EXPECT_EQ(bad + 2, result.position);
+    EXPECT_EQ(bulk.count, result.count);
+    ASSERT_EQ(expected.size(), parsed.size());
+    EXPECT_EQ(expected[expected.size() - 1], parsed[parsed.size() - 1]);
+
+    // The parser is reusable after a failure
+    std::istringstream again(text);
+    parsed.clear();
+    EXPECT_TRUE(parser.parse(again, parsed));
+}
+
+TEST(FractionStreamTest, callbackOrderTest04) {
+    std::ostringstream text;
+    for (int i = 1; i <= 3000; ++i)
+        text << i << '\n';
+    ThreadPool pool(4);
+    FractionStreamParser parser(pool, 50, 5);
+    std::istringstream input(text.str());
+    int expected = 1;
+    std::size_t runs = 0;
+    FractionBulkParseResult result = parser.parse(input, [&](const FractionView& fractions) {
+        ++runs;
+        for (std::size_t i = 0; i < fractions.size(); ++i)
+            EXPECT_EQ(Fraction(expected++), fractions[i]);
+    });
+    EXPECT_TRUE(result);
+    EXPECT_EQ(3000u, result.count);
+    EXPECT_EQ(3001, expected);
+    EXPECT_GT(runs, 100u);
+}
+
+TEST(FractionStreamTest, exceptionPropagatesTest05) {
+    std::string text = sampleText(3000);
+    ThreadPool pool(2);
+    FractionStreamParser parser(pool, 64, 2);
+    std::istringstream input(text);
+    int calls = 0;
+    EXPECT_THROW(parser.parse(input, [&](const FractionView&) {
+        if (++calls == 10)
+            throw std::runtime_error("stop");
+    }), std::runtime_error);
+    EXPECT_EQ(10, calls);
+
+    // Errors from the stream itself come back from parse() too
+    FailingBuffer buffer;
+    std::istream failing(&buffer);
+    failing.exceptions(std::ios::badbit);
+    FractionArray parsed;
+    EXPECT_THROW(parser.parse(failing, parsed), std::runtime_error);
+}
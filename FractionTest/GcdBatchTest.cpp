@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include "GcdBatch.h"
+#include "FractionArray.h"
+#include <climits>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<gcd::Isa> supportedIsas() {
+        std::vector<gcd::Isa> isas = { gcd::Isa::Scalar };
+        if (gcd::detectedIsa() != gcd::Isa::Scalar)
+            isas.push_back(gcd::Isa::Avx2);
+        if (gcd::detectedIsa() == gcd::Isa::Avx512)
+            isas.push_back(gcd::Isa::Avx512);
+        return isas;
+    }
+}
+
+TEST(GcdBatchTest, gcdBatchTest01) {
+    std::mt19937 rng(1261);
+    std::vector<std::uint32_t> a(1003), b(1003), expected(1003), out(1003);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::uint32_t shared = (rng() >> (rng() % 32)) | 1;
+        a[i] = (rng() >> (rng() % 32)) * (i % 3 ? shared : 1);
+        b[i] = (rng() >> (rng() % 32)) * shared;
+        expected[i] = std::gcd(a[i], b[i]);
+    }
+    a[0] = 0; b[1] = 0; a[2] = 0; b[2] = 0; a[3] = 0x80000000u; b[3] = 0x40000000u;
+    for (std::size_t i = 0; i < 4; ++i)
+        expected[i] = std::gcd(a[i], b[i]);
+
+    for (gcd::Isa isa : supportedIsas()) {
+        gcd::setBatchIsa(isa);
+        gcd::gcdBatch(a.data(), b.data(), out.data(), a.size());
+        ASSERT_EQ(out, expected);
+    }
+    gcd::setBatchIsa(gcd::detectedIsa());
+}
+
+TEST(GcdBatchTest, reduceBatchTest01) {
+    std::mt19937 rng(1261);
+    std::uniform_int_distribution<int> values(-100000, 100000);
+    std::vector<std::int32_t> numerators, denominators;
+    for (int i = 0; i < 1003; ++i) {
+        int factor = values(rng) % 50;
+        numerators.push_back(values(rng) * factor);
+        denominators.push_back(values(rng) * factor);
+    }
+    // Edge cases at several lane positions of each vector width, and in the scalar tail. Every INT_MIN
+    // denominator shares a factor with its numerator, since negating INT_MIN itself would overflow
+    // in Fraction::reduce() too
+    const std::int32_t specialNumerators[] = { 0, 0, 5, INT_MIN, -6, 8, 1, -2 };
+    const std::int32_t specialDenominators[] = { 0, -4, 0, 2, -9, INT_MIN, -1, INT_MIN };
+    for (std::size_t start : { 0, 13, 42, 509, 995 }) {
+        for (std::size_t i = 0; i < 8; ++i) {
+            numerators[start + i] = specialNumerators[i];
+            denominators[start + i] = specialDenominators[i];
+        }
+    }
+
+    for (gcd::Isa isa : supportedIsas()) {
+        gcd::setBatchIsa(isa);
+        std::vector<std::int32_t> num = numerators, den = denominators;
+        gcd::reduceBatch(num.data(), den.data(), num.size());
+        for (std::size_t i = 0; i < num.size(); ++i) {
+            Fraction expected(numerators[i], denominators[i]);
+            ASSERT_EQ(num[i], expected.getNumerator());
+            ASSERT_EQ(den[i], expected.getDenominator());
+        }
+    }
+    gcd::setBatchIsa(gcd::detectedIsa());
+}
+
+TEST(GcdBatchTest, normalizeTest01) {
+    std::vector<int> numerators = { 8, 3, 0, -10, 7 };
+    std::vector<int> denominators = { 22, -6, 9, -4, 1 };
+    FractionArray array = FractionArray::fromColumns(numerators.data(), denominators.data(), numerators.size());
+
+    ASSERT_EQ(array.toVector(), std::vector<Fraction>({ Fraction(4, 11), Fraction(-1, 2), Fraction(0), Fraction(5, 2), Fraction(7) }));
+    ASSERT_EQ(array.numerators()[1], -1);
+    ASSERT_EQ(array.denominators()[2], 1);
+}
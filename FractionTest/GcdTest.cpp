@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include "Gcd.h"
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+TEST(GcdTest, euclidTest01) {
+    ASSERT_EQ(gcd::euclid(48u, 18u), 6u);
+    ASSERT_EQ(gcd::euclid(0u, 7u), 7u);
+    ASSERT_EQ(gcd::euclid(7u, 0u), 7u);
+    ASSERT_EQ(gcd::euclid(0u, 0u), 0u);
+}
+
+TEST(GcdTest, binaryTest01) {
+    ASSERT_EQ(gcd::binary(48u, 18u), 6u);
+    ASSERT_EQ(gcd::binary(0u, 7u), 7u);
+    ASSERT_EQ(gcd::binary(7u, 0u), 7u);
+    ASSERT_EQ(gcd::binary(0u, 0u), 0u);
+    ASSERT_EQ(gcd::binary(1024u, 96u), 32u);
+}
+
+TEST(GcdTest, lehmerTest01) {
+    ASSERT_EQ(gcd::lehmer(48u, 18u), 6u);
+    ASSERT_EQ(gcd::lehmer(0u, 7u), 7u);
+    ASSERT_EQ(gcd::lehmer(7u, 0u), 7u);
+    ASSERT_EQ(gcd::lehmer(0u, 0u), 0u);
+}
+
+TEST(GcdTest, randomTest01) {
+    std::mt19937_64 rng(1261);
+    for (int i = 0; i < 20000; ++i) {
+        std::uint64_t shared = rng() >> (rng() % 64);
+        std::uint64_t a = (rng() >> (rng() % 64)) * (shared | 1);
+        std::uint64_t b = (rng() >> (rng() % 64)) * (shared | 1);
+        std::uint64_t expected = std::gcd(a, b);
+
+        ASSERT_EQ(gcd::euclid(a, b), expected);
+        ASSERT_EQ(gcd::binary(a, b), expected);
+        ASSERT_EQ(gcd::lehmer(a, b), expected);
+    }
+}
+
+TEST(GcdTest, randomTest02) {
+    std::mt19937 rng(1261);
+    for (int i = 0; i < 20000; ++i) {
+        std::uint32_t a = rng() >> (rng() % 32);
+        std::uint32_t b = rng() >> (rng() % 32);
+        std::uint32_t expected = std::gcd(a, b);
+
+        ASSERT_EQ(gcd::binary(a, b), expected);
+        ASSERT_EQ(gcd::lehmer(a, b), expected);
+    }
+}
+
+TEST(GcdTest, computeTest01) {
+    ASSERT_EQ(gcd::compute(8, -22), 2u);
+    ASSERT_EQ(gcd::compute(-8, -22), 2u);
+    ASSERT_EQ(gcd::compute(INT32_MIN, 0), 2147483648u);
+}
+
+TEST(GcdTest, dispatchTest01) {
+    for (gcd::Kernel kernel : { gcd::Kernel::Euclid, gcd::Kernel::Binary, gcd::Kernel::Lehmer }) {
+        ASSERT_EQ(gcd::run(kernel, 3u * 5u * 7u * 64u, 5u * 7u * 11u * 8u), 5u * 7u * 8u);
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(GcdTest, wideTest01) {
+    std::mt19937_64 rng(1261);
+    for (int i = 0; i < 5000; ++i) {
+        unsigned __int128 shared = rng() | 1;
+        unsigned __int128 a = ((unsigned __int128)(rng() >> 1) << 32 | rng()) * (i % 2 ? shared : 1);
+        unsigned __int128 b = ((unsigned __int128)(rng() >> 1) << 16 | rng()) * shared;
+
+        ASSERT_TRUE(gcd::lehmer(a, b) == gcd::euclid(a, b));
+        ASSERT_TRUE(gcd::binary(a, b) == gcd::euclid(a, b));
+    }
+}
+#endif
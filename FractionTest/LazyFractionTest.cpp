@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "LazyFraction.h"
+#include <climits>
+#include <random>
+#include <sstream>
+#include <unordered_set>
+
+TEST(LazyFractionTest, normalizeTest01) {
+    LazyFraction f1(8, -22);
+
+    ASSERT_FALSE(f1.isNormalized());
+    ASSERT_EQ(f1.getNumerator(), -4);
+    ASSERT_EQ(f1.getDenominator(), 11);
+    ASSERT_TRUE(f1.isNormalized());
+    ASSERT_TRUE(LazyFraction(7).isNormalized());
+}
+
+TEST(LazyFractionTest, accumulateTest01) {
+    LazyFraction sum(0);
+    Fraction expected(0);
+    for (int i = 0; i < 1000; ++i) {
+        sum += LazyFraction(i % 7, 100);
+        expected += Fraction(i % 7, 100);
+    }
+
+    ASSERT_FALSE(sum.isNormalized());
+    ASSERT_EQ(sum.toFraction(), expected);
+    ASSERT_EQ(sum, LazyFraction(expected));
+}
+
+TEST(LazyFractionTest, randomTest01) {
+    std::mt19937 rng(1261);
+    std::uniform_int_distribution<int> numerators(-50, 50);
+    std::uniform_int_distribution<int> denominators(1, 12);
+    LazyFraction lazy(1);
+    Fraction eager(1);
+    for (int i = 0; i < 5000; ++i) {
+        LazyFraction operand(numerators(rng), denominators(rng));
+        Fraction expected = operand.toFraction();
+        switch (i % 5) {
+        case 0: lazy += operand; eager += expected; break;
+        case 1: lazy -= operand; eager -= expected; break;
+        case 2: lazy *= operand; eager *= expected; break;
+        case 3:
+            if (expected != Fraction(0)) {
+                lazy /= operand;
+                eager /= expected;
+            }
+            break;
+        default: lazy += 3; eager += 3; break;
+        }
+        // Restart before any result overflows int, where the two would only agree by accident
+        if (eager > Fraction(1000) || eager < Fraction(-1000) || eager.getDenominator() > 100000) {
+            lazy = LazyFraction(1);
+            eager = Fraction(1);
+        }
+        ASSERT_EQ(lazy.compare(LazyFraction(eager)), 0);
+    }
+    ASSERT_EQ(lazy.toFraction(), eager);
+}
+
+TEST(LazyFractionTest, overflowTest01) {
+    LazyFraction f1(INT_MAX - 1, 2);
+    LazyFraction f2(2, 4);
+    f1 *= f2;
+
+    ASSERT_TRUE(f1.isNormalized());
+    ASSERT_EQ(f1.toFraction(), Fraction(INT_MAX - 1, 4));
+}
+
+TEST(LazyFractionTest, compareTest01) {
+    LazyFraction f1(2, 6);
+    LazyFraction f2(3, 6);
+
+    ASSERT_LT(f1, f2);
+    ASSERT_GE(f2, f1);
+    ASSERT_FALSE(f1.isNormalized());
+    ASSERT_EQ(f1, LazyFraction(1, 3));
+    ASSERT_NE(f1, f2);
+}
+
+TEST(LazyFractionTest, hashTest01) {
+    std::unordered_set<LazyFraction> seen;
+    seen.insert(LazyFraction(2, 4));
+    seen.insert(LazyFraction(-3, -6));
+    seen.insert(LazyFraction(1, 3));
+
+    ASSERT_EQ(seen.size(), 2u);
+    ASSERT_EQ(seen.count(LazyFraction(50, 100)), 1u);
+
+    // A lazy fraction hashes as the equal Fraction does, however it was computed
+    LazyFraction sum = LazyFraction(1, 6) + LazyFraction(1, 3);
+    ASSERT_EQ(std::hash<LazyFraction>()(sum), std::hash<Fraction>()(Fraction(1, 2)));
+    ASSERT_EQ(LazyFraction(-6, 8).hash(), Fraction(-3, 4).hash());
+    ASSERT_NE(LazyFraction(1, 2).hash(), LazyFraction(2, 1).hash());
+}
+
+TEST(LazyFractionTest, streamTest01) {
+    std::stringstream stream("6/-8");
+    LazyFraction f1;
+    stream >> f1;
+
+    std::stringstream output;
+    output << f1;
+    ASSERT_EQ(output.str(), "-3/4");
+}
@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include "ModularFraction.h"
+#include <atomic>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+    // The harmonic number H(n) = 1 + 1/2 + ... + 1/n, whose denominator grows like lcm(1..n)
+    BigFraction harmonic(int n) {
+        BigFraction sum(0);
+        for (int i = 1; i <= n; ++i)
+            sum += BigFraction(1, i);
+        return sum;
+    }
+
+    modular::Residue harmonic(const modular::Field& field, int n) {
+        modular::Residue sum = field.zero();
+        for (int i = 1; i <= n; ++i)
+            sum += field.one() / field(i);
+        return sum;
+    }
+
+}
+
+TEST(ModularFractionTest, fieldTest01) {
+    std::mt19937_64 rng(7);
+    for (std::size_t index : { std::size_t(0), std::size_t(5) }) {
+        std::uint64_t prime = modular::prime(index);
+        modular::Field field(prime);
+        BigInteger big(static_cast<long long>(prime));
+        std::uniform_int_distribution<long long> values(-(1LL << 62), 1LL << 62);
+        for (int i = 0; i < 200; ++i) {
+            long long a = values(rng);
+            long long b = values(rng);
+            BigInteger product = BigInteger(a) * BigInteger(b) % big;
+            if (product.sign() < 0)
+                product += big;
+            ASSERT_EQ(static_cast<long long>((field(a) * field(b)).value()), product.toSmall());
+            if (b % static_cast<long long>(prime) != 0) {
+                ASSERT_EQ((field(a) / field(b)) * field(b), field(a));
+            }
+            ASSERT_EQ((field(a) + field(b)) - field(b), field(a));
+            ASSERT_EQ(-field(a) + field(a), field.zero());
+        }
+    }
+    ASSERT_FALSE(modular::Field(modular::prime(0)).unlucky());
+}
+
+TEST(ModularFractionTest, fieldTest02) {
+    modular::Field field(7);
+    ASSERT_EQ(field(Fraction(3, 4)) * field(4), field(3));
+    ASSERT_EQ(field(Fraction(-1, 2)).value(), 3u);
+    ASSERT_EQ(field(BigFraction(BigInteger(10), BigInteger(3))).value(), 1u);
+    ASSERT_FALSE(field.unlucky());
+    modular::Residue undefined = field.one() / field(14);
+    ASSERT_EQ(undefined, field.zero());
+    ASSERT_TRUE(field.unlucky());
+    ASSERT_THROW(modular::Field(8), std::invalid_argument);
+    ASSERT_THROW(modular::Field(std::uint64_t(1) << 62 | 1), std::invalid_argument);
+}
+
+TEST(ModularFractionTest, primeTest01) {
+    ASSERT_EQ(modular::prime(0), (std::uint64_t(1) << 62) - 57);
+    for (std::size_t i = 1; i < 20; ++i) {
+        ASSERT_LT(modular::prime(i), modular::prime(i - 1));
+        ASSERT_TRUE(modular::isPrime(modular::prime(i)));
+    }
+    ASSERT_TRUE(modular::isPrime(2));
+    ASSERT_TRUE(modular::isPrime(37));
+    ASSERT_TRUE(modular::isPrime((std::uint64_t(1) << 61) - 1));
+    ASSERT_FALSE(modular::isPrime(1));
+    ASSERT_FALSE(modular::isPrime(561));
+    // Strong pseudoprime to the bases 2, 3, 5 and 7
+    ASSERT_FALSE(modular::isPrime(3215031751u));
+}
+
+TEST(ModularFractionTest, evaluateTest01) {
+    ThreadPool pool(4);
+    for (int n : { 1, 10, 100, 400 }) {
+        BigFraction result = modular::evaluate([n](const modular::Field& field) { return harmonic(field, n); }, pool);
+        ASSERT_EQ(result, harmonic(n));
+    }
+}
+
+TEST(ModularFractionTest, evaluateTest02) {
+    ThreadPool pool(2);
+    auto zero = modular::evaluate([](const modular::Field& field) { return field(Fraction(1, 3)) - field(Fraction(2, 6)); }, pool);
+    ASSERT_EQ(zero, BigFraction(0));
+    auto negative = modular::evaluateAs<int>([](const modular::Field& field) { return field(Fraction(1, 6)) - field(Fraction(3, 4)); }, pool);
+    ASSERT_EQ(negative, Fraction(-7, 12));
+    auto whole = modular::evaluateAs<std::int64_t>([](const modular::Field& field) { return field(-1234567890123LL) * field(1000); }, pool);
+    ASSERT_EQ(whole, Fraction64(-1234567890123000LL));
+    ASSERT_THROW(modular::evaluateAs<int>([](const modular::Field& field) { return field(1LL << 40); }, pool), std::overflow_error);
+    ASSERT_THROW(modular::evaluate([](const modular::Field& field) { return harmonic(field, 200); }, pool, 2), std::runtime_error);
+}
+
+TEST(ModularFractionTest, evaluateTest03) {
+    // With one thread the batches are a single prime, so a small answer costs its prime and one to confirm it
+    ThreadPool pool(1);
+    std::atomic<int> calls(0);
+    auto third = modular::evaluate([&](const modular::Field& field) { ++calls; return field.one() / field(3); }, pool);
+    ASSERT_EQ(third, BigFraction(1, 3));
+    ASSERT_EQ(calls.load(), 2);
+
+    // H(300) has a 429-bit numerator and a 427-bit denominator, so reconstruction needs 14 of the 62-bit primes
+    calls = 0;
+    auto sum = modular::evaluate([&](const modular::Field& field) { ++calls; return harmonic(field, 300); }, pool);
+    ASSERT_EQ(sum, harmonic(300));
+    ASSERT_GE(calls.load(), 14);
+    // Batches grow by a quarter, and both the one that crossed the bound and the confirming one are paid for
+    ASSERT_LE(calls.load(), 14 + 2 * (14 / 4 + 1));
+}
+
+TEST(ModularFractionTest, evaluateTest04) {
+    // The first prime divides a denominator, so its residue is dropped and the answer comes from the others
+    ThreadPool pool(2);
+    BigInteger first(static_cast<long long>(modular::prime(0)));
+    auto result = modular::evaluate([&](const modular::Field& field) { return field.one() + field.one() / field(first); }, pool);
+    ASSERT_EQ(result, BigFraction(first + BigInteger(1), first));
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "Parallel.h"
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    std::vector<Fraction> smallDenominators(std::size_t count, unsigned seed, int maxNumerator, int maxDenominator) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> numerators(-maxNumerator, maxNumerator);
+        std::uniform_int_distribution<int> denominators(1, maxDenominator);
+        std::vector<Fraction> fractions;
+        for (std::size_t i = 0; i < count; ++i)
+            fractions.emplace_back(numerators(rng), denominators(rng));
+        return fractions;
+    }
+}
+
+TEST(ParallelTest, sumTest01) {
+    auto values = smallDenominators(50000, 1, 99, 12);
+    Fraction expected(0);
+    for (const Fraction& value : values)
+        expected += value;
+
+    for (unsigned threads : { 1u, 3u, 8u }) {
+        ThreadPool pool(threads);
+        Fraction result = parallel::sum(values.begin(), values.end(), pool);
+        ASSERT_EQ(result.getNumerator(), expected.getNumerator());
+        ASSERT_EQ(result.getDenominator(), expected.getDenominator());
+    }
+    ASSERT_EQ(parallel::sum(values.begin(), values.end()), expected);
+}
+
+TEST(ParallelTest, productTest01) {
+    std::vector<Fraction> values;
+    for (int i = 1; i <= 5000; ++i)
+        values.emplace_back(i % 7 == 0 ? -(i + 1) : i + 1, i);
+    Fraction expected(1);
+    for (const Fraction& value : values)
+        expected *= value;
+
+    ThreadPool pool(4);
+    ASSERT_EQ(expected, Fraction(5001));
+    ASSERT_EQ(parallel::product(values.begin(), values.end(), pool), expected);
+}
+
+TEST(ParallelTest, dotTest01) {
+    auto lhs = smallDenominators(20000, 2, 9, 4);
+    auto rhs = smallDenominators(20000, 3, 9, 4);
+    Fraction expected(0);
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+        expected += lhs[i] * rhs[i];
+
+    ThreadPool pool(5);
+    ASSERT_EQ(parallel::dot(lhs.begin(), lhs.end(), rhs.begin(), pool), expected);
+}
+
+TEST(ParallelTest, emptyTest01) {
+    std::vector<Fraction> values;
+
+    ASSERT_EQ(parallel::sum(values.begin(), values.end()), Fraction(0));
+    ASSERT_EQ(parallel::product(values.begin(), values.end()), Fraction(1));
+}
+
+TEST(ParallelTest, bigTest01) {
+    std::vector<BigFraction> values;
+    BigFraction expected(0);
+    for (long long i = 1; i <= 3000; ++i) {
+        values.emplace_back(1, i);
+        expected += BigFraction(1, i);
+    }
+
+    ThreadPool pool(4);
+    ASSERT_EQ(parallel::sum(values.begin(), values.end(), pool), expected);
+}
+
+TEST(ParallelTest, overflowTest01) {
+    // Each partial fits, but the sum is 4000 * 2^20, past INT_MAX
+    std::vector<Fraction> values(4000, Fraction(1 << 20));
+    std::vector<Fraction> ones(4000, Fraction(1));
+    std::vector<Fraction> halves(40, Fraction(1, 2));
+    ThreadPool pool(2);
+
+    ASSERT_THROW(parallel::sum(values.begin(), values.end(), pool), std::overflow_error);
+    ASSERT_THROW(parallel::product(halves.begin(), halves.end(), pool), std::overflow_error);
+    ASSERT_THROW(parallel::dot(values.begin(), values.end(), ones.begin(), pool), std::overflow_error);
+    ASSERT_EQ(parallel::sum(values.begin(), values.begin() + 2047, pool), Fraction(2047 << 20));
+}
+
+TEST(ParallelTest, throwTest01) {
+    ThreadPool pool(4);
+    std::atomic<int> ran(0);
+    auto task = [&ran](std::size_t index) {
+        if (index == 5)
+            throw std::runtime_error("task 5");
+        ++ran;
+    };
+
+    ASSERT_THROW(pool.run(1000, task), std::runtime_error);
+    ASSERT_LT(ran.load(), 1000);
+    // The pool is left ready for the next run
+    ran = 0;
+    pool.run(1000, [&ran](std::size_t) { ++ran; });
+    ASSERT_EQ(ran.load(), 1000);
+    ASSERT_THROW(pool.run(6, task), std::runtime_error);
+}
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include "FractionArray.h"
+#include <climits>
+#include <sstream>
+#include <string>
+
+TEST(TextTest, parseTest01) {
+    auto result = Fraction::parse("  8/-22 ");
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result.value, Fraction(-4, 11));
+    ASSERT_EQ(Fraction::parse("+5 /  -22").value, Fraction(-5, 22));
+    ASSERT_EQ(Fraction::parse("7").value, Fraction(7));
+}
+
+TEST(TextTest, parseTest02) {
+    auto missing = Fraction::parse("  /3");
+    auto denominator = Fraction::parse("3/x");
+    auto trailing = Fraction::parse("3/4 5");
+    auto range = Fraction::parse("1/99999999999");
+
+    ASSERT_EQ(missing.error, FractionParseError::ExpectedNumerator);
+    ASSERT_EQ(missing.position, 2u);
+    ASSERT_EQ(denominator.error, FractionParseError::ExpectedDenominator);
+    ASSERT_EQ(denominator.position, 2u);
+    ASSERT_EQ(trailing.error, FractionParseError::TrailingCharacters);
+    ASSERT_EQ(trailing.position, 4u);
+    ASSERT_EQ(range.error, FractionParseError::OutOfRange);
+    ASSERT_FALSE(Fraction::parse(""));
+    ASSERT_STREQ(describe(FractionParseError::None), "no error");
+}
+
+TEST(TextTest, formatTest01) {
+    char buffer[Fraction::kFormatBufferSize];
+    Fraction f1(INT_MIN + 1, INT_MAX - 1);
+
+    ASSERT_EQ(Fraction(2, -4).format(buffer), 4u);
+    ASSERT_STREQ(buffer, "-1/2");
+    f1.format(buffer);
+    ASSERT_EQ(Fraction::parse(buffer).value, f1);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(TextTest, wideTest01) {
+    char buffer[Fraction128::kFormatBufferSize];
+    __int128 big = (__int128)1 << 100;
+    Fraction128 f1(-big, 3);
+    f1.format(buffer);
+
+    ASSERT_STREQ(buffer, "-1267650600228229401496703205376/3");
+    ASSERT_TRUE(Fraction128::parse(buffer).value == f1);
+    ASSERT_EQ(Fraction128::parse("170141183460469231731687303715884105728").error, FractionParseError::OutOfRange);
+}
+#endif
+
+TEST(TextTest, streamTest01) {
+    std::istringstream stream("1/2 3 -4 / 6\n5/x");
+    Fraction f1, f2, f3, f4(9);
+
+    stream >> f1 >> f2 >> f3;
+    ASSERT_EQ(f1, Fraction(1, 2));
+    ASSERT_EQ(f2, Fraction(3));
+    ASSERT_EQ(f3, Fraction(-2, 3));
+    ASSERT_FALSE(stream.fail());
+    stream >> f4;
+    ASSERT_TRUE(stream.fail());
+    ASSERT_EQ(f4, Fraction(9));
+}
+
+TEST(TextTest, bulkTest01) {
+    FractionArray array;
+    auto result = array.appendParsed("1/2 4/8\n-6/4\t7\r\n");
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result.count, 4u);
+    ASSERT_EQ(array.toVector(), std::vector<Fraction>({ Fraction(1, 2), Fraction(1, 2), Fraction(-3, 2), Fraction(7) }));
+
+    auto failed = array.appendParsed("3/9 x");
+    ASSERT_EQ(failed.error, FractionParseError::ExpectedNumerator);
+    ASSERT_EQ(failed.count, 1u);
+    ASSERT_EQ(failed.position, 4u);
+    ASSERT_EQ(array[4], Fraction(1, 3));
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "Fraction.h"
+#include <climits>
+#include <sstream>
+#include <string>
+
+TEST(WidthTest, intermediateTest01) {
+    // 2^20 * 2^12 overflows an int before reduce() can bring it back into range
+    Fraction f1(1 << 20, 3);
+    Fraction f2(1 << 12, 1 << 20);
+    Fraction expectedResult(1 << 12, 3);
+
+    ASSERT_EQ(f1 * f2, expectedResult);
+}
+
+TEST(WidthTest, intermediateTest02) {
+    Fraction f1(INT_MAX, 2);
+    Fraction f2(INT_MAX, 2);
+    Fraction expectedResult(INT_MAX, 1);
+
+    ASSERT_EQ(f1 + f2, expectedResult);
+}
+
+TEST(WidthTest, wideTest01) {
+    Fraction64 f1(1, 100);
+    for (int i = 0; i < 40; ++i)
+        f1 += Fraction64(INT_MAX, 100);
+    Fraction64 expectedResult(40LL * INT_MAX + 1, 100);
+
+    ASSERT_EQ(f1, expectedResult);
+    ASSERT_GT(f1 * 100, INT_MAX);
+}
+
+TEST(WidthTest, wideTest02) {
+    Fraction64 f1(3, 4);
+
+    ASSERT_EQ(f1 + 1, Fraction64(7, 4));
+    ASSERT_EQ(2 * f1, Fraction64(3, 2));
+    ASSERT_LT(f1, 1);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(WidthTest, wideTest03) {
+    Fraction128 f1(INT64_MAX, 3);
+    Fraction128 f2 = f1 * f1;
+    std::stringstream ss;
+    ss << f2;
+
+    ASSERT_EQ(ss.str(), "85070591730234615847396907784232501249/9");
+    ASSERT_GT(f2, f1);
+}
+
+TEST(WidthTest, wideTest04) {
+    Fraction128 f1;
+    std::istringstream si(std::string("-85070591730234615847396907784232501249/ 9"));
+    si >> f1;
+    Fraction128 f2(INT64_MAX, 3);
+
+    ASSERT_EQ(f1, -1 * f2 * f2);
+}
+
+TEST(WidthTest, cancelTest01) {
+    // Without cancelling first, 255 * 2^120 overflows the 128-bit intermediate
+    Fraction128 f1(Fraction128::Integer(1) << 120, 3);
+    Fraction128 f2(255, Fraction128::Integer(1) << 110);
+
+    ASSERT_EQ(f1 * f2, Fraction128(85 << 10));
+    ASSERT_EQ(f1 / (1 / f2), Fraction128(85 << 10));
+    ASSERT_EQ(f2 * (Fraction128::Integer(1) << 120), Fraction128(255 << 10));
+}
+
+TEST(WidthTest, henriciTest01) {
+    // The product of the denominators, 3 * 2^200, does not fit; the sum does
+    Fraction128 f1(1, Fraction128::Integer(1) << 100);
+    Fraction128 f2(1, 3 * (Fraction128::Integer(1) << 100));
+
+    ASSERT_EQ(f1 + f2, Fraction128(1, 3 * (Fraction128::Integer(1) << 98)));
+    ASSERT_EQ(f1 - f2, Fraction128(1, 3 * (Fraction128::Integer(1) << 99)));
+    ASSERT_EQ(f2 - f2, Fraction128(0));
+}
+#endif
+
+TEST(WidthTest, cancelTest02) {
+    Fraction64 f1(INT64_MAX, 6);
+    Fraction64 f2(-12, INT64_MAX);
+
+    ASSERT_EQ(f1 * f2, Fraction64(-2));
+    ASSERT_EQ(f1 / -f2.getNumerator(), Fraction64(INT64_MAX, 72));
+    ASSERT_EQ(-2 / f2, Fraction64(INT64_MAX, 6));
+    ASSERT_EQ(f2 * 3, Fraction64(-36, INT64_MAX));
+    ASSERT_EQ(Fraction64(0) / f2, Fraction64(0));
+    ASSERT_EQ(Fraction64(-2, 3) / Fraction64(-4, 9), Fraction64(3, 2));
+}
+
+TEST(WidthTest, henriciTest02) {
+    Fraction64 frame(1001, 30000);
+    Fraction64 film(1, 24);
+
+    ASSERT_EQ(frame + film, Fraction64(2251, 30000));
+    ASSERT_EQ(frame - film, Fraction64(-249, 30000));
+    ASSERT_EQ(Fraction64(1, 4) + Fraction64(1, 4), Fraction64(1, 2));
+    ASSERT_EQ(Fraction64(3, 4) - Fraction64(3, 4), Fraction64(0));
+    ASSERT_EQ(Fraction64(5, 3) + 2, Fraction64(11, 3));
+    ASSERT_EQ(2 - Fraction64(5, 3), Fraction64(1, 3));
+    ASSERT_EQ(Fraction64(-7, 2) + 3, Fraction64(-1, 2));
+    ASSERT_EQ(Fraction64(INT64_MIN + 1, 2) - Fraction64(INT64_MAX, 2), Fraction64(INT64_MIN + 1));
+}